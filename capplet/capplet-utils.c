@@ -269,6 +269,143 @@ capplet_dialog_raise(NwamPrefIFace *iface)
 	return FALSE;
 }
 
+#define CAPPLET_DIALOG_COMMIT_KEY   "capplet_dialog_commit"
+
+typedef struct {
+    GtkDialog                          *dialog;
+    guint                               job_id;
+    GtkWidget                          *progress;
+    capplet_dialog_commit_done_func_t   done;
+    gpointer                            user_data;
+} CappletDialogCommit;
+
+static void
+capplet_dialog_commit_set_busy(GtkDialog *dialog, gboolean busy)
+{
+    GList *children;
+    GList *i;
+
+    /* Everything but the buttons, Cancel stays usable to stop the job. */
+    children = gtk_container_get_children(GTK_CONTAINER(dialog->vbox));
+    for (i = children; i; i = g_list_next(i)) {
+        if (i->data != (gpointer)dialog->action_area) {
+            gtk_widget_set_sensitive(GTK_WIDGET(i->data), !busy);
+        }
+    }
+    g_list_free(children);
+
+    gtk_dialog_set_response_sensitive(dialog, GTK_RESPONSE_OK, !busy);
+    gtk_dialog_set_response_sensitive(dialog, GTK_RESPONSE_APPLY, !busy);
+    gtk_dialog_set_response_sensitive(dialog, GTK_RESPONSE_HELP, !busy);
+}
+
+static void
+capplet_dialog_commit_progress(NwamuiObject *object,
+  nwamui_commit_stage_t stage,
+  guint n,
+  guint total,
+  gpointer user_data)
+{
+    CappletDialogCommit *data = (CappletDialogCommit *)user_data;
+    gchar               *text;
+    gdouble              fraction;
+
+    fraction = (gdouble)n / total / 2;
+    if (stage == NWAMUI_COMMIT_VALIDATED) {
+        text = g_strdup_printf(_("Validating %s"), nwamui_object_get_name(object));
+    } else {
+        text = g_strdup_printf(_("Saving %s"), nwamui_object_get_name(object));
+        fraction += 0.5;
+    }
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(data->progress), text);
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(data->progress), fraction);
+    g_free(text);
+}
+
+static void
+capplet_dialog_commit_done(gboolean success,
+  gboolean cancelled,
+  NwamuiObject *failed,
+  nwamui_commit_stage_t failed_stage,
+  const gchar *prop_name,
+  gpointer user_data)
+{
+    CappletDialogCommit *data = (CappletDialogCommit *)user_data;
+
+    gtk_widget_destroy(data->progress);
+    capplet_dialog_commit_set_busy(data->dialog, FALSE);
+    g_object_set_data(G_OBJECT(data->dialog), CAPPLET_DIALOG_COMMIT_KEY, NULL);
+
+    if (data->done) {
+        data->done(data->dialog, success, cancelled, failed, failed_stage,
+          prop_name, data->user_data);
+    }
+    g_object_unref(data->dialog);
+    g_free(data);
+}
+
+/**
+ * capplet_dialog_commit_async:
+ *
+ * Validate and commit @objects in the background. Meanwhile @dialog shows
+ * the progress in its action area and only its Cancel button is sensitive,
+ * @done is called after the dialog is restored.
+ **/
+void
+capplet_dialog_commit_async(GtkDialog *dialog,
+  GList *objects,
+  capplet_dialog_commit_done_func_t done,
+  gpointer user_data)
+{
+    CappletDialogCommit *data;
+
+    g_return_if_fail(!capplet_dialog_commit_busy(dialog));
+
+    data = g_new0(CappletDialogCommit, 1);
+    data->dialog = g_object_ref(dialog);
+    data->done = done;
+    data->user_data = user_data;
+
+    data->progress = gtk_progress_bar_new();
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(data->progress), _("Validating..."));
+    gtk_box_pack_start(GTK_BOX(dialog->action_area), data->progress, TRUE, TRUE, 0);
+    gtk_box_reorder_child(GTK_BOX(dialog->action_area), data->progress, 0);
+    gtk_widget_show(data->progress);
+
+    capplet_dialog_commit_set_busy(dialog, TRUE);
+    g_object_set_data(G_OBJECT(dialog), CAPPLET_DIALOG_COMMIT_KEY, data);
+
+    data->job_id = nwamui_commit_async(objects,
+      capplet_dialog_commit_progress,
+      capplet_dialog_commit_done,
+      (gpointer)data);
+}
+
+gboolean
+capplet_dialog_commit_busy(GtkDialog *dialog)
+{
+    return g_object_get_data(G_OBJECT(dialog), CAPPLET_DIALOG_COMMIT_KEY) != NULL;
+}
+
+/**
+ * capplet_dialog_commit_cancel:
+ *
+ * Returns: TRUE if a commit was running, its done function reports the
+ * outcome.
+ **/
+gboolean
+capplet_dialog_commit_cancel(GtkDialog *dialog)
+{
+    CappletDialogCommit *data;
+
+    data = g_object_get_data(G_OBJECT(dialog), CAPPLET_DIALOG_COMMIT_KEY);
+    if (data == NULL) {
+        return FALSE;
+    }
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(data->progress), _("Cancelling..."));
+    return nwamui_commit_cancel(data->job_id);
+}
+
 void
 nwamui_object_name_cell_edited ( GtkCellRendererText *cell,
                      const gchar         *path_string,
@@ -38,6 +38,22 @@
 void capplet_remove_gtk_dialog_escape_binding(GtkDialogClass *dialog_class);
 gboolean capplet_dialog_raise(NwamPrefIFace *iface);
 
+/* Background validate/commit of a dialog's objects, see nwamui_commit_async. */
+typedef void (*capplet_dialog_commit_done_func_t)(GtkDialog *dialog,
+  gboolean success,
+  gboolean cancelled,
+  NwamuiObject *failed,
+  nwamui_commit_stage_t failed_stage,
+  const gchar *prop_name,
+  gpointer user_data);
+
+void capplet_dialog_commit_async(GtkDialog *dialog,
+  GList *objects,
+  capplet_dialog_commit_done_func_t done,
+  gpointer user_data);
+gboolean capplet_dialog_commit_busy(GtkDialog *dialog);
+gboolean capplet_dialog_commit_cancel(GtkDialog *dialog);
+
 #define CAPPLET_COMPOSE_NWAMUI_OBJECT_LIST_VIEW(treeview)               \
     {                                                                   \
         GtkTreeModel *model;                                            \
@@ -58,7 +58,10 @@ static gboolean     loc_pref_dialog = FALSE;
 static gboolean     show_all_widgets = FALSE;
 #endif /* DEBUG_OPTS */
 
+static GTimer      *startup_timer = NULL;
+
 static void debug_response_id( gint responseid );
+static void debug_startup_time( NwamPrefIFace *dialog );
 
 
 GOptionEntry application_options[] = {
@@ -156,6 +159,9 @@ main(int argc, char** argv)
 
     /* Initialise Thread Support */
     g_thread_init( NULL );
+
+    /* Startup timing, reported in debug mode */
+    startup_timer = g_timer_new();
     
     /* Setup log handler to trap debug messages */
     nwamui_util_default_log_handler_init();
@@ -221,7 +227,8 @@ main(int argc, char** argv)
 
     if( vpn_pref_dialog ) {
         capplet_dialog = NWAM_PREF_IFACE(nwam_vpn_pref_dialog_new());
-        
+        debug_startup_time( capplet_dialog );
+
         add_unique_message_handler( app, capplet_dialog );
 
         gint responseid = nwam_pref_dialog_run(capplet_dialog, NULL);
@@ -230,6 +237,7 @@ main(int argc, char** argv)
     }
     else if( wireless_chooser ) {
         capplet_dialog = NWAM_PREF_IFACE(nwam_wireless_chooser_new());
+        debug_startup_time( capplet_dialog );
 
         add_unique_message_handler( app, capplet_dialog );
 
@@ -239,7 +247,8 @@ main(int argc, char** argv)
     }
     else if( location_dialog ) {
         capplet_dialog = NWAM_PREF_IFACE(nwam_location_dialog_new());
-        
+        debug_startup_time( capplet_dialog );
+
         add_unique_message_handler( app, capplet_dialog );
 
         gint responseid = nwam_pref_dialog_run(capplet_dialog, NULL);
@@ -300,6 +309,7 @@ main(int argc, char** argv)
         if (net_pref_view) {
             nwam_capplet_dialog_select_tab(NWAM_CAPPLET_DIALOG(capplet_dialog), PANEL_PROF_PREF, TRUE);
         }
+        debug_startup_time( capplet_dialog );
         add_unique_message_handler( app, capplet_dialog );
 
         gint responseid = nwam_pref_dialog_run(capplet_dialog, NULL);
@@ -316,6 +326,35 @@ main(int argc, char** argv)
     return (EXIT_SUCCESS);
 }
 
+static gboolean
+first_paint_cb( GtkWidget *widget, GdkEventExpose *event, gpointer data )
+{
+    g_debug("Startup to first paint: %.3f s", g_timer_elapsed(startup_timer, NULL));
+
+    g_signal_handlers_disconnect_by_func(widget, (gpointer)first_paint_cb, data);
+    return FALSE;
+}
+
+/*
+ * In debug mode, report how long it took from start up until the dialog was
+ * constructed and until it was first painted.
+ */
+static void
+debug_startup_time( NwamPrefIFace *dialog )
+{
+    GtkWindow  *window;
+
+    if ( !nwamui_util_is_debug_mode() ) {
+        return;
+    }
+
+    g_debug("Startup to dialog constructed: %.3f s", g_timer_elapsed(startup_timer, NULL));
+
+    if ( (window = nwam_pref_dialog_get_window(dialog)) != NULL ) {
+        g_signal_connect_after(window, "expose-event", G_CALLBACK(first_paint_cb), NULL);
+    }
+}
+
 static void debug_response_id( gint responseid ) 
 {
     g_debug("Dialog returned response : %d ", responseid );
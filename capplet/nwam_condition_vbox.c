@@ -709,25 +709,6 @@ table_condition_add_row( gpointer data, gpointer user_data )
       prv->table_line_num, cond); 
 }
 
-static void
-table_models_refresh( void )
-{
-    NwamuiDaemon   *daemon = nwamui_daemon_get_instance();
-    GtkTreeModel   *model;
-
-    /* NCP */
-    model = table_get_condition_ncp_list_model ();
-    capplet_update_model_from_daemon(model, daemon, NWAMUI_TYPE_NCP);
-
-    /* LOC */
-    model = table_get_condition_loc_list_model ();
-    capplet_update_model_from_daemon(model, daemon, NWAMUI_TYPE_ENV);
-
-    /* ENM */
-    model = table_get_condition_enm_list_model ();
-    capplet_update_model_from_daemon(model, daemon, NWAMUI_TYPE_ENM);
-}
-
 static void
 table_lines_init (NwamConditionVBox *self, NwamuiObject *object)
 {
@@ -740,9 +721,6 @@ table_lines_init (NwamConditionVBox *self, NwamuiObject *object)
                            (GtkCallback)table_line_cache_all_cb,
                            (gpointer)self);
 
-    /* Reload models for values */
-    table_models_refresh();
-
     if ( object ) {
         GList*  condition_list = nwamui_object_get_conditions( object );
 
@@ -838,7 +816,10 @@ table_get_condition_ncp_list_model ()
     static GtkTreeModel    *model = NULL;
 
     if ( model == NULL ) {
-        model = GTK_TREE_MODEL(gtk_list_store_new(1, NWAMUI_TYPE_NCP, -1 ));
+        NwamuiDaemon   *daemon = nwamui_daemon_get_instance();
+
+        model = nwamui_object_list_model_new(NWAMUI_OBJECT(daemon), NWAMUI_TYPE_NCP);
+        g_object_unref(daemon);
     }
 
     return (model);
@@ -859,7 +840,10 @@ table_get_condition_loc_list_model ()
     static GtkTreeModel    *model = NULL;
 
     if ( model == NULL ) {
-        model = GTK_TREE_MODEL(gtk_list_store_new(1, NWAMUI_TYPE_ENV, -1 ));
+        NwamuiDaemon   *daemon = nwamui_daemon_get_instance();
+
+        model = nwamui_object_list_model_new(NWAMUI_OBJECT(daemon), NWAMUI_TYPE_ENV);
+        g_object_unref(daemon);
     }
 
     return (model);
@@ -871,7 +855,10 @@ table_get_condition_enm_list_model ()
     static GtkTreeModel    *model = NULL;
 
     if ( model == NULL ) {
-        model = GTK_TREE_MODEL(gtk_list_store_new(1, NWAMUI_TYPE_ENM, -1 ));
+        NwamuiDaemon   *daemon = nwamui_daemon_get_instance();
+
+        model = nwamui_object_list_model_new(NWAMUI_OBJECT(daemon), NWAMUI_TYPE_ENM);
+        g_object_unref(daemon);
     }
 
     return (model);
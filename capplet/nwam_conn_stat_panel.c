@@ -295,14 +295,7 @@ nwam_conn_status_panel_init(NwamConnStatusPanel *self)
                      (GCallback)nwam_conn_status_conn_view_row_activated_cb,
                      (gpointer)self);
 
-    /* Initially refresh self */
-    {
-        NwamuiObject *ncp = nwamui_daemon_get_active_ncp(prv->daemon);
-        if (ncp) {
-            nwam_pref_refresh(NWAM_PREF_IFACE(self), ncp, TRUE);
-            g_object_unref(ncp);
-        }
-    }
+    /* Populated by the first refresh, when its page is shown. */
 }
 
 /**
@@ -450,15 +443,7 @@ nwam_conn_status_update_status_cell_cb (GtkTreeViewColumn *col,
     gint                            cell_num = (gint)data;  /* Number of cell in column */
 	gchar                          *stockid = NULL;
     NwamuiNcu*                      ncu = NULL;
-    nwamui_ncu_type_t               ncu_type;
     gchar*                          ncu_text = NULL;
-    gchar*                          ncu_markup = NULL;
-    gboolean                        ncu_status;
-    gboolean                        ncu_is_dhcp;
-    gchar*                          ncu_ipv4_addr = NULL;
-    GdkPixbuf                      *status_icon;
-    gchar*                          info_string = NULL;
-    nwamui_wifi_signal_strength_t   strength = NWAMUI_WIFI_STRENGTH_NONE;
     gint                            icon_size, dummy;
 
     if ( !gtk_icon_size_lookup(GTK_ICON_SIZE_LARGE_TOOLBAR, &icon_size, &dummy) ) {
@@ -467,38 +452,12 @@ nwam_conn_status_update_status_cell_cb (GtkTreeViewColumn *col,
 
 	gtk_tree_model_get(model, iter, 0, &ncu, -1);
 
-    ncu_type = nwamui_ncu_get_ncu_type(ncu);
-
-    /* Get REAL interface status rather than what NWAM says */
-    switch( nwamui_ncu_get_connection_state( ncu ) ) {
-        case NWAMUI_STATE_CONNECTED:
-        case NWAMUI_STATE_CONNECTED_ESSID: 
-            ncu_status = TRUE;
-            break;
-        default:
-            ncu_status = FALSE;
-            break;
-    }
-        
+    /* Display strings and icon are cached by the NCU until it changes. */
 	switch (gtk_tree_view_column_get_sort_column_id (col)) {
 	case CONNVIEW_ICON:
-        if( cell_num == 0 && ncu_type != NWAMUI_NCU_TYPE_WIRELESS ) {
-            status_icon = nwamui_util_get_network_status_icon(ncu_type, strength, 
-                    ncu_status?NWAMUI_DAEMON_STATUS_ALL_OK : NWAMUI_DAEMON_STATUS_ERROR,
-                    icon_size);
-
-            g_object_set (G_OBJECT(renderer),
-              "pixbuf", status_icon,
-              NULL);
-        }
-        else if( cell_num == 0 && ncu_type == NWAMUI_NCU_TYPE_WIRELESS ) {
-            strength = nwamui_ncu_get_signal_strength_from_dladm( ncu );
-            status_icon = nwamui_util_get_network_status_icon(ncu_type, strength, 
-                    ncu_status?NWAMUI_DAEMON_STATUS_ALL_OK : NWAMUI_DAEMON_STATUS_ERROR,
-                    icon_size);
-
+        if( cell_num == 0 ) {
             g_object_set (G_OBJECT(renderer),
-              "pixbuf", status_icon,
+              "pixbuf", nwamui_ncu_get_cached_status_icon(ncu, icon_size),
               NULL);
         }
         else {
@@ -511,21 +470,9 @@ nwam_conn_status_update_status_cell_cb (GtkTreeViewColumn *col,
 		break;
                 
 	case CONNVIEW_INFO: 
-        ncu_is_dhcp = nwamui_ncu_get_ipv4_has_dhcp(ncu);
-        ncu_ipv4_addr = nwamui_ncu_get_ipv4_address(ncu);
-        info_string = nwamui_ncu_get_connection_state_detail_string( ncu, TRUE );
-        
-        ncu_markup= g_strdup_printf(_("<b>%s</b>\n<small>%s</small>"), nwamui_ncu_get_display_name(ncu), info_string );
-        g_free (info_string);
-        
 		g_object_set (G_OBJECT(renderer),
-			"markup", ncu_markup,
+			"markup", nwamui_ncu_get_cached_state_markup(ncu),
 			NULL);
-
-        if ( ncu_ipv4_addr != NULL )
-            g_free( ncu_ipv4_addr );
-        
-        g_free( ncu_markup );
 		break;
                 
     case CONNVIEW_STATUS:
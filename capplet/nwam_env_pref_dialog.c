@@ -220,6 +220,7 @@ struct _NwamEnvPrefDialogPrivate {
     GtkButton*                  delete_enabled_netservice_btn;
     GtkButton*                  add_disabled_netservice_btn;
     GtkButton*                  delete_disabled_netservice_btn;
+    gulong                      smf_cache_hook_id;
 #endif /* ENABLE_NETSERVICES */
 
     GtkCheckButton*             ippool_config_cb;
@@ -243,6 +244,7 @@ struct _NwamEnvPrefDialogPrivate {
     /* Other Data */
     NwamuiDaemon*               daemon;
     NwamuiEnv*                  selected_env;
+    gint                        pending_response; /* While committing */
 };
 
 static void nwam_pref_init (gpointer g_iface, gpointer iface_data);
@@ -264,10 +266,13 @@ static void nwam_compose_tree_view (NwamEnvPrefDialog *self);
 #endif /* ENABLE_NETSERVICES */
 
 static void response_cb( GtkWidget* widget, gint repsonseid, gpointer data );
+static void apply_async(NwamEnvPrefDialog *self, gint responseid);
 
 static void fmri_dialog_response_cb( GtkWidget* widget, gint repsonseid, gpointer data );
 
-static void get_smf_service_name(const char *fmri, gchar **name_out, gboolean *valid_fmri );
+#ifdef ENABLE_NETSERVICES
+static void smf_cache_refreshed(gpointer user_data);
+#endif /* ENABLE_NETSERVICES */
 
 #if 0
 static void action_menu_group_set_visible(NwamMenuGroup *menugroup, const gchar *name, gboolean visible);
@@ -450,6 +455,9 @@ nwam_env_pref_dialog_init (NwamEnvPrefDialog *self)
     prv->delete_enabled_netservice_btn = GTK_BUTTON(nwamui_util_glade_get_widget( DELETE_ENABLED_NETSERVICE_BTN ));
     prv->add_disabled_netservice_btn = GTK_BUTTON(nwamui_util_glade_get_widget( ADD_DISABLED_NETSERVICE_BTN ));
     prv->delete_disabled_netservice_btn = GTK_BUTTON(nwamui_util_glade_get_widget( DELETE_DISABLED_NETSERVICE_BTN ));
+
+    /* Service names are filled in as the SMF cache learns about them. */
+    prv->smf_cache_hook_id = nwamui_smf_cache_add_hook(smf_cache_refreshed, (gpointer)self);
 #endif /* ENABLE_NETSERVICES */
 
     /* Security Page */
@@ -469,6 +477,7 @@ nwam_env_pref_dialog_init (NwamEnvPrefDialog *self)
 
     /* Other useful pointer */
     prv->selected_env = NULL;
+    prv->pending_response = GTK_RESPONSE_NONE;
     prv->daemon = NWAMUI_DAEMON(nwamui_daemon_get_instance());
 #ifdef ENABLE_PROXY
     prv->proxy_password_dialog = NULL;
@@ -612,6 +621,10 @@ nwam_env_pref_dialog_finalize (NwamEnvPrefDialog *self)
     }
 #endif /* ENABLE_PROXY */
 
+#ifdef ENABLE_NETSERVICES
+    nwamui_smf_cache_remove_hook(self->prv->smf_cache_hook_id);
+#endif /* ENABLE_NETSERVICES */
+
     g_object_unref(G_OBJECT(self->prv->env_pref_dialog ));
 
     g_object_unref(G_OBJECT(self->prv->daemon));
@@ -1821,6 +1834,17 @@ svc_button_clicked(GtkButton *button, gpointer  user_data)
 }
 #endif /* ENABLE_NETSERVICES */
 
+#ifdef ENABLE_NETSERVICES
+static void
+smf_cache_refreshed(gpointer user_data)
+{
+	NwamEnvPrefDialogPrivate *prv = GET_PRIVATE(user_data);
+
+    gtk_widget_queue_draw(GTK_WIDGET(prv->enabled_netservices_list));
+    gtk_widget_queue_draw(GTK_WIDGET(prv->disabled_netservices_list));
+}
+#endif /* ENABLE_NETSERVICES */
+
 static void
 default_svc_status_cb (GtkTreeViewColumn *tree_column,
                        GtkCellRenderer *cell,
@@ -1841,10 +1865,12 @@ default_svc_status_cb (GtkTreeViewColumn *tree_column,
     case SVC_INFO:
     {
         gchar *info;
-        gchar *name;
+        gchar *name = NULL;
         gchar *fmri;
 
-        get_smf_service_name(svc, &name, NULL );
+        /* Don't block rendering on SMF, the row is redrawn once the
+         * cache is filled. */
+        nwamui_smf_cache_lookup(svc, FALSE, NULL, &name, NULL);
 
         fmri = g_strstr_len(svc, sizeof("svc:/"), "/");
 
@@ -1968,16 +1994,29 @@ response_cb( GtkWidget* widget, gint responseid, gpointer data )
         break;
     case GTK_RESPONSE_APPLY:
     case GTK_RESPONSE_OK:
-        if (nwam_pref_apply (NWAM_PREF_IFACE(data), NULL)) {
-
-            if (responseid == GTK_RESPONSE_OK) {
-                gtk_widget_hide( GTK_WIDGET(self->prv->env_pref_dialog) );
-            }
+        if (!capplet_dialog_commit_busy(self->prv->env_pref_dialog)) {
+            apply_async(self, responseid);
+        }
+        stop_emission = TRUE;
+        break;
+    case GTK_RESPONSE_DELETE_EVENT:
+        g_debug("GTK_RESPONSE_DELETE_EVENT");
+        /* Closing the window mid-commit is a Cancel. */
+        if (capplet_dialog_commit_busy(self->prv->env_pref_dialog)) {
+            self->prv->pending_response = GTK_RESPONSE_CANCEL;
+            capplet_dialog_commit_cancel(self->prv->env_pref_dialog);
             stop_emission = TRUE;
         }
         break;
     case GTK_RESPONSE_CANCEL:
         g_debug("GTK_RESPONSE_CANCEL");
+        if (capplet_dialog_commit_busy(self->prv->env_pref_dialog)) {
+            /* apply_done() cleans up once the worker stops. */
+            self->prv->pending_response = GTK_RESPONSE_CANCEL;
+            capplet_dialog_commit_cancel(self->prv->env_pref_dialog);
+            stop_emission = TRUE;
+            break;
+        }
         nwam_pref_cancel (NWAM_PREF_IFACE(data), NULL);
         gtk_widget_hide( GTK_WIDGET(self->prv->env_pref_dialog) );
         stop_emission = TRUE;
@@ -2046,21 +2085,15 @@ cancel(NwamPrefIFace *iface, gpointer user_data)
 
     return TRUE;
 }
+
+/*
+ * Copy the panels into current_env, checking the entries on the way.
+ */
 static gboolean
-apply(NwamPrefIFace *iface, gpointer user_data)
+update_env_from_panels(NwamEnvPrefDialog *self, NwamuiEnv *current_env)
 {
-	NwamEnvPrefDialogPrivate *prv = GET_PRIVATE(iface);
-    NwamEnvPrefDialog* self = NWAM_ENV_PREF_DIALOG(iface);
-    NwamuiEnv *current_env;
-    gchar     *prop_name = NULL;
-
-    g_debug("NwamEnvPrefDialog apply");
+	NwamEnvPrefDialogPrivate *prv = GET_PRIVATE(self);
 
-    if (!prv->selected_env)
-        return TRUE;
-    else
-        current_env = prv->selected_env;
-    
     /*
      * Name Services Tab
      */
@@ -2226,28 +2259,112 @@ apply(NwamPrefIFace *iface, gpointer user_data)
     }
 #endif /* ENABLE_NETSERVICES */
 
-    if (nwamui_object_validate(NWAMUI_OBJECT(prv->selected_env), &prop_name)) {
-        if (!nwamui_object_commit (NWAMUI_OBJECT (prv->selected_env))) {
-            gchar *msg = g_strdup_printf (_("Committing %s failed..."), nwamui_object_get_name (NWAMUI_OBJECT (prv->selected_env)));
-            nwamui_util_show_message (GTK_WINDOW(prv->env_pref_dialog),
-              GTK_MESSAGE_ERROR,
-              _("Commit Location Error"),
-              msg, TRUE);
-            g_free (msg);
-            return FALSE;
-        }
-    }
-    else {
-        gchar *msg = g_strdup_printf (_("Validation of %s failed with the property %s"), nwamui_object_get_name (NWAMUI_OBJECT (prv->selected_env)), prop_name);
+    return TRUE;
+}
+
+static void
+show_commit_error(NwamEnvPrefDialog *self, nwamui_commit_stage_t failed_stage, const gchar *prop_name)
+{
+	NwamEnvPrefDialogPrivate *prv = GET_PRIVATE(self);
+    gchar *msg;
 
+    if (failed_stage == NWAMUI_COMMIT_COMMITTED) {
+        msg = g_strdup_printf (_("Committing %s failed..."), nwamui_object_get_name (NWAMUI_OBJECT (prv->selected_env)));
+        nwamui_util_show_message (GTK_WINDOW(prv->env_pref_dialog),
+          GTK_MESSAGE_ERROR,
+          _("Commit Location Error"),
+          msg, TRUE);
+    } else {
+        msg = g_strdup_printf (_("Validation of %s failed with the property %s"), nwamui_object_get_name (NWAMUI_OBJECT (prv->selected_env)), prop_name);
         nwamui_util_show_message (GTK_WINDOW(prv->env_pref_dialog),
           GTK_MESSAGE_ERROR,
           _("Validation error"),
           msg, TRUE);
-        g_free (msg);
+    }
+    g_free (msg);
+}
+
+static void
+apply_done(GtkDialog *dialog,
+  gboolean success,
+  gboolean cancelled,
+  NwamuiObject *failed,
+  nwamui_commit_stage_t failed_stage,
+  const gchar *prop_name,
+  gpointer user_data)
+{
+    NwamEnvPrefDialog        *self = NWAM_ENV_PREF_DIALOG(user_data);
+	NwamEnvPrefDialogPrivate *prv  = GET_PRIVATE(self);
+    gint                      responseid = prv->pending_response;
+
+    prv->pending_response = GTK_RESPONSE_NONE;
+
+    if (success) {
+        /* Everything is committed, even if Cancel came too late. */
+        if (responseid == GTK_RESPONSE_OK || responseid == GTK_RESPONSE_CANCEL) {
+            gtk_widget_hide( GTK_WIDGET(dialog) );
+        }
+    } else if (responseid == GTK_RESPONSE_CANCEL) {
+        /* Whatever was committed stays, drop the rest. */
+        nwam_pref_cancel (NWAM_PREF_IFACE(self), NULL);
+        gtk_widget_hide( GTK_WIDGET(dialog) );
+    } else if (!cancelled) {
+        show_commit_error(self, failed_stage, prop_name);
+    }
+}
+
+/*
+ * Like apply(), but validate and commit on a worker, apply_done() finishes
+ * the response.
+ */
+static void
+apply_async(NwamEnvPrefDialog *self, gint responseid)
+{
+	NwamEnvPrefDialogPrivate *prv = GET_PRIVATE(self);
+    GList                    *objects;
+
+    if (!prv->selected_env) {
+        if (responseid == GTK_RESPONSE_OK) {
+            gtk_widget_hide( GTK_WIDGET(prv->env_pref_dialog) );
+        }
+        return;
+    }
+
+    if (!update_env_from_panels(self, prv->selected_env)) {
+        return;
+    }
+
+    prv->pending_response = responseid;
+    objects = g_list_prepend(NULL, prv->selected_env);
+    capplet_dialog_commit_async(prv->env_pref_dialog, objects, apply_done, (gpointer)self);
+    g_list_free(objects);
+}
+
+static gboolean
+apply(NwamPrefIFace *iface, gpointer user_data)
+{
+	NwamEnvPrefDialogPrivate *prv = GET_PRIVATE(iface);
+    NwamEnvPrefDialog* self = NWAM_ENV_PREF_DIALOG(iface);
+    gchar     *prop_name = NULL;
+
+    g_debug("NwamEnvPrefDialog apply");
+
+    if (!prv->selected_env)
+        return TRUE;
+
+    if (!update_env_from_panels(self, prv->selected_env)) {
+        return FALSE;
+    }
+
+    if (!nwamui_object_validate(NWAMUI_OBJECT(prv->selected_env), &prop_name)) {
+        show_commit_error(self, NWAMUI_COMMIT_VALIDATED, prop_name);
         g_free (prop_name);
         return( FALSE );
     }
+    if (!nwamui_object_commit (NWAMUI_OBJECT (prv->selected_env))) {
+        show_commit_error(self, NWAMUI_COMMIT_COMMITTED, NULL);
+        return FALSE;
+    }
     return TRUE;
 }
 
@@ -2319,134 +2436,6 @@ svc_list_merge_to_model(gpointer data, gpointer user_data)
 	g_free(data);
 }
 
-static void
-get_smf_service_name(const char *fmri, gchar **name_out, gboolean* valid_fmri )
-{
-    static scf_handle_t        *handle = NULL;
-	ssize_t         max_scf_name_length = scf_limit(SCF_LIMIT_MAX_NAME_LENGTH);
-    scf_service_t *service;
-    scf_instance_t *instance;
-    scf_propertygroup_t    *pg;
-    scf_property_t *prop;
-    scf_value_t    *value;
-    char           *name;
-    char           *cname;
-    char           *desc;
-
-    if ( fmri == NULL ) {
-        return;
-    }
-
-    if ( name_out != NULL ) {
-        *name_out = NULL;
-    }
-
-    if ( valid_fmri != NULL ) {
-        *valid_fmri = FALSE;
-    }
-
-    if ( handle == NULL ) {
-        handle = scf_handle_create(SCF_VERSION);
-
-        if (scf_handle_bind(handle) == -1 ) {
-            g_error("couldn't bind to smf service: %s", scf_strerror(scf_error()) );
-            return;
-        }
-    }
-
-    service = scf_service_create( handle );
-    instance = scf_instance_create( handle );
-
-    if ( scf_handle_decode_fmri( handle, fmri , NULL, service, instance, NULL, NULL,
-        SCF_DECODE_FMRI_REQUIRE_INSTANCE ) < 0 ) {
-        g_debug("Problem decoding the fmri '%s' at line %d : %s", fmri, __LINE__, scf_strerror(scf_error()));
-        scf_service_destroy( service );
-        scf_instance_destroy( instance );
-        return;
-    }
-
-    /* Got this far, so FMRI is valid */
-    if ( valid_fmri != NULL ) {
-        *valid_fmri = TRUE;
-    }
-
-    if ( name_out == NULL ) {
-        /* May as well return now since we don't have anything to do if
-         * name_out is NULL
-         */
-        return;
-    }
-
-    pg = scf_pg_create( handle );
-    prop = scf_property_create( handle );
-    value = scf_value_create( handle );
-    name = g_malloc( max_scf_name_length + 1 );
-    cname = g_malloc( max_scf_name_length + 1 );
-    desc = g_malloc( max_scf_name_length + 1 );
-
-    /* Check for the instance name first */
-    if ( scf_instance_get_pg( instance, SCF_PG_TM_COMMON_NAME, pg) != -1 ) {
-        if ( scf_pg_get_property(pg, "C", prop ) != -1 ) {
-            if ( scf_property_get_value(prop, value ) != -1 ) {
-                if ( scf_value_get_ustring(value, cname, max_scf_name_length + 1 ) != -1 ) {
-                    g_debug("INSTANCE COMMON NAME : '%s'", cname );
-                    if ( name_out != NULL ) {
-                        *name_out = g_strdup(cname);
-                    }
-                }
-            }
-        }
-    }
-
-    /* Check the service name, if the instance name wasn't set */
-    if ( *name_out != NULL ) {
-        if ( scf_service_get_pg( service, SCF_PG_TM_COMMON_NAME, pg) != -1) {
-            if ( scf_pg_get_property(pg, "C", prop ) != -1 ) {
-                if ( scf_property_get_value(prop, value ) != -1 ) {
-                    if ( scf_value_get_ustring(value, cname, max_scf_name_length + 1 ) != -1 ) {
-                        g_debug("SERVICE COMMON NAME : '%s'", cname );
-                        *name_out = g_strdup(cname);
-                    }
-                }
-            }
-        }
-    }
-
-#if 0
-    /* Right now we don't need to get the description, but just in case we
-     * need it in the future, we'll keep the code here.
-     */
-    if ( scf_service_get_pg( service, SCF_PG_TM_DESCRIPTION, pg) != -1 ) {
-        if ( scf_pg_get_property(pg, "C", prop ) != -1 ) {
-            if ( scf_property_get_value(prop, value ) != -1 ) {
-                if ( scf_value_get_ustring(value, desc, max_scf_name_length + 1 ) != -1 ) {
-                    g_debug("SERVICE DESCRIPTION : '%s'", desc );
-                }
-            }
-        }
-    }
-
-    if ( scf_instance_get_pg( instance, SCF_PG_TM_DESCRIPTION, pg) != -1 ) {
-        if ( scf_pg_get_property(pg, "C", prop ) != -1 ) {
-            if ( scf_property_get_value(prop, value ) != -1 ) {
-                if ( scf_value_get_ustring(value, desc, max_scf_name_length + 1 ) != -1 ) {
-                    g_debug("INSTANCE DESCRIPTION : '%s'", desc );
-                }
-            }
-        }
-    }
-#endif
-
-/*     scf_handle_destroy( handle ); */
-    scf_pg_destroy( pg );
-    scf_property_destroy( prop );
-    scf_value_destroy( value );
-
-    g_free(name);
-    g_free(cname);
-    g_free(desc);
-}
-
 static void
 fmri_dialog_response_cb( GtkWidget* widget, gint repsonseid, gpointer data )
 {
@@ -2461,14 +2450,13 @@ fmri_dialog_response_cb( GtkWidget* widget, gint repsonseid, gpointer data )
     case GTK_RESPONSE_APPLY:
     case GTK_RESPONSE_OK: {
         const gchar *svc;
-        gchar *svc_name;
 
         svc = gtk_entry_get_text(prv->smf_fmri_entry);
 
         if (svc) {
             gboolean valid_fmri = FALSE;
 
-            get_smf_service_name(svc, &svc_name, &valid_fmri );
+            nwamui_smf_cache_lookup(svc, TRUE, &valid_fmri, NULL, NULL);
 
             /* Only fail if the FMRI isn't parseable, rather than based on
              * whether the name is valid, since some services don't set a
@@ -2476,7 +2464,6 @@ fmri_dialog_response_cb( GtkWidget* widget, gint repsonseid, gpointer data )
              */
             if (valid_fmri) {
                 gtk_widget_hide(widget);
-                g_free(svc_name);
                 break;
             }
         }
@@ -54,8 +54,10 @@ struct _NwamCappletDialogPrivate {
 	GtkComboBox*                show_combo;
 	GtkNotebook*                main_nb;
 
-    /* Panel Objects */
+    /* Panel Objects, created and populated on first use */
 	NwamPrefIFace* panel[N_PANELS];
+    gboolean       panel_populated[N_PANELS];
+    guint          prewarm_id;
                 
     /* Other Data */
     NwamuiObject*               active_ncp; /* currently active NCP */
@@ -74,6 +76,10 @@ static GtkWindow* dialog_get_window(NwamPrefIFace *iface);
 
 static void nwam_capplet_dialog_finalize(NwamCappletDialog *self);
 
+static NwamPrefIFace* get_panel(NwamCappletDialog *self, gint idx);
+static gboolean panel_refresh(NwamCappletDialog *self, gint idx, gpointer user_data, gboolean force);
+static gboolean panel_prewarm(gpointer data);
+
 /* Callbacks */
 static void show_combo_cell_cb (GtkCellLayout *cell_layout,
   GtkCellRenderer   *renderer,
@@ -155,10 +161,12 @@ nwam_capplet_dialog_init(NwamCappletDialog *self)
     /* Set title to include hostname */
     nwamui_util_window_title_append_hostname( prv->capplet_dialog );
 
-    /* Construct the Notebook Panels Handling objects. */
-    prv->panel[PANEL_CONN_STATUS] = NWAM_PREF_IFACE(nwam_conn_status_panel_new(self));
-    prv->panel[PANEL_PROF_PREF] = NWAM_PREF_IFACE(nwam_profile_panel_new(self));
-    prv->panel[PANEL_CONF_IP] = NWAM_PREF_IFACE(nwam_conf_ip_panel_new(self));
+    /* Construct the Notebook Panels Handling objects. The show combo
+     * entries are the panels themselves, so these two are needed now. They
+     * are populated when their page is first shown.
+     */
+    get_panel(self, PANEL_CONN_STATUS);
+    get_panel(self, PANEL_PROF_PREF);
 
     /* Change Model */
 	capplet_compose_combo(prv->show_combo,
@@ -193,11 +201,14 @@ nwam_capplet_dialog_init(NwamCappletDialog *self)
     /* Sync nwam_capplet_dialog_set_ok_sensitive_by_voting count. */
     gtk_dialog_set_response_sensitive(prv->capplet_dialog, GTK_RESPONSE_OK, TRUE);
 
-    /* default select "Connection Status" */
+    /* Initial, add the NCPs and their NCUs. */
+    nwamui_daemon_foreach_ncp(daemon, foreach_ncp_add_to_combo, (gpointer)self);
+
+    /* default select "Connection Status", this populates its page. */
     gtk_combo_box_set_active (GTK_COMBO_BOX(prv->show_combo), 0);
 
-    /* Initial */
-    refresh(NWAM_PREF_IFACE(self), NULL, TRUE);
+    /* Populate the other pages once the dialog is up. */
+    prv->prewarm_id = g_idle_add_full(G_PRIORITY_LOW, panel_prewarm, (gpointer)self, NULL);
 
     g_object_unref( daemon );
     daemon = NULL;
@@ -263,6 +274,10 @@ nwam_capplet_dialog_finalize(NwamCappletDialog *self)
     NwamCappletDialogPrivate *prv = NWAM_CAPPLET_DIALOG_GET_PRIVATE(self);
     int i;
 
+    if (prv->prewarm_id) {
+        g_source_remove(prv->prewarm_id);
+    }
+
     g_object_unref(G_OBJECT(prv->capplet_dialog));
     g_object_unref(G_OBJECT(prv->show_combo));
     g_object_unref(G_OBJECT(prv->main_nb));
@@ -278,6 +293,87 @@ nwam_capplet_dialog_finalize(NwamCappletDialog *self)
 	G_OBJECT_CLASS(nwam_capplet_dialog_parent_class)->finalize(G_OBJECT(self));
 }
 
+static NwamPrefIFace*
+get_panel(NwamCappletDialog *self, gint idx)
+{
+    NwamCappletDialogPrivate *prv = NWAM_CAPPLET_DIALOG_GET_PRIVATE(self);
+
+    g_return_val_if_fail(idx >= 0 && idx < N_PANELS, NULL);
+
+    if (prv->panel[idx] == NULL) {
+        switch (idx) {
+        case PANEL_CONN_STATUS:
+            prv->panel[idx] = NWAM_PREF_IFACE(nwam_conn_status_panel_new(self));
+            break;
+        case PANEL_PROF_PREF:
+            prv->panel[idx] = NWAM_PREF_IFACE(nwam_profile_panel_new(self));
+            break;
+        case PANEL_CONF_IP:
+            prv->panel[idx] = NWAM_PREF_IFACE(nwam_conf_ip_panel_new(self));
+            break;
+        default:
+            g_assert_not_reached();
+        }
+    }
+    return prv->panel[idx];
+}
+
+/*
+ * panel_refresh:
+ *
+ * Refresh the panel of page @idx, a panel which hasn't been populated yet is
+ * force refreshed so it reads everything from the daemon.
+ */
+static gboolean
+panel_refresh(NwamCappletDialog *self, gint idx, gpointer user_data, gboolean force)
+{
+    NwamCappletDialogPrivate *prv = NWAM_CAPPLET_DIALOG_GET_PRIVATE(self);
+    gboolean                  populated = prv->panel_populated[idx];
+
+    if (!populated) {
+        force = TRUE;
+        /* The status panel shows the NCUs of the active NCP. */
+        if (idx == PANEL_CONN_STATUS && user_data == NULL) {
+            user_data = prv->active_ncp;
+        }
+    }
+
+    if (nwam_pref_refresh(get_panel(self, idx), user_data, force)) {
+        prv->panel_populated[idx] = TRUE;
+    }
+
+    if (!populated && prv->panel_populated[idx]) {
+        nwamui_debug("populated page %d", idx);
+    }
+    return prv->panel_populated[idx];
+}
+
+/*
+ * panel_prewarm:
+ *
+ * Idle handler, populate one page which hasn't been shown yet per call, so
+ * switching to it doesn't wait on the daemon. The IP panel needs an NCU, so
+ * it is only constructed.
+ */
+static gboolean
+panel_prewarm(gpointer data)
+{
+    NwamCappletDialog        *self = NWAM_CAPPLET_DIALOG(data);
+    NwamCappletDialogPrivate *prv = NWAM_CAPPLET_DIALOG_GET_PRIVATE(self);
+    gint                      idx;
+
+    for (idx = PANEL_CONN_STATUS; idx < PANEL_CONF_IP; idx++) {
+        if (!prv->panel_populated[idx]) {
+            panel_refresh(self, idx, NULL, TRUE);
+            return TRUE;
+        }
+    }
+    get_panel(self, PANEL_CONF_IP);
+
+    prv->prewarm_id = 0;
+    return FALSE;
+}
+
 /* Callbacks */
 
 /**
@@ -306,10 +402,12 @@ refresh(NwamPrefIFace *iface, gpointer user_data, gboolean force)
         g_object_unref(daemon);
     }
 
-    if (NWAM_IS_PREF_IFACE(obj)) {
-        nwam_pref_refresh(NWAM_PREF_IFACE(obj), NULL, TRUE);
+    if (NWAM_IS_CONN_STATUS_PANEL(obj)) {
+        panel_refresh(self, PANEL_CONN_STATUS, NULL, TRUE);
+    } else if (NWAM_IS_PROFILE_PANEL(obj)) {
+        panel_refresh(self, PANEL_PROF_PREF, NULL, TRUE);
     } else if (NWAMUI_IS_NCU(obj)) {
-        nwam_pref_refresh(NWAM_PREF_IFACE(prv->panel[PANEL_CONF_IP]), (gpointer)obj, TRUE);
+        panel_refresh(self, PANEL_CONF_IP, (gpointer)obj, TRUE);
     } else {
         g_assert_not_reached();
     }
@@ -336,7 +434,7 @@ apply(NwamPrefIFace *iface, gpointer user_data)
     daemon = nwamui_daemon_get_instance();
 
     /* Ensure we don't have unsaved data */
-    if ( !nwam_pref_apply (NWAM_PREF_IFACE(NWAM_CAPPLET_DIALOG(self)->prv->panel[cur_idx]), NULL) ) {
+    if ( !nwam_pref_apply (get_panel(self, cur_idx), NULL) ) {
         rval = FALSE;
     }
 
@@ -365,7 +463,7 @@ help(NwamPrefIFace *iface, gpointer user_data)
 {
 	NwamCappletDialog* self = NWAM_CAPPLET_DIALOG(iface);
     gint idx = gtk_notebook_get_current_page (NWAM_CAPPLET_DIALOG(self)->prv->main_nb);
-    nwam_pref_help (NWAM_PREF_IFACE(NWAM_CAPPLET_DIALOG(self)->prv->panel[idx]), NULL);
+    nwam_pref_help (get_panel(self, idx), NULL);
 }
 
 /*
@@ -457,7 +555,7 @@ show_changed_cb( GtkWidget* widget, gpointer data )
     } else if (type == NWAMUI_TYPE_NCU) {
         self->prv->selected_ncu = NWAMUI_NCU(g_object_ref(obj));
         user_data = obj;
-        obj = G_OBJECT(self->prv->panel[PANEL_CONF_IP]);
+        obj = G_OBJECT(get_panel(self, PANEL_CONF_IP));
         idx = 2;
     } else {
         g_assert_not_reached();
@@ -472,7 +570,7 @@ show_changed_cb( GtkWidget* widget, gpointer data )
         gint        cur_idx = gtk_notebook_get_current_page (NWAM_CAPPLET_DIALOG(self)->prv->main_nb);
         gchar      *prop_name = NULL;
 
-        if ( !nwam_pref_apply (NWAM_PREF_IFACE(NWAM_CAPPLET_DIALOG(self)->prv->panel[cur_idx]), NULL) ) {
+        if ( !nwam_pref_apply (get_panel(self, cur_idx), NULL) ) {
             /* Don't change selection */
             valid = FALSE;
         }
@@ -497,7 +595,7 @@ show_changed_cb( GtkWidget* widget, gpointer data )
     if ( valid ) {
         gtk_notebook_set_current_page(self->prv->main_nb, idx);
         /* Cancel all changes what user has changed in the current page. */
-        nwam_pref_refresh(NWAM_PREF_IFACE(obj), user_data, FALSE);
+        panel_refresh(self, idx, user_data, FALSE);
     }
 
     if (user_data) {
@@ -752,7 +850,7 @@ nwam_capplet_dialog_select_tab(NwamCappletDialog *self, gint index, gboolean rel
 
     g_return_if_fail(index >= 0 && index < N_PANELS);
 
-    capplet_combo_set_active_object(GTK_COMBO_BOX(prv->show_combo), G_OBJECT(prv->panel[index]));
+    capplet_combo_set_active_object(GTK_COMBO_BOX(prv->show_combo), G_OBJECT(get_panel(self, index)));
 
     refresh(NWAM_PREF_IFACE(self), NULL, reload);
 }
@@ -96,13 +96,13 @@ struct _NwamProfileDialogPrivate {
     NwamuiDaemon            *daemon;
     NwamCappletDialog*       pref_dialog;
     NwamuiObject*            selected_ncp;
+    gint                     pending_response; /* While committing */
     NwamuiNcu*               selected_ncu; /* Use g_object_set for it */
     nwamui_dialog_purpose_t  purpose;
     gboolean                 update_inprogress;
     gboolean                 manual_expander_flag;
     gboolean                 connection_activation_combo_show_ncu_part;
 
-    gpointer            foreachdata[1];
 
     gint on_group_num;
     gint off_group_num;
@@ -565,6 +565,7 @@ nwam_profile_dialog_init(NwamProfileDialog *self)
 	self->prv = prv;
 
     prv->daemon = nwamui_daemon_get_instance();
+    prv->pending_response = GTK_RESPONSE_NONE;
 
     if (!fake_object_in_pri_group)
         fake_object_in_pri_group = g_object_new(NWAMUI_TYPE_OBJECT, NULL);
@@ -705,11 +706,11 @@ refresh(NwamPrefIFace *iface, gpointer user_data, gboolean force)
     return( TRUE );
 }
 
+/* Copy group modes and the name into selected_ncp. */
 static gboolean
-apply(NwamPrefIFace *iface, gpointer user_data)
+update_ncp_from_dialog(NwamProfileDialog *self)
 {
-    NwamProfileDialog        *self   = NWAM_PROFILE_DIALOG( iface );
-    NwamProfileDialogPrivate *prv    = GET_PRIVATE(iface);
+    NwamProfileDialogPrivate *prv    = GET_PRIVATE(self);
     GtkTreeIter               iter;
 
     if (prv->selected_ncp && nwamui_object_is_modifiable(prv->selected_ncp)) {
@@ -723,6 +724,18 @@ apply(NwamPrefIFace *iface, gpointer user_data)
         if (GTK_WIDGET_IS_SENSITIVE(prv->profile_name_entry)) {
             nwamui_object_set_name(prv->selected_ncp, gtk_entry_get_text(GTK_ENTRY(prv->profile_name_entry)));
         }
+        return(TRUE);
+    }
+    return(FALSE);
+}
+
+static gboolean
+apply(NwamPrefIFace *iface, gpointer user_data)
+{
+    NwamProfileDialog        *self   = NWAM_PROFILE_DIALOG( iface );
+    NwamProfileDialogPrivate *prv    = GET_PRIVATE(iface);
+
+    if (update_ncp_from_dialog(self)) {
         /* This will commit all NCU children. */
         nwamui_object_commit(prv->selected_ncp);
     }
@@ -730,6 +743,89 @@ apply(NwamPrefIFace *iface, gpointer user_data)
     return(TRUE);
 }
 
+static void
+apply_done(GtkDialog *dialog,
+  gboolean success,
+  gboolean cancelled,
+  NwamuiObject *failed,
+  nwamui_commit_stage_t failed_stage,
+  const gchar *prop_name,
+  gpointer user_data)
+{
+    NwamProfileDialog        *self = NWAM_PROFILE_DIALOG(user_data);
+    NwamProfileDialogPrivate *prv  = GET_PRIVATE(self);
+    gint                      responseid = prv->pending_response;
+
+    prv->pending_response = GTK_RESPONSE_NONE;
+
+    if (success) {
+        /* Everything is committed, even if Cancel came too late. */
+        gtk_widget_hide(GTK_WIDGET(dialog));
+    } else if (responseid == GTK_RESPONSE_CANCEL) {
+        /* Whatever was committed stays, drop the rest. */
+        nwam_pref_cancel(NWAM_PREF_IFACE(self), NULL);
+        gtk_widget_hide(GTK_WIDGET(dialog));
+    } else if (!cancelled) {
+        gchar *msg;
+
+        if (failed_stage == NWAMUI_COMMIT_VALIDATED) {
+            msg = g_strdup_printf(_("Validation of %s failed with the property %s"),
+              nwamui_object_get_name(failed), prop_name);
+        } else {
+            msg = g_strdup_printf(_("Committing %s failed..."),
+              nwamui_object_get_name(failed));
+        }
+        nwamui_util_show_message(GTK_WINDOW(dialog),
+          GTK_MESSAGE_ERROR,
+          _("Network Profile Error"),
+          msg, TRUE);
+        g_free(msg);
+    }
+}
+
+static void
+apply_collect_modified_ncu(gpointer data, gpointer user_data)
+{
+    GList **objects = (GList **)user_data;
+
+    if (nwamui_object_has_modifications(NWAMUI_OBJECT(data))) {
+        *objects = g_list_prepend(*objects, data);
+    }
+}
+
+/*
+ * Commit selected_ncp and its NCUs on a worker, see apply_done(). An NCP
+ * commit commits all of its NCUs at once, so an existing NCP is handed
+ * over as its modified NCUs, which lets Cancel stop between them. A new
+ * NCP has to be created by its own commit.
+ */
+static void
+apply_async(NwamProfileDialog *self)
+{
+    NwamProfileDialogPrivate *prv = GET_PRIVATE(self);
+    GList                    *objects = NULL;
+
+    if (!update_ncp_from_dialog(self)) {
+        gtk_widget_hide(GTK_WIDGET(prv->edit_network_profile_dlg));
+        return;
+    }
+
+    if (nwamui_ncp_get_nwam_handle(NWAMUI_NCP(prv->selected_ncp)) != NULL) {
+        nwamui_ncp_foreach_ncu(NWAMUI_NCP(prv->selected_ncp), apply_collect_modified_ncu, &objects);
+        if (objects == NULL) {
+            gtk_widget_hide(GTK_WIDGET(prv->edit_network_profile_dlg));
+            return;
+        }
+        objects = g_list_reverse(objects);
+    } else {
+        objects = g_list_prepend(NULL, prv->selected_ncp);
+    }
+
+    prv->pending_response = GTK_RESPONSE_OK;
+    capplet_dialog_commit_async(prv->edit_network_profile_dlg, objects, apply_done, (gpointer)self);
+    g_list_free(objects);
+}
+
 static gboolean
 cancel(NwamPrefIFace *iface, gpointer user_data)
 {
@@ -861,31 +957,10 @@ nwam_net_conf_update_status_cell_cb (GtkTreeViewColumn *col,
     switch (GPOINTER_TO_INT (g_object_get_data (G_OBJECT (renderer), TREEVIEW_COLUMN_NUM))) {
     case CONNVIEW_INFO: {
         if (!is_group) {
-            const gchar* ncu_text;
-            gchar*       ncu_markup;
-            gchar*       ncu_phy_addr;
-            gchar*       info_string;
-
-            ncu_text = nwamui_ncu_get_display_name(ncu);
-            ncu_phy_addr = nwamui_ncu_get_phy_address(ncu);
-
-            info_string = nwamui_ncu_get_configuration_summary_string( ncu );
-
-            if (ncu_phy_addr) {
-                ncu_markup= g_strdup_printf(_("<b>%s</b>\n<small>%s, %s</small>"), ncu_text, info_string, ncu_phy_addr );
-            } else {
-                ncu_markup= g_strdup_printf(_("<b>%s</b>\n<small>%s</small>"), ncu_text, info_string );
-            }
             g_object_set(G_OBJECT(renderer),
               "sensitive", TRUE,
-              "markup", ncu_markup,
+              "markup", nwamui_ncu_get_cached_markup(ncu),
               NULL);
-
-            if ( ncu_phy_addr != NULL )
-                g_free( ncu_phy_addr );
-
-            g_free (info_string);
-            g_free( ncu_markup );
         } else {
             gchar *str = NULL;
             gint    group_id = 0;
@@ -1510,7 +1585,7 @@ ncu_find_gt_name(GtkTreeModel *model, GtkTreePath *path, GtkTreeIter *iter, gpoi
     name = nwamui_object_get_name(object);
     ins_name = nwamui_object_get_name(ins_object);
 
-    ret = g_ascii_strcasecmp(name, (gchar*)user_data);
+    ret = g_ascii_strcasecmp(name, ins_name);
 
     g_object_unref(object);
 
@@ -1621,21 +1696,20 @@ handle_ncu_group_node(GtkTreeModel *model, GtkTreeRowReference *group_rr)
 }
 
 
-static gboolean
-foreach_select_object(GtkTreeModel *model, GtkTreePath *path, GtkTreeIter *iter, gpointer user_data)
+static void
+ncu_pri_treeview_select_object(NwamProfileDialog *self, GtkTreeIter *parent, NwamuiObject *object)
 {
-    NwamProfileDialogPrivate*    prv = GET_PRIVATE(user_data);
-    NwamuiObject *obj;
+    NwamProfileDialogPrivate* prv = GET_PRIVATE(self);
+    GtkTreeModel             *model = gtk_tree_view_get_model(prv->net_conf_treeview);
+    GtkTreeIter               iter;
+    GtkTreePath              *path;
 
-    gtk_tree_model_get(model, iter, 0, &obj, -1);
-    g_assert(obj);
-    if (obj == prv->foreachdata[0]) {
+    if (capplet_model_find_object_with_parent(model, parent, G_OBJECT(object), &iter)) {
+        path = gtk_tree_model_get_path(model, &iter);
         gtk_tree_view_scroll_to_cell(prv->net_conf_treeview, path, NULL, FALSE, 0, 0);
         gtk_tree_selection_select_path(gtk_tree_view_get_selection(prv->net_conf_treeview), path);
-        prv->foreachdata[0] = NULL;
+        gtk_tree_path_free(path);
     }
-    g_object_unref(obj);
-    return prv->foreachdata[0] == NULL;
 }
 
 /*
@@ -1831,12 +1905,7 @@ on_button_clicked(GtkButton *button, gpointer user_data)
             {
                 GtkTreeIter parent;
                 gtk_tree_model_get_iter(model, &parent, parent_path);
-                prv->foreachdata[0] = (gpointer)object;
-                capplet_model_1_level_foreach(model,
-                  &parent,
-                  foreach_select_object,
-                  self,
-                  &iter);
+                ncu_pri_treeview_select_object(self, &parent, object);
             }
             gtk_tree_path_free(parent_path);
 
@@ -1873,12 +1942,7 @@ on_button_clicked(GtkButton *button, gpointer user_data)
             {
                 GtkTreeIter parent;
                 gtk_tree_model_get_iter(model, &parent, parent_path);
-                prv->foreachdata[0] = (gpointer)object;
-                capplet_model_1_level_foreach(model,
-                  &parent,
-                  foreach_select_object,
-                  self,
-                  &iter);
+                ncu_pri_treeview_select_object(self, &parent, object);
             }
             gtk_tree_path_free(parent_path);
 
@@ -1918,7 +1982,7 @@ on_button_clicked(GtkButton *button, gpointer user_data)
             static_group_handle_fake_node(model,
               NCU_PRI_GROUP_GET_PATH(model, group_id), FALSE);
 
-            if (capplet_model_1_level_foreach(model, &parent,
+            if (capplet_model_1_level_find_first(model, &parent,
                 ncu_find_gt_name, (gpointer)object, &sibling)) {
                 TREE_STORE_CP_OBJECT_BEFORE(model, &iter, &parent, &sibling, &temp);
             } else {
@@ -2620,7 +2684,7 @@ ncu_pri_group_get_path(GtkTreeModel *model, gint group_id, gint group_mode, GtkT
          */
         if (!parent) {parent = &parent_iter;}
 
-        if (capplet_model_1_level_foreach(model, NULL,
+        if (capplet_model_1_level_find_first(model, NULL,
             ncu_pri_group_find_iter_gt, (gpointer)group_id, &sibling)) {
             sibling_p = &sibling;
         } else {
@@ -2855,21 +2919,33 @@ response_cb(GtkWidget* widget, gint responseid, gpointer data)
 			break;
 		case GTK_RESPONSE_OK:
 			g_debug("GTK_RESPONSE_OK");
-            if (nwam_pref_apply(NWAM_PREF_IFACE(self), NULL)) {
-                gtk_widget_hide(GTK_WIDGET(prv->edit_network_profile_dlg));
-            } else {
-                /* TODO - report error to user */
-                stop_emission = TRUE;
+            if (!capplet_dialog_commit_busy(prv->edit_network_profile_dlg)) {
+                apply_async(self);
             }
+            stop_emission = TRUE;
 			break;
 		case GTK_RESPONSE_REJECT: /* Generated by Referesh Button */
 			g_debug("GTK_RESPONSE_REJECT");
             nwam_pref_refresh(NWAM_PREF_IFACE(self), NULL, TRUE);
             stop_emission = TRUE;
 			break;
+		case GTK_RESPONSE_DELETE_EVENT:
+			g_debug("GTK_RESPONSE_DELETE_EVENT");
+            /* Closing the window mid-commit is a Cancel. */
+            if (capplet_dialog_commit_busy(prv->edit_network_profile_dlg)) {
+                prv->pending_response = GTK_RESPONSE_CANCEL;
+                capplet_dialog_commit_cancel(prv->edit_network_profile_dlg);
+                stop_emission = TRUE;
+            }
+			break;
 		case GTK_RESPONSE_CANCEL:
 			g_debug("GTK_RESPONSE_CANCEL");
-            if (nwam_pref_cancel (NWAM_PREF_IFACE(self), NULL)) {
+            if (capplet_dialog_commit_busy(prv->edit_network_profile_dlg)) {
+                /* apply_done() cleans up once the worker stops. */
+                prv->pending_response = GTK_RESPONSE_CANCEL;
+                capplet_dialog_commit_cancel(prv->edit_network_profile_dlg);
+                stop_emission = TRUE;
+            } else if (nwam_pref_cancel (NWAM_PREF_IFACE(self), NULL)) {
                 gtk_widget_hide(GTK_WIDGET(prv->edit_network_profile_dlg));
             } else {
                 stop_emission = TRUE;
@@ -113,6 +113,7 @@ static void nwam_profile_panel_get_property (GObject         *object,
 
 static gboolean nwam_profile_panel_is_toggled_row(NwamProfilePanel *self, GtkTreePath *path);
 static void nwam_profile_panel_set_toggled_row(NwamProfilePanel *self, GtkTreePath *path);
+static void on_ncp_activated(NwamuiObject *object, gboolean active, nwamui_activation_result_t result, gpointer user_data);
 
 /* Callbacks */
 static void object_notify_cb( GObject *gobject, GParamSpec *arg1, gpointer data);
@@ -359,8 +360,7 @@ nwam_profile_panel_init(NwamProfilePanel *self)
     
 	g_signal_connect(G_OBJECT(self), "notify", (GCallback)object_notify_cb, NULL);
 
-    /* Initially refresh self */
-    nwam_pref_refresh(NWAM_PREF_IFACE(self), NULL, TRUE);
+    /* Populated by the first refresh, when its page is shown. */
 }
 
 /**
@@ -479,7 +479,7 @@ apply(NwamPrefIFace *iface, gpointer user_data)
             NwamuiObject *toggled_ncp;
 
             gtk_tree_model_get(gtk_tree_view_get_model(prv->object_view), &iter, 0, &toggled_ncp, -1);
-            nwamui_object_set_active(toggled_ncp, TRUE);
+            nwamui_object_set_active_async(toggled_ncp, TRUE, on_ncp_activated, g_object_ref(self));
             g_object_unref(toggled_ncp);
         }
     }
@@ -488,6 +488,23 @@ apply(NwamPrefIFace *iface, gpointer user_data)
     return retval;
 }
 
+static void
+on_ncp_activated(NwamuiObject *object, gboolean active, nwamui_activation_result_t result, gpointer user_data)
+{
+    NwamProfilePanel        *self = NWAM_PROFILE_PANEL(user_data);
+	NwamProfilePanelPrivate *prv  = GET_PRIVATE(self);
+
+    /* A superseded request isn't an error, the newer one reports. */
+    if (result == NWAMUI_ACTIVATION_FAILED) {
+        gchar *msg = g_strdup_printf(_("Activating %s failed..."), nwamui_object_get_name(object));
+
+        nwamui_util_show_message(nwam_pref_dialog_get_window(NWAM_PREF_IFACE(prv->pref_dialog)),
+          GTK_MESSAGE_ERROR, _("Activate NCP error"), msg, TRUE);
+        g_free(msg);
+    }
+    g_object_unref(self);
+}
+
 /**
  * help:
  *
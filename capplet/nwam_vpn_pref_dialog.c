@@ -94,6 +94,7 @@ struct _NwamVPNPrefDialogPrivate {
 	NwamuiDaemon *daemon;
 	//GList	*enm_list;
 	GObject	*cur_obj;           /* current selection of tree */
+	gint     pending_response;  /* While committing */
 };
 
 static void nwam_pref_init (gpointer g_iface, gpointer iface_data);
@@ -184,6 +185,7 @@ nwam_vpn_pref_dialog_init(NwamVPNPrefDialog *self)
 
 	/* daemon */
 	prv->daemon = nwamui_daemon_get_instance ();
+	prv->pending_response = GTK_RESPONSE_NONE;
 
 	/* Iniialise pointers to important widgets */
 	prv->vpn_pref_dialog = GTK_DIALOG(nwamui_util_glade_get_widget(VPN_PREF_DIALOG_NAME));
@@ -636,6 +638,99 @@ apply(NwamPrefIFace *iface, gpointer user_data)
     return retval;
 }
 
+static gboolean
+foreach_collect_modified(GtkTreeModel *model,
+  GtkTreePath *path,
+  GtkTreeIter *iter,
+  gpointer user_data)
+{
+    GList        **list   = (GList **)user_data;
+	NwamuiObject  *object = NULL;
+
+    gtk_tree_model_get(model, iter, 0, &object, -1);
+    if (object) {
+        if (nwamui_object_has_modifications(object)) {
+            *list = g_list_prepend(*list, object);
+        } else {
+            g_object_unref(object);
+        }
+    }
+    return FALSE;
+}
+
+static void
+apply_done(GtkDialog *dialog,
+  gboolean success,
+  gboolean cancelled,
+  NwamuiObject *failed,
+  nwamui_commit_stage_t failed_stage,
+  const gchar *prop_name,
+  gpointer user_data)
+{
+	NwamVPNPrefDialog        *self = NWAM_VPN_PREF_DIALOG(user_data);
+	NwamVPNPrefDialogPrivate *prv  = GET_PRIVATE(self);
+    gint                      responseid = prv->pending_response;
+    GtkTreeIter               iter;
+    gchar                    *msg;
+
+    prv->pending_response = GTK_RESPONSE_NONE;
+
+    if (success) {
+        /* Everything is committed, even if Cancel came too late. */
+        gtk_widget_hide(GTK_WIDGET(dialog));
+        return;
+    }
+    if (responseid == GTK_RESPONSE_CANCEL) {
+        nwam_pref_cancel(NWAM_PREF_IFACE(self), NULL);
+        gtk_widget_hide(GTK_WIDGET(dialog));
+        return;
+    }
+    if (cancelled) {
+        return;
+    }
+
+    if (failed_stage == NWAMUI_COMMIT_VALIDATED) {
+        msg = g_strdup_printf (_("Validation of %s failed with the property %s"), nwamui_object_get_name(failed), prop_name);
+        nwamui_util_show_message (GTK_WINDOW(dialog),
+          GTK_MESSAGE_ERROR, _("Validation error"), msg, TRUE);
+    } else {
+        msg = g_strdup_printf (_("Committing %s failed..."), nwamui_object_get_name(failed));
+        nwamui_util_show_message (GTK_WINDOW(dialog),
+          GTK_MESSAGE_ERROR, _("Commit ENM error"), msg, TRUE);
+    }
+    g_free(msg);
+
+    /* Start highlight relevant object */
+    if (capplet_model_find_object(gtk_tree_view_get_model(prv->view), G_OBJECT(failed), &iter)) {
+        gtk_tree_selection_select_iter(gtk_tree_view_get_selection(prv->view), &iter);
+    }
+}
+
+/* Like apply(), but validate and commit on a worker, see apply_done(). */
+static void
+apply_async(NwamVPNPrefDialog *self)
+{
+	NwamVPNPrefDialogPrivate *prv = GET_PRIVATE(self);
+    GList                    *objects = NULL;
+
+    if (prv->cur_obj && !nwam_update_obj(self, prv->cur_obj)) {
+        return;
+    }
+
+    gtk_tree_model_foreach(gtk_tree_view_get_model(prv->view),
+      foreach_collect_modified, &objects);
+    if (objects == NULL) {
+        gtk_widget_hide(GTK_WIDGET(prv->vpn_pref_dialog));
+        return;
+    }
+
+    prv->pending_response = GTK_RESPONSE_OK;
+    objects = g_list_reverse(objects);
+    capplet_dialog_commit_async(prv->vpn_pref_dialog, objects, apply_done, (gpointer)self);
+    g_list_foreach(objects, (GFunc)g_object_unref, NULL);
+    g_list_free(objects);
+}
+
 static gboolean
 help(NwamPrefIFace *iface, gpointer user_data)
 {
@@ -662,14 +757,32 @@ response_cb(GtkWidget* widget, gint responseid, gpointer data)
 			break;
 		case GTK_RESPONSE_DELETE_EVENT:
 			g_debug("GTK_RESPONSE_DELETE_EVENT");
+            /* Closing the window mid-commit is a Cancel, the dialog stays
+             * up until apply_done().
+             */
+            if (capplet_dialog_commit_busy(prv->vpn_pref_dialog)) {
+                prv->pending_response = GTK_RESPONSE_CANCEL;
+                capplet_dialog_commit_cancel(prv->vpn_pref_dialog);
+                stop_emission = TRUE;
+            }
 			break;
 		case GTK_RESPONSE_OK:
 			g_debug("GTK_RESPONSE_OK");
-            stop_emission = !nwam_pref_apply(NWAM_PREF_IFACE(data), NULL);
+            /* apply_done() hides the dialog. */
+            if (!capplet_dialog_commit_busy(prv->vpn_pref_dialog)) {
+                apply_async(NWAM_VPN_PREF_DIALOG(data));
+            }
+            stop_emission = TRUE;
 			break;
 		case GTK_RESPONSE_CANCEL:
 			g_debug("GTK_RESPONSE_CANCEL");
-            stop_emission = !nwam_pref_cancel(NWAM_PREF_IFACE(data), NULL);
+            if (capplet_dialog_commit_busy(prv->vpn_pref_dialog)) {
+                prv->pending_response = GTK_RESPONSE_CANCEL;
+                capplet_dialog_commit_cancel(prv->vpn_pref_dialog);
+                stop_emission = TRUE;
+            } else {
+                stop_emission = !nwam_pref_cancel(NWAM_PREF_IFACE(data), NULL);
+            }
 			break;
 		case GTK_RESPONSE_HELP:
             nwam_pref_help (NWAM_PREF_IFACE(data), NULL);
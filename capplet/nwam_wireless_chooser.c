@@ -28,6 +28,7 @@
  */
 
 #include <gtk/gtk.h>
+#include <string.h>
 #include <glib/gi18n.h>
 
 #include "libnwamui.h"
@@ -42,6 +43,7 @@
 #define WIRELESS_ADD_TO_PREFERRED_CBOX "chooser_add_to_preferred_cbox"
 #define WIRELESS_CONNECT_WIRELESS_OK_BTN "connect_wireless_connect_btn"
 #define WIRELESS_CONNECT_WIRELESS_REFRESH_BTN "connect_wireless_refresh_btn"
+#define WIRELESS_FILTER_ENTRY          "wireless_filter_entry"
 
 struct _NwamWirelessChooserPrivate {
 	/* Widget Pointers */
@@ -50,6 +52,7 @@ struct _NwamWirelessChooserPrivate {
     GtkCheckButton *add_to_preferred_cbox;
     GtkWidget      *connect_wireless_connect_btn;
     GtkWidget      *connect_wireless_refresh_btn;
+    GtkEntry       *filter_entry;
 
 	/* Other Data */
     NwamuiDaemon*       daemon;
@@ -57,15 +60,36 @@ struct _NwamWirelessChooserPrivate {
     gboolean            join_preferred;
     gint                action_if_no_fav;
     NwamuiWifiNet      *selected_wifi;
+
+    /* Rows are kept up to date from scan events instead of being refilled,
+     * wifi_rows maps each NwamuiWifiNet to its row in wifi_store.
+     */
+    GtkListStore       *wifi_store;
+    GtkTreeModel       *wifi_filter;
+    GHashTable         *wifi_rows;
+    gchar              *filter_text;    /* Casefolded, NULL shows all */
+    gboolean            has_many_wifi;
 };
 
+/* Model columns, all but the object are precomputed from it when the row is
+ * added or the object changes, so rendering and sorting don't call back into
+ * the object.
+ */
 enum {
-	WIFI_FAV_ESSID=0,
-	WIFI_FAV_SECURITY,
-	WIFI_FAV_SPEED,
-    WIFI_FAV_SIGNAL
+    CHOOSER_COL_OBJECT = 0,
+    CHOOSER_COL_SIGNAL_ICON,
+    CHOOSER_COL_ESSID,
+    CHOOSER_COL_SPEED,
+    CHOOSER_COL_SECURITY,
+    CHOOSER_COL_SORT_KEY,
+    CHOOSER_COL_FILTER_KEY,
+    CHOOSER_N_COL
 };
 
+typedef struct {
+    GtkTreeIter iter;           /* wifi_store iters persist */
+} ChooserRow;
+
 static void nwam_pref_init (gpointer g_iface, gpointer iface_data);
 static gboolean refresh(NwamPrefIFace *iface, gpointer user_data, gboolean force);
 static gboolean apply(NwamPrefIFace *iface, gpointer user_data);
@@ -81,15 +105,15 @@ static void refresh_btn_clicked( GtkButton *widget, gpointer user_data);
 static void nwam_wifi_selection_changed(GtkTreeSelection *selection, gpointer data);
 static void response_cb( GtkWidget* widget, gint repsonseid, gpointer data );
 static void object_notify_cb( GObject *gobject, GParamSpec *arg1, gpointer data);
-static void nwam_wifi_chooser_cell_cb (GtkTreeViewColumn *col,
-  GtkCellRenderer   *renderer,
-  GtkTreeModel      *model,
-  GtkTreeIter       *iter,
-  gpointer           data);
 static gint nwam_wifi_chooser_comp_cb (GtkTreeModel *model,
   GtkTreeIter *a,
   GtkTreeIter *b,
   gpointer user_data);
+static gboolean nwam_wifi_chooser_visible_cb(GtkTreeModel *model,
+  GtkTreeIter *iter,
+  gpointer user_data);
+static void filter_entry_changed(GtkEditable *editable, gpointer user_data);
+static void wifi_changed_cb(NwamuiObject *object, guint change_mask, gpointer data);
 static void presistant_cb(GtkToggleButton* widget, gpointer data);
 
 /* Daemon */
@@ -132,19 +156,35 @@ nwam_wireless_chooser_class_init(NwamWirelessChooserClass *klass)
 static void
 nwam_compose_wifi_chooser_view (NwamWirelessChooser *self, GtkTreeView *view)
 {
+    NwamWirelessChooserPrivate *prv = self->prv;
     GtkTreeViewColumn *col;
     GtkCellRenderer *renderer;
-    GtkTreeModel *model;
 
-    model = GTK_TREE_MODEL(gtk_list_store_new (1, NWAMUI_TYPE_WIFI_NET));
-    gtk_tree_view_set_model (view, model);
+    prv->wifi_store = gtk_list_store_new (CHOOSER_N_COL,
+      NWAMUI_TYPE_WIFI_NET,     /* CHOOSER_COL_OBJECT */
+      GDK_TYPE_PIXBUF,          /* CHOOSER_COL_SIGNAL_ICON */
+      G_TYPE_STRING,            /* CHOOSER_COL_ESSID */
+      G_TYPE_STRING,            /* CHOOSER_COL_SPEED */
+      G_TYPE_STRING,            /* CHOOSER_COL_SECURITY */
+      G_TYPE_STRING,            /* CHOOSER_COL_SORT_KEY */
+      G_TYPE_STRING);           /* CHOOSER_COL_FILTER_KEY */
+    gtk_tree_sortable_set_sort_func(GTK_TREE_SORTABLE(prv->wifi_store),
+      CHOOSER_COL_SORT_KEY, nwam_wifi_chooser_comp_cb, NULL, NULL);
+    gtk_tree_sortable_set_sort_column_id(GTK_TREE_SORTABLE(prv->wifi_store),
+      CHOOSER_COL_SORT_KEY, GTK_SORT_ASCENDING);
+
+    prv->wifi_filter = gtk_tree_model_filter_new(GTK_TREE_MODEL(prv->wifi_store), NULL);
+    gtk_tree_model_filter_set_visible_func(GTK_TREE_MODEL_FILTER(prv->wifi_filter),
+      nwam_wifi_chooser_visible_cb, (gpointer)self, NULL);
+
+    gtk_tree_view_set_model (view, prv->wifi_filter);
 
     g_object_set (G_OBJECT(view),
       "headers-clickable", FALSE,
       "reorderable", FALSE,
       NULL);
 
-    // Column:	WIFI_FAV_ESSID
+    // Column:	CHOOSER_COL_ESSID
 	col = capplet_column_new(view,
       "title", _("Name (ESSID)"),
       "expand", TRUE,
@@ -156,17 +196,16 @@ nwam_compose_wifi_chooser_view (NwamWirelessChooser *self, GtkTreeView *view)
 
     /* first signal strength icon cell */
     renderer = capplet_column_append_cell(col, gtk_cell_renderer_pixbuf_new(),
-      FALSE, nwam_wifi_chooser_cell_cb, (gpointer)self, NULL);
-
-    g_object_set_data(G_OBJECT(renderer), "nwam_wifi_fav_column_id", GUINT_TO_POINTER(WIFI_FAV_SIGNAL));
+      FALSE, NULL, NULL, NULL);
+    gtk_tree_view_column_add_attribute(col, renderer, "pixbuf", CHOOSER_COL_SIGNAL_ICON);
 
     /* second ESSID text cell */
     renderer = capplet_column_append_cell(col, gtk_cell_renderer_text_new(),
-      TRUE, nwam_wifi_chooser_cell_cb, (gpointer)self, NULL);
+      TRUE, NULL, NULL, NULL);
     g_object_set(G_OBJECT(renderer), "editable", FALSE, NULL);
-    g_object_set_data(G_OBJECT(renderer), "nwam_wifi_fav_column_id", GUINT_TO_POINTER(WIFI_FAV_ESSID));
+    gtk_tree_view_column_add_attribute(col, renderer, "text", CHOOSER_COL_ESSID);
     
-    // Column:	WIFI_FAV_SPEED
+    // Column:	CHOOSER_COL_SPEED
 	col = capplet_column_new(view,
       "title", _("Speed"),
       "expand", TRUE,
@@ -177,11 +216,11 @@ nwam_compose_wifi_chooser_view (NwamWirelessChooser *self, GtkTreeView *view)
       NULL);
 
     renderer = capplet_column_append_cell(col, gtk_cell_renderer_text_new(),
-      FALSE, nwam_wifi_chooser_cell_cb, (gpointer)self, NULL);
+      FALSE, NULL, NULL, NULL);
     g_object_set(G_OBJECT(renderer), "editable", FALSE, NULL);
-    g_object_set_data(G_OBJECT(renderer), "nwam_wifi_fav_column_id", GUINT_TO_POINTER(WIFI_FAV_SPEED));
+    gtk_tree_view_column_add_attribute(col, renderer, "text", CHOOSER_COL_SPEED);
 
-    // Column:	WIFI_FAV_SECURITY
+    // Column:	CHOOSER_COL_SECURITY
 	col = capplet_column_new(view,
       "title", _("Security"),
       "expand", TRUE,
@@ -192,9 +231,9 @@ nwam_compose_wifi_chooser_view (NwamWirelessChooser *self, GtkTreeView *view)
       NULL);
 
     renderer = capplet_column_append_cell(col, gtk_cell_renderer_text_new(),
-      FALSE, nwam_wifi_chooser_cell_cb, (gpointer)self, NULL);
+      FALSE, NULL, NULL, NULL);
     g_object_set(G_OBJECT(renderer), "editable", FALSE, NULL);
-    g_object_set_data(G_OBJECT(renderer), "nwam_wifi_fav_column_id", GUINT_TO_POINTER(WIFI_FAV_SECURITY));
+    gtk_tree_view_column_add_attribute(col, renderer, "text", CHOOSER_COL_SECURITY);
 
 	gtk_tree_selection_set_mode(gtk_tree_view_get_selection(view),
       GTK_SELECTION_SINGLE);
@@ -224,6 +263,16 @@ nwam_wireless_chooser_init(NwamWirelessChooser *self)
         GTK_WIDGET(nwamui_util_ui_get_widget_from(NWAMUI_UI_FILE_WIRELESS, WIRELESS_CONNECT_WIRELESS_REFRESH_BTN));
     self->prv->add_to_preferred_cbox = 
         GTK_CHECK_BUTTON(nwamui_util_ui_get_widget_from(NWAMUI_UI_FILE_WIRELESS, WIRELESS_ADD_TO_PREFERRED_CBOX));
+    self->prv->filter_entry =
+        GTK_ENTRY(nwamui_util_ui_get_widget_from(NWAMUI_UI_FILE_WIRELESS, WIRELESS_FILTER_ENTRY));
+
+    self->prv->wifi_rows = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    /* One coalesced update per network per flush, even while a scan
+     * notifies each of them several times.
+     */
+    nwamui_dispatch_subscribe(NULL,
+      NWAMUI_CHANGE_SIGNAL|NWAMUI_CHANGE_NAME|NWAMUI_CHANGE_OTHER,
+      wifi_changed_cb, (gpointer)self);
 
     nwam_compose_wifi_chooser_view ( self, self->prv->wifi_tv );
 
@@ -236,6 +285,7 @@ nwam_wireless_chooser_init(NwamWirelessChooser *self)
 	g_signal_connect(self->prv->wireless_chooser, "response", (GCallback)response_cb, (gpointer)self);
 	g_signal_connect(G_OBJECT(self), "notify", (GCallback)object_notify_cb, NULL);
     g_signal_connect(GTK_TOGGLE_BUTTON(self->prv->add_to_preferred_cbox), "toggled", (GCallback)presistant_cb, (gpointer)self);
+    g_signal_connect(self->prv->filter_entry, "changed", (GCallback)filter_entry_changed, (gpointer)self);
 
     /* Populate WiFi conditions */
     g_object_get (nwamui_prof_get_instance_noref(),
@@ -262,19 +312,111 @@ nwam_wireless_chooser_init(NwamWirelessChooser *self)
     nwam_pref_refresh(NWAM_PREF_IFACE(self), NULL, TRUE);
 }
 
+/*
+ * Strongest first, then by ESSID. The key is built once per change so the
+ * sort func is a plain strcmp.
+ */
+static gchar*
+wifi_sort_key(NwamuiWifiNet *wifi)
+{
+    nwamui_wifi_signal_strength_t signal = nwamui_wifi_net_get_signal_strength(wifi);
+    gchar *collate = g_utf8_collate_key(nwamui_object_get_name(NWAMUI_OBJECT(wifi)), -1);
+    gchar *key;
+
+    key = g_strdup_printf("%c%s", 'a' + (NWAMUI_WIFI_STRENGTH_LAST - signal), collate);
+    g_free(collate);
+    return key;
+}
+
+/* Add a row for wifi, or refresh it if row is given. */
+static void
+chooser_row_set(NwamWirelessChooser *self, NwamuiWifiNet *wifi, ChooserRow *row)
+{
+    NwamWirelessChooserPrivate *prv = self->prv;
+    GdkPixbuf                  *icon;
+    gchar                      *essid;
+    gchar                      *speed;
+    gchar                      *sort_key;
+    gchar                      *filter_key;
+    const gchar                *security;
+
+    icon = nwamui_util_get_wireless_strength_icon_with_size(
+      nwamui_wifi_net_get_signal_strength(wifi), NWAMUI_WIRELESS_ICON_TYPE_BARS, 16);
+    essid = nwamui_wifi_net_get_display_string(wifi, prv->has_many_wifi);
+    speed = g_strdup_printf("%uMb", nwamui_wifi_net_get_speed(wifi));
+    security = nwamui_util_wifi_sec_to_short_string(nwamui_wifi_net_get_security(wifi));
+    sort_key = wifi_sort_key(wifi);
+    filter_key = g_utf8_casefold(nwamui_object_get_name(NWAMUI_OBJECT(wifi)), -1);
+
+    if (row == NULL) {
+        row = g_new0(ChooserRow, 1);
+        gtk_list_store_insert_with_values(prv->wifi_store, &row->iter, -1,
+          CHOOSER_COL_OBJECT, wifi,
+          CHOOSER_COL_SIGNAL_ICON, icon,
+          CHOOSER_COL_ESSID, essid ? essid : "",
+          CHOOSER_COL_SPEED, speed,
+          CHOOSER_COL_SECURITY, security,
+          CHOOSER_COL_SORT_KEY, sort_key,
+          CHOOSER_COL_FILTER_KEY, filter_key,
+          -1);
+        g_hash_table_insert(prv->wifi_rows, wifi, row);
+    } else {
+        gtk_list_store_set(prv->wifi_store, &row->iter,
+          CHOOSER_COL_SIGNAL_ICON, icon,
+          CHOOSER_COL_ESSID, essid ? essid : "",
+          CHOOSER_COL_SPEED, speed,
+          CHOOSER_COL_SECURITY, security,
+          CHOOSER_COL_SORT_KEY, sort_key,
+          CHOOSER_COL_FILTER_KEY, filter_key,
+          -1);
+    }
+
+    if (icon) {
+        g_object_unref(icon);
+    }
+    g_free(essid);
+    g_free(speed);
+    g_free(sort_key);
+    g_free(filter_key);
+}
+
+static void
+chooser_row_add(NwamWirelessChooser *self, NwamuiWifiNet *wifi)
+{
+    if (g_hash_table_lookup(self->prv->wifi_rows, wifi) == NULL) {
+        chooser_row_set(self, wifi, NULL);
+    }
+}
+
+static void
+chooser_row_remove(NwamWirelessChooser *self, NwamuiWifiNet *wifi)
+{
+    NwamWirelessChooserPrivate *prv = self->prv;
+    ChooserRow                 *row;
+
+    if ((row = g_hash_table_lookup(prv->wifi_rows, wifi)) != NULL) {
+        gtk_list_store_remove(prv->wifi_store, &row->iter);
+        g_hash_table_remove(prv->wifi_rows, wifi);
+    }
+}
+
+static void
+chooser_rows_clear(NwamWirelessChooser *self)
+{
+    g_hash_table_remove_all(self->prv->wifi_rows);
+    gtk_list_store_clear(self->prv->wifi_store);
+}
+
 static void
 foreach_wifi_in_ncu_add_to_list_store(gpointer key, gpointer value, gpointer user_data)
 {
     NwamuiWifiNet          *wifi  = value;
-    GtkTreeModel           *model = (GtkTreeModel*)user_data;
-    GtkTreeIter             iter;
+    NwamWirelessChooser    *self  = NWAM_WIRELESS_CHOOSER(user_data);
 
     g_return_if_fail(NWAMUI_WIFI_NET(wifi));
-    g_debug("add '%s' to list store", nwamui_object_get_name(NWAMUI_OBJECT(wifi)));
 
     if (nwamui_wifi_net_get_life_state(wifi) != NWAMUI_WIFI_LIFE_DEAD) {
-        gtk_list_store_append(GTK_LIST_STORE(model), &iter);
-        gtk_list_store_set(GTK_LIST_STORE (model), &iter, 0, wifi, -1);
+        chooser_row_add(self, wifi);
     }
 }
 
@@ -284,24 +426,30 @@ populate_panel( NwamWirelessChooser* self, gboolean set_initial_state )
     g_assert( NWAM_IS_WIRELESS_CHOOSER(self));
 
     if (set_initial_state) {
+        NwamWirelessChooserPrivate *prv = self->prv;
         NwamuiObject *ncp   = nwamui_daemon_get_active_ncp(self->prv->daemon);
-        GtkTreeModel *model = gtk_tree_view_get_model(self->prv->wifi_tv);
-
-        gtk_widget_hide (GTK_WIDGET(self->prv->wifi_tv));
 
         nwamui_util_set_busy_cursor( GTK_WIDGET(self->prv->wireless_chooser) );
 
         gtk_widget_set_sensitive(GTK_WIDGET(self->prv->connect_wireless_refresh_btn), FALSE);
 
-        gtk_list_store_clear (GTK_LIST_STORE(model));
+        /* Bulk load detached from the view and unsorted, then sort once. */
+        gtk_tree_view_set_model(prv->wifi_tv, NULL);
+        gtk_tree_sortable_set_sort_column_id(GTK_TREE_SORTABLE(prv->wifi_store),
+          GTK_TREE_SORTABLE_UNSORTED_SORT_COLUMN_ID, GTK_SORT_ASCENDING);
+
+        chooser_rows_clear(self);
 
         /* Init WiFis */
         if (ncp) {
-            nwamui_ncp_foreach_ncu_foreach_wifi_info(NWAMUI_NCP(ncp), foreach_wifi_in_ncu_add_to_list_store, (gpointer)model);
+            prv->has_many_wifi = nwamui_ncp_get_wireless_link_num(NWAMUI_NCP(ncp)) > 1;
+            nwamui_ncp_foreach_ncu_foreach_wifi_info(NWAMUI_NCP(ncp), foreach_wifi_in_ncu_add_to_list_store, (gpointer)self);
             g_object_unref(ncp);
         }
 
-        gtk_widget_show (GTK_WIDGET(self->prv->wifi_tv));
+        gtk_tree_sortable_set_sort_column_id(GTK_TREE_SORTABLE(prv->wifi_store),
+          CHOOSER_COL_SORT_KEY, GTK_SORT_ASCENDING);
+        gtk_tree_view_set_model(prv->wifi_tv, prv->wifi_filter);
 
         nwamui_util_restore_default_cursor(GTK_WIDGET(self->prv->wireless_chooser));
 
@@ -412,6 +560,13 @@ help(NwamPrefIFace *iface, gpointer user_data)
 static void
 nwam_wireless_chooser_finalize(NwamWirelessChooser *self)
 {
+    nwamui_dispatch_unsubscribe_by_data(NULL, (gpointer)self);
+    chooser_rows_clear(self);
+    g_hash_table_destroy(self->prv->wifi_rows);
+    g_object_unref(self->prv->wifi_filter);
+    g_object_unref(self->prv->wifi_store);
+    g_free(self->prv->filter_text);
+
     if ( self->prv->daemon != NULL ) {
         g_object_unref( self->prv->daemon );
     }
@@ -557,7 +712,7 @@ response_cb(GtkWidget* widget, gint responseid, gpointer data)
 }
 
 /*
- * We don't need a comp here actually due to requirements
+ * Compare the precomputed sort keys, see wifi_sort_key().
  */
 static gint
 nwam_wifi_chooser_comp_cb (GtkTreeModel *model,
@@ -565,89 +720,67 @@ nwam_wifi_chooser_comp_cb (GtkTreeModel *model,
   GtkTreeIter *b,
   gpointer user_data)
 {
-	return 0;
+    gchar *key_a = NULL;
+    gchar *key_b = NULL;
+    gint   retval;
+
+    gtk_tree_model_get(model, a, CHOOSER_COL_SORT_KEY, &key_a, -1);
+    gtk_tree_model_get(model, b, CHOOSER_COL_SORT_KEY, &key_b, -1);
+
+    retval = strcmp(key_a ? key_a : "", key_b ? key_b : "");
+
+    g_free(key_a);
+    g_free(key_b);
+    return retval;
+}
+
+static gboolean
+nwam_wifi_chooser_visible_cb(GtkTreeModel *model,
+  GtkTreeIter *iter,
+  gpointer user_data)
+{
+    NwamWirelessChooserPrivate *prv = NWAM_WIRELESS_CHOOSER(user_data)->prv;
+    gchar                      *key = NULL;
+    gboolean                    visible;
+
+    if (prv->filter_text == NULL) {
+        return TRUE;
+    }
+
+    gtk_tree_model_get(model, iter, CHOOSER_COL_FILTER_KEY, &key, -1);
+    visible = key && strstr(key, prv->filter_text) != NULL;
+    g_free(key);
+    return visible;
 }
 
 static void
-object_notify_cb( GObject *gobject, GParamSpec *arg1, gpointer data)
+filter_entry_changed(GtkEditable *editable, gpointer user_data)
 {
-	g_debug("NwamWirelessChooser: notify %s changed", arg1->name);
+    NwamWirelessChooserPrivate *prv  = NWAM_WIRELESS_CHOOSER(user_data)->prv;
+    const gchar                *text = gtk_entry_get_text(GTK_ENTRY(editable));
+
+    g_free(prv->filter_text);
+    prv->filter_text = (text && *text) ? g_utf8_casefold(text, -1) : NULL;
+
+    gtk_tree_model_filter_refilter(GTK_TREE_MODEL_FILTER(prv->wifi_filter));
 }
 
 static void
-nwam_wifi_chooser_cell_cb (GtkTreeViewColumn *col,
-  GtkCellRenderer   *renderer,
-  GtkTreeModel      *model,
-  GtkTreeIter       *iter,
-  gpointer           data)
+wifi_changed_cb(NwamuiObject *object, guint change_mask, gpointer data)
 {
     NwamWirelessChooser *self = NWAM_WIRELESS_CHOOSER(data);
-    NwamuiWifiNet       *wifi_info  = NULL;
-    NwamuiDaemon        *daemon;
-    NwamuiObject        *ncp;
-    gboolean             has_many_wifi;
-
-    daemon = nwamui_daemon_get_instance();
-    ncp = nwamui_daemon_get_active_ncp( daemon );
-    has_many_wifi = nwamui_ncp_get_wireless_link_num(NWAMUI_NCP(ncp)) > 1;
-    g_object_unref(G_OBJECT(ncp));
-    g_object_unref(G_OBJECT(daemon));
-
-    gtk_tree_model_get(GTK_TREE_MODEL(model), iter, 0, &wifi_info, -1);
-    
-    g_return_if_fail(NWAMUI_IS_WIFI_NET(wifi_info));
-    
-    switch (GPOINTER_TO_INT (g_object_get_data (G_OBJECT (renderer), "nwam_wifi_fav_column_id"))) {
-    case WIFI_FAV_ESSID:
-    {   
-        gchar*  essid = nwamui_wifi_net_get_display_string(wifi_info, has_many_wifi );
-
-        g_object_set (G_OBJECT(renderer),
-          "text", essid?essid:"",
-          NULL);
-                    
-        g_free(essid);
-    }
-    break;
-    case WIFI_FAV_SECURITY:
-    {   
-        nwamui_wifi_security_t sec = nwamui_wifi_net_get_security(wifi_info);
-            
-        g_object_set (G_OBJECT(renderer),
-          "text", nwamui_util_wifi_sec_to_short_string(sec),
-          NULL);
-                    
-    }
-    break;
-    case WIFI_FAV_SPEED:
-    {   
-        guint   speed = nwamui_wifi_net_get_speed( wifi_info );
-        gchar*  str = g_strdup_printf("%uMb", speed);
-            
-        g_object_set (G_OBJECT(renderer),
-          "text", str,
-          NULL);
-            
-        g_free( str );
-    }
-    break;
-    case WIFI_FAV_SIGNAL:
-    {   
-        GdkPixbuf              *status_icon;
-
-        nwamui_wifi_signal_strength_t signal = nwamui_wifi_net_get_signal_strength(wifi_info);
-        status_icon = nwamui_util_get_wireless_strength_icon_with_size(signal, NWAMUI_WIRELESS_ICON_TYPE_BARS, 16);
-        g_object_set (G_OBJECT(renderer),
-          "pixbuf", status_icon,
-          NULL);
-        g_object_unref(G_OBJECT(status_icon));
-    }
-    break;
-    default:
-        g_assert_not_reached ();
+    ChooserRow          *row;
+
+    /* Only networks with a row, the lookup filters out other objects. */
+    if ((row = g_hash_table_lookup(self->prv->wifi_rows, object)) != NULL) {
+        chooser_row_set(self, NWAMUI_WIFI_NET(object), row);
     }
+}
 
-    g_object_unref(wifi_info);
+static void
+object_notify_cb( GObject *gobject, GParamSpec *arg1, gpointer data)
+{
+	g_debug("NwamWirelessChooser: notify %s changed", arg1->name);
 }
 
 static void
@@ -689,15 +822,9 @@ static void
 daemon_add_object(NwamuiDaemon *daemon, NwamuiObject* object, gpointer user_data)
 {
     NwamWirelessChooser        *self  = NWAM_WIRELESS_CHOOSER(user_data);
-    NwamWirelessChooserPrivate *prv   = self->prv;
-    GtkTreeModel               *model = gtk_tree_view_get_model(prv->wifi_tv);
-    GtkTreeIter                 iter;
 
     if (NWAMUI_IS_WIFI_NET(object) && !NWAMUI_IS_KNOWN_WLAN(object)) {
-        if (!capplet_model_find_object(model, G_OBJECT(object), &iter)) {
-            gtk_list_store_prepend(GTK_LIST_STORE(model), &iter);
-            gtk_list_store_set(GTK_LIST_STORE(model), &iter, 0, object, -1);
-        }
+        chooser_row_add(self, NWAMUI_WIFI_NET(object));
     }
 }
 
@@ -705,14 +832,9 @@ static void
 daemon_remove_object(NwamuiDaemon *daemon, NwamuiObject* object, gpointer user_data)
 {
     NwamWirelessChooser        *self  = NWAM_WIRELESS_CHOOSER(user_data);
-    NwamWirelessChooserPrivate *prv   = self->prv;
-    GtkTreeModel               *model = gtk_tree_view_get_model(prv->wifi_tv);
-    GtkTreeIter                 iter;
 
     if (NWAMUI_IS_WIFI_NET(object) && !NWAMUI_IS_KNOWN_WLAN(object)) {
-        if (capplet_model_find_object(model, G_OBJECT(object), &iter)) {
-            gtk_list_store_remove(GTK_LIST_STORE(model), &iter);
-        }
+        chooser_row_remove(self, NWAMUI_WIFI_NET(object));
     }
 }
 
@@ -69,94 +69,271 @@ const   gchar* nwamui_ui_file_names[NWAMUI_UI_FILE_LAST + 1] = {
     NULL
 };
 
-/* Load the GtkBuilder file and maintain a single reference */
-static GtkBuilder *gtk_builder[NWAMUI_UI_FILE_LAST] = { NULL };
-
-static GtkBuilder* 
-get_gtk_builder( nwamui_ui_file_index_t index ) {
-    static const gchar *build_datadir = NWAM_MANAGER_DATADIR;
-
-    if ( gtk_builder[index] == NULL ) {
-        GtkBuilder  *new_builder = gtk_builder_new();
-        const gchar * const *sys_data_dirs;
-        const gchar *ui_file;
-        gint         i;
-        GError      *err = NULL;
-
-        sys_data_dirs = g_get_system_data_dirs ();
-        if ( g_file_test(build_datadir, G_FILE_TEST_EXISTS|G_FILE_TEST_IS_DIR) ) {
-            gchar      *ui_file;
-
-            /* First try with the package name in the path */
-            ui_file = g_build_filename (build_datadir, PACKAGE, nwamui_ui_file_names[index], NULL );
-            nwamui_debug("Attempting to load : %s", ui_file);
-            if ( (gtk_builder_add_from_file(new_builder, ui_file, &err )) != 0 ) {
-                nwamui_debug("Found gtk builder file at : %s", ui_file );
-                gtk_builder[index] = new_builder;
-            }
-            else if ( err ) {
-                nwamui_warning("Error loading glade file : %s", err->message);
-                g_error_free(err);
-                err = NULL;
-            }
-            g_free (ui_file);
-            if ( gtk_builder[index]  == NULL ) {
-                /* Now try without it */
-                ui_file = g_build_filename (build_datadir, nwamui_ui_file_names[index], NULL );
-                nwamui_debug("Attempting to load : %s", ui_file);
-                if ( (gtk_builder_add_from_file(new_builder, ui_file, &err )) != 0 ) {
-                    nwamui_debug("Found gtk builder file at : %s", ui_file );
-                    gtk_builder[index]  = new_builder;
-                }
-                else if ( err ) {
-                    nwamui_warning("Error loading glade file : %s", err->message);
-                    g_error_free(err);
-                    err = NULL;
+/*
+ * A UI file is read and indexed once, without creating any widget: each
+ * object id is mapped to the toplevel object it belongs to, and each
+ * toplevel to the other toplevels (models, adjustments) its properties
+ * refer to. A toplevel's widget tree is only built, from the in-memory copy
+ * of the file, the first time one of its objects is asked for, so e.g. the
+ * wireless chooser doesn't also instantiate the join wireless dialog.
+ */
+typedef struct {
+    gchar          *buffer;         /* File contents, freed once all is built */
+    gsize           length;
+    guint           unbuilt;        /* Toplevels not built yet */
+    GtkBuilder     *builder;        /* Holds the toplevels built so far */
+    GStringChunk   *ids;            /* Strings of the two tables below */
+    GHashTable     *toplevel_of;    /* Object id -> toplevel id */
+    GHashTable     *deps_of;        /* Toplevel id -> GSList of toplevel ids */
+} nwamui_ui_file_t;
+
+typedef struct {
+    nwamui_ui_file_t   *ui;
+    gint                object_depth;
+    const gchar        *toplevel;
+    GString            *property;   /* Non-NULL inside <property> */
+    GSList             *refs;       /* Pairs of property value (owned) and its toplevel */
+} ui_file_parse_data_t;
+
+static nwamui_ui_file_t *ui_files[NWAMUI_UI_FILE_LAST] = { NULL };
+
+static void
+ui_file_start_element(GMarkupParseContext *context,
+  const gchar *element_name,
+  const gchar **attribute_names,
+  const gchar **attribute_values,
+  gpointer user_data,
+  GError **error)
+{
+    ui_file_parse_data_t *data = (ui_file_parse_data_t *)user_data;
+    gint                  i;
+
+    if (strcmp(element_name, "object") == 0) {
+        for (i = 0; attribute_names[i] != NULL; i++) {
+            if (strcmp(attribute_names[i], "id") == 0) {
+                const gchar *id = g_string_chunk_insert_const(data->ui->ids, attribute_values[i]);
+
+                if (data->object_depth == 0) {
+                    data->toplevel = id;
+                    data->ui->unbuilt++;
                 }
-                g_free (ui_file);
+                g_hash_table_insert(data->ui->toplevel_of, (gpointer)id, (gpointer)data->toplevel);
+                break;
             }
         }
-        if (gtk_builder[index]  == NULL ) {
-            for (i = 0; sys_data_dirs[i] != NULL; i++) {
-                gchar *ui_file;
-                /* First try with the package name in the path */
-                ui_file = g_build_filename (sys_data_dirs[i], PACKAGE, nwamui_ui_file_names[index], NULL );
-                nwamui_debug("Attempting to load : %s", ui_file);
-                if ( (gtk_builder_add_from_file(new_builder, ui_file, &err )) != 0 ) {
-                    nwamui_debug("Found gtk builder file at : %s", ui_file );
-                    gtk_builder[index]  = new_builder;
-                    g_free (ui_file);
-                    break;
-                }
-                else if ( err ) {
-                    nwamui_warning("Error loading glade file : %s", err->message);
-                    g_error_free(err);
-                    err = NULL;
-                }
-                g_free (ui_file);
-                /* Now try without it */
-                ui_file = g_build_filename (sys_data_dirs[i], nwamui_ui_file_names[index], NULL );
-                nwamui_debug("Attempting to load : %s", ui_file);
-                if ( (gtk_builder_add_from_file(new_builder, ui_file, &err )) != 0 ) {
-                    nwamui_debug("Found gtk builder file at : %s", ui_file );
-                    gtk_builder[index]  = new_builder;
-                    g_free (ui_file);
-                    break;
-                }
-                else if ( err ) {
-                    nwamui_warning("Error loading glade file : %s", err->message);
-                    g_error_free(err);
-                    err = NULL;
-                }
+        data->object_depth++;
+    } else if (strcmp(element_name, "property") == 0 && data->toplevel != NULL) {
+        data->property = g_string_new(NULL);
+    }
+}
+
+static void
+ui_file_end_element(GMarkupParseContext *context,
+  const gchar *element_name,
+  gpointer user_data,
+  GError **error)
+{
+    ui_file_parse_data_t *data = (ui_file_parse_data_t *)user_data;
+
+    if (strcmp(element_name, "object") == 0) {
+        if (--data->object_depth == 0) {
+            data->toplevel = NULL;
+        }
+    } else if (strcmp(element_name, "property") == 0 && data->property != NULL) {
+        data->refs = g_slist_prepend(data->refs, (gpointer)data->toplevel);
+        data->refs = g_slist_prepend(data->refs, g_strdup(g_strstrip(data->property->str)));
+        g_string_free(data->property, TRUE);
+        data->property = NULL;
+    }
+}
+
+static void
+ui_file_text(GMarkupParseContext *context,
+  const gchar *text,
+  gsize text_len,
+  gpointer user_data,
+  GError **error)
+{
+    ui_file_parse_data_t *data = (ui_file_parse_data_t *)user_data;
+
+    if (data->property != NULL) {
+        g_string_append_len(data->property, text, text_len);
+    }
+}
+
+static gboolean
+ui_file_index(nwamui_ui_file_t *ui, GError **error)
+{
+    static const GMarkupParser parser = {
+        ui_file_start_element,
+        ui_file_end_element,
+        ui_file_text,
+        NULL,
+        NULL
+    };
+    ui_file_parse_data_t  data = { ui, 0, NULL, NULL, NULL };
+    GMarkupParseContext  *context;
+    gboolean              ret;
+
+    context = g_markup_parse_context_new(&parser, 0, &data, NULL);
+    ret = g_markup_parse_context_parse(context, ui->buffer, ui->length, error) &&
+      g_markup_parse_context_end_parse(context, error);
+    g_markup_parse_context_free(context);
+
+    /* A property whose value is the id of another toplevel refers to it. */
+    while (data.refs != NULL) {
+        gchar       *value    = data.refs->data;
+        const gchar *toplevel = data.refs->next->data;
+        const gchar *target   = g_hash_table_lookup(ui->toplevel_of, value);
+
+        if (target != NULL && strcmp(target, value) == 0 && target != toplevel) {
+            GSList *deps = g_hash_table_lookup(ui->deps_of, toplevel);
+
+            if (g_slist_find(deps, target) == NULL) {
+                g_hash_table_insert(ui->deps_of, (gpointer)toplevel, g_slist_prepend(deps, (gpointer)target));
+            }
+        }
+        g_free(value);
+        data.refs = g_slist_delete_link(data.refs, data.refs);
+        data.refs = g_slist_delete_link(data.refs, data.refs);
+    }
+    if (data.property != NULL) {
+        g_string_free(data.property, TRUE);
+    }
+    return ret;
+}
+
+static void
+ui_file_free_deps(gpointer key, gpointer value, gpointer user_data)
+{
+    g_slist_free((GSList *)value);
+}
+
+static void
+ui_file_free(nwamui_ui_file_t *ui)
+{
+    g_hash_table_foreach(ui->deps_of, ui_file_free_deps, NULL);
+    g_hash_table_destroy(ui->deps_of);
+    g_hash_table_destroy(ui->toplevel_of);
+    g_string_chunk_free(ui->ids);
+    if (ui->builder) {
+        g_object_unref(ui->builder);
+    }
+    g_free(ui->buffer);
+    g_free(ui);
+}
+
+/* Look in the build data dir first, then the system ones, each with and
+ * without the package name.
+ */
+static gchar*
+ui_file_find(const gchar *name)
+{
+    static const gchar  *build_datadir = NWAM_MANAGER_DATADIR;
+    const gchar * const *sys_data_dirs = g_get_system_data_dirs();
+    gchar               *ui_file;
+    gint                 i = -1;
+
+    for (ui_file = NULL; ui_file == NULL; i++) {
+        const gchar *dir = i < 0 ? build_datadir : sys_data_dirs[i];
+
+        if (dir == NULL) {
+            break;
+        }
+        ui_file = g_build_filename(dir, PACKAGE, name, NULL);
+        nwamui_debug("Attempting to load : %s", ui_file);
+        if (!g_file_test(ui_file, G_FILE_TEST_IS_REGULAR)) {
+            g_free(ui_file);
+            ui_file = g_build_filename(dir, name, NULL);
+            nwamui_debug("Attempting to load : %s", ui_file);
+            if (!g_file_test(ui_file, G_FILE_TEST_IS_REGULAR)) {
+                g_free(ui_file);
+                ui_file = NULL;
             }
         }
+    }
+    return ui_file;
+}
+
+static nwamui_ui_file_t*
+get_ui_file( nwamui_ui_file_index_t index )
+{
+    nwamui_ui_file_t *ui;
+    gchar            *ui_file;
+    GError           *err = NULL;
+
+    if (ui_files[index] != NULL) {
+        return ui_files[index];
+    }
+
+    if ((ui_file = ui_file_find(nwamui_ui_file_names[index])) == NULL) {
+        nwamui_error("Error locating UI file %s", nwamui_ui_file_names[index] );
+        return NULL;
+    }
+
+    nwamui_trace_begin("get_ui_file");
+
+    ui = g_new0(nwamui_ui_file_t, 1);
+    ui->ids = g_string_chunk_new(1024);
+    ui->toplevel_of = g_hash_table_new(g_str_hash, g_str_equal);
+    ui->deps_of = g_hash_table_new(g_str_hash, g_str_equal);
+
+    if (!g_file_get_contents(ui_file, &ui->buffer, &ui->length, &err) ||
+      !ui_file_index(ui, &err)) {
+        nwamui_warning("Error loading glade file : %s", err->message);
+        g_error_free(err);
+        ui_file_free(ui);
+        ui = NULL;
+        goto L_exit;
+    }
+
+    nwamui_debug("Found gtk builder file at : %s", ui_file );
+    ui->builder = gtk_builder_new();
+    ui_files[index] = ui;
+
+L_exit:
+    nwamui_trace_end("get_ui_file");
+    g_free(ui_file);
+    return ui;
+}
+
+/* Build toplevel and the toplevels it refers to, unless already built. */
+static gboolean
+ui_file_build_toplevel(nwamui_ui_file_t *ui, const gchar *toplevel)
+{
+    gchar      *ids[] = { (gchar *)toplevel, NULL };
+    GSList     *deps;
+    GError     *err = NULL;
+    gboolean    ret = TRUE;
+
+    if (gtk_builder_get_object(ui->builder, toplevel) != NULL) {
+        return TRUE;
+    }
+
+    for (deps = g_hash_table_lookup(ui->deps_of, toplevel); deps; deps = g_slist_next(deps)) {
+        if (!ui_file_build_toplevel(ui, deps->data)) {
+            return FALSE;
+        }
+    }
 
-        if ( gtk_builder[index]  == NULL ) {
-            nwamui_error("Error locating UI file %s", nwamui_ui_file_names[index] );
-            g_object_unref( new_builder );
+    nwamui_trace_begin("ui_file_build_toplevel");
+    if (gtk_builder_add_objects_from_string(ui->builder, ui->buffer, ui->length, ids, &err) == 0) {
+        nwamui_warning("Error building %s : %s", toplevel, err->message);
+        g_error_free(err);
+        ret = FALSE;
+    } else {
+        nwamui_debug("Built %s", toplevel);
+
+        /* Nothing left to build from the file, drop our copy of it. */
+        if (--ui->unbuilt == 0) {
+            g_free(ui->buffer);
+            ui->buffer = NULL;
+            ui->length = 0;
         }
     }
-    return gtk_builder[index];
+    nwamui_trace_end("ui_file_build_toplevel");
+
+    return ret;
 }
 
 /**
@@ -165,26 +342,33 @@ get_gtk_builder( nwamui_ui_file_index_t index ) {
  * @widget_name: name of the widget to load.
  * @returns: the widget loaded from the GktBuilder file.
  *
+ * The toplevel holding the widget is built on first use.
  **/
 extern GtkWidget*
 nwamui_util_ui_get_widget_from( nwamui_ui_file_index_t index,  const gchar* widget_name ) 
 {
-    GtkBuilder* builder;;
-    GtkWidget*  widget;
+    nwamui_ui_file_t   *ui;
+    GObject            *widget;
 
     g_assert( widget_name != NULL );
     
     g_return_val_if_fail( widget_name != NULL, NULL );
     
-    builder = get_gtk_builder( index );
-    g_return_val_if_fail( builder != NULL, NULL );
+    ui = get_ui_file( index );
+    g_return_val_if_fail( ui != NULL, NULL );
     
-    widget = GTK_WIDGET(gtk_builder_get_object(builder, widget_name ));
+    if ((widget = gtk_builder_get_object(ui->builder, widget_name)) == NULL) {
+        const gchar *toplevel = g_hash_table_lookup(ui->toplevel_of, widget_name);
+
+        if (toplevel != NULL && ui_file_build_toplevel(ui, toplevel)) {
+            widget = gtk_builder_get_object(ui->builder, widget_name);
+        }
+    }
     
     if ( widget == NULL )
         g_error("Failed to get widget by name %s", widget_name );
     
-    return widget;
+    return GTK_WIDGET(widget);
 }
         
 static gboolean _debug = FALSE;
@@ -380,6 +564,57 @@ static gint             normal_icon_size = -1;
 static gint             theme_changed_id = -1;
 static GtkIconTheme*    icon_theme = NULL;
 
+/* Loaded and composed icons, see ICON_CACHE_KEY. Dropped when the icon theme
+ * changes, so callers can ask for an icon on every animation frame.
+ */
+static GHashTable*      icon_cache = NULL;
+
+enum {
+    ICON_KIND_NETWORK_STATUS = 1,
+    ICON_KIND_WIRELESS_STRENGTH,
+    ICON_KIND_NETWORK_TYPE,
+    ICON_KIND_NETWORK_SECURITY
+};
+
+/* 6 bits for each of the three kind specific values and the size index. */
+#define ICON_CACHE_KEY(kind, a, b, c, size_idx)                         \
+    GUINT_TO_POINTER(((guint)(kind) << 24) | ((guint)(a) << 18) |       \
+      ((guint)(b) << 12) | ((guint)(c) << 6) | (guint)(size_idx))
+
+static GdkPixbuf*
+icon_cache_lookup(gpointer key)
+{
+    if (icon_cache == NULL) {
+        return NULL;
+    }
+    return GDK_PIXBUF(g_hash_table_lookup(icon_cache, key));
+}
+
+/* Takes the reference of pixbuf, returns a new reference. */
+static GdkPixbuf*
+icon_cache_insert(gpointer key, GdkPixbuf *pixbuf)
+{
+    if (pixbuf == NULL) {
+        return NULL;
+    }
+    if (icon_cache == NULL) {
+        icon_cache = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+          NULL, (GDestroyNotify)g_object_unref);
+    }
+    g_hash_table_replace(icon_cache, key, pixbuf);
+    return GDK_PIXBUF(g_object_ref(pixbuf));
+}
+
+/* Map a pixel size to one of the 16, 24, 32 and 48 buckets. */
+static gint
+icon_size_index(gint *size)
+{
+    if (*size <= 16) {*size = 16; return 0;}
+    else if (*size <= 24) {*size = 24; return 1;}
+    else if (*size <= 32) {*size = 32; return 2;}
+    else {*size = 48; return 3;}
+}
+
 static void
 icon_theme_changed ( GtkIconTheme  *_icon_theme, gpointer data )
 {
@@ -398,6 +633,10 @@ icon_theme_changed ( GtkIconTheme  *_icon_theme, gpointer data )
     /* Invalidate known sizes now */
     small_icon_size = -1;
     normal_icon_size = -1;
+
+    if (icon_cache) {
+        g_hash_table_remove_all(icon_cache);
+    }
 }
 
 static GdkPixbuf*   
@@ -442,72 +681,6 @@ get_pixbuf( const gchar* stock_id, gboolean small )
     return (get_pixbuf_with_size( stock_id, small?small_icon_size:normal_icon_size ));
 }
 
-struct info_for_env_status_icon {
-    gint   activate_wired_num;
-    gint   activate_wireless_num;
-    gint   average_signal_strength;
-    gint64 ncp_prio;
-};
-
-extern gint
-foreach_gather_info_for_env_status_icon_from_ncp(gconstpointer data, gconstpointer user_data)
-{
-	NwamuiNcu                       *ncu            = (NwamuiNcu *)data;
-    struct info_for_env_status_icon *info           = (struct info_for_env_status_icon *)user_data;
-    gint64                           ncu_prio;
-    gint                             found_excl_ncu = 1;
-	
-    g_return_val_if_fail(NWAMUI_IS_NCU(ncu), 1);
-    g_return_val_if_fail(info, 0);
-    
-    ncu_prio = nwamui_ncu_get_priority_group(ncu);
-
-    /* Only care about current prio ncus, and first exclusive NCU
-     * that's in UP state 
-     */
-    if ( ncu_prio == info->ncp_prio) {
-        if (nwamui_object_get_active(NWAMUI_OBJECT(ncu))) {
-            nwam_state_t            state;
-            nwam_aux_state_t        aux_state;
-            nwamui_cond_activation_mode_t 
-              activation_mode;
-            nwamui_cond_priority_group_mode_t 
-              prio_group_mode;
-                    
-            state = nwamui_object_get_nwam_state( NWAMUI_OBJECT(ncu), &aux_state, NULL);
-            activation_mode = nwamui_object_get_activation_mode(NWAMUI_OBJECT(ncu));
-            prio_group_mode = nwamui_ncu_get_priority_group_mode( ncu );
-
-            if ( activation_mode == NWAMUI_COND_ACTIVATION_MODE_PRIORITIZED ) {
-                if ( prio_group_mode == NWAMUI_COND_PRIORITY_GROUP_MODE_EXCLUSIVE ) {
-                    if ( state == NWAM_STATE_ONLINE && aux_state == NWAM_AUX_STATE_UP ) {
-                        /* Stop here. */
-                        found_excl_ncu = 0;
-                    }
-                }
-            }
-
-            switch(nwamui_ncu_get_ncu_type(ncu)) {
-#ifdef TUNNEL_SUPPORT
-            case NWAMUI_NCU_TYPE_TUNNEL:
-#endif /* TUNNEL_SUPPORT */
-            case NWAMUI_NCU_TYPE_WIRED:
-                info->activate_wired_num++;
-                break;
-            case NWAMUI_NCU_TYPE_WIRELESS:
-                info->activate_wireless_num++;
-                info->average_signal_strength += nwamui_ncu_get_wifi_signal_strength(ncu);
-                break;
-            default:
-                g_assert_not_reached();
-                break;
-            }
-        }
-    }
-
-    return found_excl_ncu;
-}
-
 /* 
  * Returns a GdkPixbuf that reflects the status of the overall environment
  * If force_size equals 0, uses the size of status icon.
@@ -515,9 +688,8 @@ foreach_gather_info_for_env_status_icon_from_ncp(gconstpointer data, gconstpoint
 extern GdkPixbuf*
 nwamui_util_get_env_status_icon( GtkStatusIcon* status_icon, nwamui_daemon_status_t daemon_status, gint force_size )
 {
-    struct info_for_env_status_icon info;
+    nwamui_ncp_status_info_t        info;
     nwamui_ncu_type_t               ncu_type;
-    nwamui_connection_state_t       connection_state = NWAMUI_STATE_UNKNOWN;
 
     if (force_size == 0) {
         if (status_icon != NULL && gtk_status_icon_is_embedded(status_icon)) {
@@ -533,19 +705,17 @@ nwamui_util_get_env_status_icon( GtkStatusIcon* status_icon, nwamui_daemon_statu
 
         g_object_unref(daemon);
 
-        if ( ncp ) {
-            /* Clean */
-            bzero(&info, sizeof(info));
+        /* Clean */
+        bzero(&info, sizeof(info));
 
-            info.ncp_prio = nwamui_ncp_get_prio_group(NWAMUI_NCP(ncp));
-            nwamui_ncp_find_ncu(NWAMUI_NCP(ncp), foreach_gather_info_for_env_status_icon_from_ncp, &info);
+        if ( ncp ) {
+            nwamui_ncp_get_status_info(NWAMUI_NCP(ncp), &info);
             g_object_unref(ncp);
         }
     }
 
-    if (info.activate_wireless_num > 0) {
+    if (info.active_wireless_num > 0) {
         ncu_type = NWAMUI_NCU_TYPE_WIRELESS;
-        info.average_signal_strength /= info.activate_wireless_num;
     } else {
         ncu_type = NWAMUI_NCU_TYPE_WIRED;
         info.average_signal_strength = NWAMUI_WIFI_STRENGTH_NONE;
@@ -563,23 +733,26 @@ nwamui_util_get_env_status_icon( GtkStatusIcon* status_icon, nwamui_daemon_statu
 extern GdkPixbuf*
 nwamui_util_get_network_type_icon( nwamui_ncu_type_t ncu_type )
 {
-        static GdkPixbuf       *wireless_icon = NULL;
-        static GdkPixbuf       *wired_icon = NULL;
+        gpointer                key;
+        GdkPixbuf              *icon;
 
-        if ( wireless_icon == NULL ) {
-            wireless_icon = get_pixbuf("network-wireless", FALSE);
+        if (ncu_type != NWAMUI_NCU_TYPE_WIRELESS) {
+            ncu_type = NWAMUI_NCU_TYPE_WIRED;
         }
-        if (wired_icon == NULL ) {
-            wired_icon = get_pixbuf("network-idle", FALSE);
+
+        key = ICON_CACHE_KEY(ICON_KIND_NETWORK_TYPE, ncu_type, 0, 0, 0);
+
+        if ((icon = icon_cache_lookup(key)) != NULL) {
+            return( GDK_PIXBUF(g_object_ref(G_OBJECT(icon))) );
         }
-        
+
         switch (ncu_type) {
             case NWAMUI_NCU_TYPE_WIRELESS:
-                return( GDK_PIXBUF(g_object_ref(G_OBJECT(wireless_icon) )) );
+                return icon_cache_insert(key, get_pixbuf("network-wireless", FALSE));
             case NWAMUI_NCU_TYPE_WIRED: 
                 /* Fall-through */
             default:
-                return( GDK_PIXBUF(g_object_ref(G_OBJECT(wired_icon) )) );
+                return icon_cache_insert(key, get_pixbuf("network-idle", FALSE));
         }
 }
        
@@ -589,15 +762,9 @@ nwamui_util_get_network_type_icon( nwamui_ncu_type_t ncu_type )
 extern GdkPixbuf*
 nwamui_util_get_network_security_icon( nwamui_wifi_security_t sec_type, gboolean small )
 {
-    static GdkPixbuf       *secured_icon = NULL;
-    static GdkPixbuf       *open_icon = NULL;
-
-    if ( secured_icon == NULL ) {
-        secured_icon = get_pixbuf(NWAM_ICON_NETWORK_SECURE, small);
-    }
-    if ( open_icon == NULL ) {
-        open_icon = get_pixbuf(NWAM_ICON_NETWORK_INSECURE, small);
-    }
+    gboolean                secured;
+    gpointer                key;
+    GdkPixbuf              *icon;
 
     switch (sec_type) {
 #ifdef WEP_ASCII_EQ_HEX 
@@ -608,12 +775,23 @@ nwamui_util_get_network_security_icon( nwamui_wifi_security_t sec_type, gboolean
 #endif /* WEP_ASCII_EQ_HEX */
         /* case NWAMUI_WIFI_SEC_WPA_ENTERPRISE: - Currently not supported */
         case NWAMUI_WIFI_SEC_WPA_PERSONAL:
-            return( GDK_PIXBUF(g_object_ref(G_OBJECT(secured_icon) )) );
+            secured = TRUE;
+            break;
         case NWAMUI_WIFI_SEC_NONE: 
             /* Fall-through */
         default:
-            return( GDK_PIXBUF(g_object_ref(G_OBJECT(open_icon) )) );
+            secured = FALSE;
+            break;
     }
+
+    key = ICON_CACHE_KEY(ICON_KIND_NETWORK_SECURITY, secured, 0, 0, small ? 1 : 0);
+
+    if ((icon = icon_cache_lookup(key)) != NULL) {
+        return( GDK_PIXBUF(g_object_ref(G_OBJECT(icon))) );
+    }
+
+    return icon_cache_insert(key,
+      get_pixbuf(secured ? NWAM_ICON_NETWORK_SECURE : NWAM_ICON_NETWORK_INSECURE, small));
 }
        
 /* 
@@ -625,67 +803,64 @@ nwamui_util_get_network_status_icon(nwamui_ncu_type_t ncu_type,
   nwamui_daemon_status_t daemon_status,
   gint size)
 {
-    static GdkPixbuf*   network_status_icons[NWAMUI_DAEMON_STATUS_LAST][NWAMUI_NCU_TYPE_LAST][NWAMUI_WIFI_STRENGTH_LAST][4] = {NULL};
-
     GdkPixbuf* env_status_icon = NULL;
+    GdkPixbuf* inf_icon = NULL;
+    GdkPixbuf* temp_icon = NULL;
     gchar *stock_id = NULL;
     gint icon_size;
+    gpointer key;
 
     g_return_val_if_fail(ncu_type < NWAMUI_NCU_TYPE_LAST, NULL);
     g_return_val_if_fail(daemon_status < NWAMUI_DAEMON_STATUS_LAST, NULL);
     g_return_val_if_fail(strength < NWAMUI_WIFI_STRENGTH_LAST, NULL);
 
-    if (size <= 16) {size = 16; icon_size = 0;}
-    else if (size <= 24) {size = 24; icon_size = 1;}
-    else if (size <= 32) {size = 32; icon_size = 2;}
-    else {size = 48; icon_size = 3;}
+    icon_size = icon_size_index(&size);
 
 /*     g_debug("%s: returning icon for status = %d; ncu_type = %d, signal = %d; size = %d", __func__,  */
 /*             daemon_status, ncu_type, strength, size ); */
 
-    if (network_status_icons[daemon_status][ncu_type][strength][icon_size] == NULL ) {
-        GdkPixbuf* inf_icon = NULL;
-        GdkPixbuf* temp_icon = NULL;
+    key = ICON_CACHE_KEY(ICON_KIND_NETWORK_STATUS, daemon_status, ncu_type, strength, icon_size);
+
+    if ((inf_icon = icon_cache_lookup(key)) != NULL) {
+        return(GDK_PIXBUF(g_object_ref(inf_icon)));
+    }
 
-        switch(ncu_type) {
+    switch(ncu_type) {
 #ifdef TUNNEL_SUPPORT
-        case NWAMUI_NCU_TYPE_TUNNEL:
+    case NWAMUI_NCU_TYPE_TUNNEL:
 #endif /* TUNNEL_SUPPORT */
-        case NWAMUI_NCU_TYPE_WIRED:
-            temp_icon = get_pixbuf_with_size(NWAM_ICON_NETWORK_WIRED, size);
-            break;
-        case NWAMUI_NCU_TYPE_WIRELESS:
-            temp_icon = nwamui_util_get_wireless_strength_icon_with_size(strength, NWAMUI_WIRELESS_ICON_TYPE_RADAR, size);
-            break;
-        default:
-            g_assert_not_reached();
-        }
-
-        inf_icon = gdk_pixbuf_copy(temp_icon);
-        g_object_unref(temp_icon);
+    case NWAMUI_NCU_TYPE_WIRED:
+        temp_icon = get_pixbuf_with_size(NWAM_ICON_NETWORK_WIRED, size);
+        break;
+    case NWAMUI_NCU_TYPE_WIRELESS:
+        temp_icon = nwamui_util_get_wireless_strength_icon_with_size(strength, NWAMUI_WIRELESS_ICON_TYPE_RADAR, size);
+        break;
+    default:
+        g_assert_not_reached();
+    }
 
-        switch( daemon_status ) {
-        case NWAMUI_DAEMON_STATUS_ALL_OK:
-            stock_id = NWAM_ICON_CONNECTED;
-            break;
-        case NWAMUI_DAEMON_STATUS_NEEDS_ATTENTION:
-            stock_id = NWAM_ICON_WARNING;
-            break;
-        case NWAMUI_DAEMON_STATUS_ERROR:
-            stock_id = NWAM_ICON_ERROR;
-            break;
-        default:
-            g_assert_not_reached();
-            break;
-        }
-        env_status_icon = get_pixbuf_with_size(stock_id, size);
-        PIXBUF_COMPOSITE_NO_SCALE(env_status_icon, inf_icon);
-        g_object_unref(env_status_icon);
+    inf_icon = gdk_pixbuf_copy(temp_icon);
+    g_object_unref(temp_icon);
 
-        network_status_icons[daemon_status][ncu_type][strength][icon_size] = inf_icon;
+    switch( daemon_status ) {
+    case NWAMUI_DAEMON_STATUS_ALL_OK:
+        stock_id = NWAM_ICON_CONNECTED;
+        break;
+    case NWAMUI_DAEMON_STATUS_NEEDS_ATTENTION:
+        stock_id = NWAM_ICON_WARNING;
+        break;
+    case NWAMUI_DAEMON_STATUS_ERROR:
+        stock_id = NWAM_ICON_ERROR;
+        break;
+    default:
+        g_assert_not_reached();
+        break;
     }
+    env_status_icon = get_pixbuf_with_size(stock_id, size);
+    PIXBUF_COMPOSITE_NO_SCALE(env_status_icon, inf_icon);
+    g_object_unref(env_status_icon);
 
-    return(GDK_PIXBUF(g_object_ref(network_status_icons[daemon_status][ncu_type][strength][icon_size])));
+    return icon_cache_insert(key, inf_icon);
 }
 
 extern GdkPixbuf*
@@ -772,95 +947,61 @@ nwamui_util_get_wireless_strength_icon_with_size( nwamui_wifi_signal_strength_t
                                                   nwamui_wireless_icon_type_t icon_type,
                                                   gint size)
 {
-    static GdkPixbuf*   enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_LAST][NWAMUI_WIRELESS_ICON_TYPE_LAST][4];
+    /* Mapping : NONE = NONE, VERY_WEAK = POOR, WEAK = FAIR, GOOD = GOOD,
+     * VERY_GOOD = GOOD, EXCELLENT = EXCELLENT
+     */
+    static const gchar* radar_icons[NWAMUI_WIFI_STRENGTH_LAST] = {
+        NWAM_RADAR_ICON_WIRELESS_STRENGTH_NONE,
+        NWAM_RADAR_ICON_WIRELESS_STRENGTH_POOR,
+        NWAM_RADAR_ICON_WIRELESS_STRENGTH_FAIR,
+        NWAM_RADAR_ICON_WIRELESS_STRENGTH_GOOD,
+        NWAM_RADAR_ICON_WIRELESS_STRENGTH_GOOD,
+        NWAM_RADAR_ICON_WIRELESS_STRENGTH_EXCELLENT
+    };
+    /* Mapping : NONE = NONE, VERY_WEAK = POOR, WEAK = POOR, GOOD = FAIR,
+     * VERY_GOOD = GOOD, EXCELLENT = EXCELLENT
+     */
+    static const gchar* bar_icons[NWAMUI_WIFI_STRENGTH_LAST] = {
+        NWAM_BAR_ICON_WIRELESS_STRENGTH_NONE,
+        NWAM_BAR_ICON_WIRELESS_STRENGTH_POOR,
+        NWAM_BAR_ICON_WIRELESS_STRENGTH_POOR,
+        NWAM_BAR_ICON_WIRELESS_STRENGTH_FAIR,
+        NWAM_BAR_ICON_WIRELESS_STRENGTH_GOOD,
+        NWAM_BAR_ICON_WIRELESS_STRENGTH_EXCELLENT
+    };
+    GdkPixbuf* wireless_strength_icon = NULL;
+    GdkPixbuf* composed_icon = NULL;
     gint icon_size;
+    gpointer key;
 
-    if (size <= 16) {size = 16; icon_size = 0;}
-    else if (size <= 24) {size = 24; icon_size = 1;}
-    else if (size <= 32) {size = 32; icon_size = 2;}
-    else {size = 48; icon_size = 3;}
-
-    if ( enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_NONE][NWAMUI_WIRELESS_ICON_TYPE_RADAR][icon_size] == NULL ) {
-        GdkPixbuf* inf_icon = NULL;
-        GdkPixbuf* wireless_strength_icon = NULL;
-        GdkPixbuf* composed_icon = NULL;
-
-        /* Basic interface icon. */
-/*         inf_icon = gdk_pixbuf_new(GDK_COLORSPACE_RGB, */
-/*           TRUE, */
-/*           8, */
-/*           24, */
-/*           24); */
-
-        /* Create Composed RADAR icons */
+    g_return_val_if_fail(signal_strength < NWAMUI_WIFI_STRENGTH_LAST, NULL);
+    g_return_val_if_fail(icon_type < NWAMUI_WIRELESS_ICON_TYPE_LAST, NULL);
 
-        inf_icon = get_pixbuf_with_size(NWAM_ICON_NETWORK_WIRELESS, size);
-/*         size = (size - 16)/2 + 16; */
-
-        /* Compose icon. */
-        composed_icon = gdk_pixbuf_copy(inf_icon);
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_RADAR_ICON_WIRELESS_STRENGTH_NONE, size);
-        PIXBUF_COMPOSITE_NO_SCALE(wireless_strength_icon, composed_icon);
-        g_object_unref(wireless_strength_icon);
-
-        /* Mapping : NONE = NONE */
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_NONE][NWAMUI_WIRELESS_ICON_TYPE_RADAR][icon_size] = composed_icon;
-          
-        composed_icon = gdk_pixbuf_copy(inf_icon);
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_RADAR_ICON_WIRELESS_STRENGTH_POOR, size);
-        PIXBUF_COMPOSITE_NO_SCALE(wireless_strength_icon, composed_icon);
-        g_object_unref(wireless_strength_icon);
+    icon_size = icon_size_index(&size);
 
-        /* Mapping : VERY_WEAK = POOR */
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_VERY_WEAK][NWAMUI_WIRELESS_ICON_TYPE_RADAR][icon_size] = composed_icon;
+    key = ICON_CACHE_KEY(ICON_KIND_WIRELESS_STRENGTH, signal_strength, icon_type, 0, icon_size);
 
-        composed_icon = gdk_pixbuf_copy(inf_icon);
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_RADAR_ICON_WIRELESS_STRENGTH_FAIR, size);
-        PIXBUF_COMPOSITE_NO_SCALE(wireless_strength_icon, composed_icon);
-        g_object_unref(wireless_strength_icon);
+    if ((composed_icon = icon_cache_lookup(key)) != NULL) {
+        return( GDK_PIXBUF(g_object_ref( G_OBJECT(composed_icon) )) );
+    }
 
-        /* Mapping : WEAK = FAIR */
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_WEAK][NWAMUI_WIRELESS_ICON_TYPE_RADAR][icon_size] = composed_icon;
+    if (icon_type == NWAMUI_WIRELESS_ICON_TYPE_RADAR) {
+        GdkPixbuf* inf_icon = NULL;
 
+        /* Composed RADAR icon over the basic interface icon. */
+        inf_icon = get_pixbuf_with_size(NWAM_ICON_NETWORK_WIRELESS, size);
         composed_icon = gdk_pixbuf_copy(inf_icon);
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_RADAR_ICON_WIRELESS_STRENGTH_GOOD, size);
-        PIXBUF_COMPOSITE_NO_SCALE(wireless_strength_icon, composed_icon);
-        g_object_unref(wireless_strength_icon);
-
-        /* Mapping : GOOD = GOOD */
-        /* Mapping : VERY_GOOD = GOOD */
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_GOOD][NWAMUI_WIRELESS_ICON_TYPE_RADAR][icon_size] = composed_icon;
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_VERY_GOOD][NWAMUI_WIRELESS_ICON_TYPE_RADAR][icon_size]= g_object_ref(composed_icon);
+        g_object_unref(inf_icon);
 
-        composed_icon = gdk_pixbuf_copy(inf_icon);
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_RADAR_ICON_WIRELESS_STRENGTH_EXCELLENT, size);
+        wireless_strength_icon = get_pixbuf_with_size(radar_icons[signal_strength], size);
         PIXBUF_COMPOSITE_NO_SCALE(wireless_strength_icon, composed_icon);
         g_object_unref(wireless_strength_icon);
-
-        /* Mapping : EXCELLENT = EXCELLENT */
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_EXCELLENT][NWAMUI_WIRELESS_ICON_TYPE_RADAR][icon_size]= composed_icon;
-
-        g_object_unref(inf_icon);
-
-        /* Create simpler Bar Icons */
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_BAR_ICON_WIRELESS_STRENGTH_NONE, size);
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_NONE][NWAMUI_WIRELESS_ICON_TYPE_BARS][icon_size] = wireless_strength_icon;
-          
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_BAR_ICON_WIRELESS_STRENGTH_POOR, size);
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_VERY_WEAK][NWAMUI_WIRELESS_ICON_TYPE_BARS][icon_size] = wireless_strength_icon;
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_WEAK][NWAMUI_WIRELESS_ICON_TYPE_BARS][icon_size] = g_object_ref(wireless_strength_icon);
-
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_BAR_ICON_WIRELESS_STRENGTH_FAIR, size);
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_GOOD][NWAMUI_WIRELESS_ICON_TYPE_BARS][icon_size] = wireless_strength_icon;
-
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_BAR_ICON_WIRELESS_STRENGTH_GOOD, size);
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_VERY_GOOD][NWAMUI_WIRELESS_ICON_TYPE_BARS][icon_size]= wireless_strength_icon;
-
-        wireless_strength_icon = get_pixbuf_with_size(NWAM_BAR_ICON_WIRELESS_STRENGTH_EXCELLENT, size);
-        enabled_wireless_icons[NWAMUI_WIFI_STRENGTH_EXCELLENT][NWAMUI_WIRELESS_ICON_TYPE_BARS][icon_size]= wireless_strength_icon;
+    } else {
+        /* Simpler Bar Icons */
+        composed_icon = get_pixbuf_with_size(bar_icons[signal_strength], size);
     }
 
-    return( GDK_PIXBUF(g_object_ref( G_OBJECT(enabled_wireless_icons[signal_strength][icon_type][icon_size]) )) );
+    return icon_cache_insert(key, composed_icon);
 }
 
 /* 
@@ -1275,7 +1416,7 @@ nwamui_util_map_object_list_to_condition_strings( GList* conditions, guint *len
             if ( cond_str != NULL ) {
                 cond_strs[*len] = strdup( cond_str );
                 *len = *len + 1;
-                g_free(cond_str);
+                free(cond_str);
             }
         }
         elem = g_list_next(elem);
@@ -1756,76 +1897,54 @@ nwamui_util_get_interface_address(const char *ifname, sa_family_t family,
     return FALSE;
 }
 
+/* Completion only ever shows this many rows, so don't look up more. */
+#define SMF_COMPLETION_MAX_RESULTS  (12)
+#define SMF_COMPLETION_MIN_KEY      (3)
+
 static void
-foreach_service( GFunc callback, gpointer user_data )
-{
-    scf_handle_t   *handle = scf_handle_create( SCF_VERSION );
-	ssize_t         max_scf_name_length = scf_limit(SCF_LIMIT_MAX_NAME_LENGTH);
-	ssize_t         max_scf_fmri_length = scf_limit(SCF_LIMIT_MAX_FMRI_LENGTH);
-    scf_scope_t    *scope = scf_scope_create( handle );
-    scf_service_t  *service = scf_service_create( handle );
-    scf_instance_t *instance = scf_instance_create( handle );
-    scf_iter_t     *svc_iter = scf_iter_create(handle);
-    scf_iter_t     *inst_iter = scf_iter_create(handle);
-    char           *name = malloc( max_scf_name_length + 1 );
-    char           *sname = malloc( max_scf_name_length + 1 );
-    char           *fmri = malloc( max_scf_fmri_length + 1 );
-
-
-    if ( !handle  || !scope  || !service  || !instance || !svc_iter || !inst_iter ) {
-        g_warning("Couldn't allocation SMF handles" );
-        return;
-    }
+smf_completion_update( GtkEntry* entry )
+{
+    GtkEntryCompletion *completion = gtk_entry_get_completion( entry );
+    GtkListStore       *lstore;
+    const gchar        *key = gtk_entry_get_text( entry );
+    GList              *fmris = NULL;
+    GList              *elem;
 
-    if (scf_handle_bind(handle) == -1 ) {
-        g_warning("Couldn't bind to smf service: %s\n", scf_strerror(scf_error()) );
-        scf_handle_destroy( handle );
+    if ( completion == NULL ) {
         return;
     }
+    lstore = GTK_LIST_STORE(gtk_entry_completion_get_model( completion ));
 
-    if ( scf_handle_get_scope( handle, SCF_SCOPE_LOCAL, scope ) == 0 ) {
-        if ( scf_iter_scope_services( svc_iter, scope ) == 0 ) {
-            int r;
-
-            for ( r = scf_iter_next_service( svc_iter, service );
-                  r == 1;
-                  r = scf_iter_next_service( svc_iter, service ) ) {
-                if( scf_service_get_name( service, sname, max_scf_name_length + 1) != -1 ) {
-                    if ( scf_iter_service_instances( inst_iter, service ) == 0 ) {
-                        int rv;
-
-                        for ( rv = scf_iter_next_instance( inst_iter, instance );
-                              rv == 1;
-                              rv = scf_iter_next_instance( inst_iter, instance ) ) {
-                            if ( scf_instance_get_name( instance, name, max_scf_name_length + 1) != -1 ) {
-                                if ( callback != NULL ) {
-                                    snprintf( fmri, max_scf_fmri_length, "svc:/%s:%s", sname, name );
-                                    (*callback)( (gpointer)fmri, (gpointer)user_data );
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
+    if ( key != NULL && strlen(key) >= SMF_COMPLETION_MIN_KEY ) {
+        fmris = nwamui_smf_cache_complete( key, SMF_COMPLETION_MAX_RESULTS );
     }
 
-    scf_handle_destroy( handle );
+    gtk_list_store_clear( lstore );
+    for ( elem = fmris; elem != NULL; elem = g_list_next(elem) ) {
+        GtkTreeIter iter;
 
-    free(name);
-    free(sname);
-    free(fmri);
+        gtk_list_store_insert_with_values( lstore, &iter, -1, 0, (gchar*)elem->data, -1 );
+        g_free(elem->data);
+    }
+    g_list_free(fmris);
+}
+
+static void
+smf_completion_entry_changed( GtkEditable *editable, gpointer user_data )
+{
+    smf_completion_update( GTK_ENTRY(editable) );
 }
 
 static void
-add_smf_fmri( gpointer data, gpointer user_data )
+smf_completion_index_ready( gpointer user_data )
 {
-    gchar          *name = (gchar*)data;
-    GtkListStore   *lstore = GTK_LIST_STORE(user_data);
-    GtkTreeIter     iter;
+    smf_completion_update( GTK_ENTRY(user_data) );
+}
 
-    gtk_list_store_append( lstore, &iter );
-    gtk_list_store_set( lstore, &iter, 0, name, -1 );
+static void
+smf_completion_entry_destroy( GtkObject *object, gpointer user_data )
+{
+    nwamui_smf_cache_remove_hook( GPOINTER_TO_UINT(user_data) );
 }
 
 static gboolean
@@ -1834,49 +1953,50 @@ partial_smf_completion_func(GtkEntryCompletion *completion,
                             GtkTreeIter *iter,
                             gpointer user_data)
 {
-    GtkTreeModel   *model = GTK_TREE_MODEL(user_data);
-    gchar          *name = NULL;
-    gboolean        rval = FALSE;
-
-    gtk_tree_model_get( model, iter, 0, &name, -1 );
-
-    if ( name && g_strstr_len( name, strlen(name), key ) != NULL ) {
-        rval = TRUE;
-    }
-
-    g_free(name);
-
-    return( rval );
+    /* The model only ever holds the matches for the current text. */
+    return( TRUE );
 }
 
 /* 
  * Utility function to attach an FNRI completion support to a GtkEntry.
+ *
+ * The FMRIs come from the shared index built by the SMF cache, matching the
+ * start of the FMRI or of any of its segments, e.g. "network/ss" or "ssh".
  */
 extern gboolean
 nwamui_util_set_entry_smf_fmri_completion( GtkEntry* entry )
 {
-    static GtkListStore    *fmri_model  = NULL;
     GtkEntryCompletion     *completion = NULL;
+    GtkListStore           *lstore;
+    gulong                  hook_id;
 
     if ( entry == NULL || !GTK_IS_ENTRY( entry ) ) {
         return( FALSE );
     }
 
-    if ( fmri_model == NULL ) {
-        fmri_model  = GTK_LIST_STORE(g_object_ref(gtk_list_store_new( 1, G_TYPE_STRING )));
-    }
-
-    foreach_service( add_smf_fmri, fmri_model );
+    lstore = gtk_list_store_new( 1, G_TYPE_STRING );
 
     completion = gtk_entry_completion_new();
 
-    gtk_entry_completion_set_model( completion, GTK_TREE_MODEL(g_object_ref( fmri_model )) );
-    gtk_entry_completion_set_minimum_key_length( completion, 3 );
+    gtk_entry_completion_set_model( completion, GTK_TREE_MODEL(lstore) );
+    gtk_entry_completion_set_minimum_key_length( completion, SMF_COMPLETION_MIN_KEY );
     gtk_entry_completion_set_text_column( completion, 0 );
     gtk_entry_completion_set_inline_completion( completion, FALSE );
-    gtk_entry_completion_set_match_func( completion, partial_smf_completion_func, fmri_model, NULL );
+    gtk_entry_completion_set_match_func( completion, partial_smf_completion_func, NULL, NULL );
+
+    /* Refill the model before the completion filters it. */
+    g_signal_connect( entry, "changed", G_CALLBACK(smf_completion_entry_changed), NULL );
     gtk_entry_set_completion( entry, completion );
 
+    hook_id = nwamui_smf_cache_add_hook( smf_completion_index_ready, (gpointer)entry );
+    g_signal_connect( entry, "destroy", G_CALLBACK(smf_completion_entry_destroy), GUINT_TO_POINTER(hook_id) );
+
+    g_object_unref( completion );
+    g_object_unref( lstore );
+
+    /* Start building the index now, it's ready by the time it's typed in. */
+    nwamui_smf_cache_complete( "", 0 );
+
     return( TRUE );
 }
 
@@ -2479,6 +2599,403 @@ capplet_model_foreach_find_object(GtkTreeModel *model,
 	return data->ret_data != NULL;
 }
 
+/*
+ * Side index of the capplet models, GObject in column 0 -> row. Created on
+ * the first lookup and then kept up to date from the model signals. Each
+ * level of the model is mirrored by a GSequence of rows, so a row is found
+ * from its path, and its path from the row, in O(depth * log n), which is
+ * all the row-inserted, row-deleted and row-changed handlers cost.
+ * rows-reordered rebuilds the one level it gets a new order for. Row
+ * references can't be used, they hold a reference on the model which would
+ * keep it alive from its own data, and every one of them is updated on each
+ * change.
+ */
+#define CAPPLET_MODEL_INDEX_KEY     "capplet_model_index"
+
+typedef struct _capplet_model_row capplet_model_row_t;
+struct _capplet_model_row {
+    GObject             *object;    /* Column 0 as last seen, not ref'd */
+    GtkTreeIter          iter;      /* Only used if the model's iters persist */
+    capplet_model_row_t *parent;
+    GSequence           *children;  /* capplet_model_row_t, NULL if none yet */
+    GSequenceIter       *pos;       /* In parent->children */
+};
+
+typedef struct {
+    GtkTreeModel        *model;     /* Not ref'd, the index is its data */
+    capplet_model_row_t  root;
+    GHashTable          *rows;      /* GObject -> GSList of capplet_model_row_t */
+    gboolean             iters_persist;
+} capplet_model_index_t;
+
+static void capplet_model_index_invalidate(capplet_model_index_t *index);
+
+/* Track that @row now holds @object. An object is briefly in two rows
+ * while a row is dragged, so each object keeps a list of its rows.
+ */
+static void
+capplet_model_row_set_object(capplet_model_index_t *index, capplet_model_row_t *row, GObject *object)
+{
+    GSList *rows;
+
+    if (row->object == object) {
+        return;
+    }
+    if (row->object != NULL) {
+        rows = g_slist_remove(g_hash_table_lookup(index->rows, row->object), row);
+        if (rows != NULL) {
+            g_hash_table_insert(index->rows, row->object, rows);
+        } else {
+            g_hash_table_remove(index->rows, row->object);
+        }
+    }
+    row->object = object;
+    if (object != NULL) {
+        rows = g_slist_prepend(g_hash_table_lookup(index->rows, object), row);
+        g_hash_table_insert(index->rows, object, rows);
+    }
+}
+
+static void
+capplet_model_row_update(capplet_model_index_t *index, capplet_model_row_t *row, GtkTreeIter *iter)
+{
+    GObject *object = NULL;
+
+    row->iter = *iter;
+    gtk_tree_model_get(index->model, iter, 0, &object, -1);
+    capplet_model_row_set_object(index, row, object);
+    if (object) {
+        g_object_unref(object);
+    }
+}
+
+static capplet_model_row_t*
+capplet_model_row_new(capplet_model_row_t *parent, gint pos)
+{
+    capplet_model_row_t *row = g_slice_new0(capplet_model_row_t);
+
+    if (parent->children == NULL) {
+        parent->children = g_sequence_new(NULL);
+    }
+    row->parent = parent;
+    row->pos = g_sequence_insert_before(g_sequence_get_iter_at_pos(parent->children, pos), row);
+    return row;
+}
+
+/* Forget @row and its descendants, the caller unlinks @row. */
+static void
+capplet_model_row_free(capplet_model_index_t *index, capplet_model_row_t *row)
+{
+    if (row->children) {
+        GSequenceIter *i;
+
+        for (i = g_sequence_get_begin_iter(row->children);
+             !g_sequence_iter_is_end(i);
+             i = g_sequence_iter_next(i)) {
+            capplet_model_row_free(index, (capplet_model_row_t *)g_sequence_get(i));
+        }
+        g_sequence_free(row->children);
+        row->children = NULL;
+    }
+    capplet_model_row_set_object(index, row, NULL);
+    if (row != &index->root) {
+        g_slice_free(capplet_model_row_t, row);
+    }
+}
+
+/* Returns NULL if @path isn't in the index, taking @depth indices of it. */
+static capplet_model_row_t*
+capplet_model_row_at_path(capplet_model_index_t *index, GtkTreePath *path, gint depth)
+{
+    capplet_model_row_t *row = &index->root;
+    gint                *indices = gtk_tree_path_get_indices(path);
+    gint                 i;
+
+    for (i = 0; i < depth; i++) {
+        if (row->children == NULL || indices[i] < 0 ||
+          indices[i] >= g_sequence_get_length(row->children)) {
+            return NULL;
+        }
+        row = g_sequence_get(g_sequence_get_iter_at_pos(row->children, indices[i]));
+    }
+    return row;
+}
+
+static GtkTreePath*
+capplet_model_row_get_path(capplet_model_row_t *row)
+{
+    GtkTreePath *path = gtk_tree_path_new();
+
+    for (; row->parent != NULL; row = row->parent) {
+        gtk_tree_path_prepend_index(path, g_sequence_iter_get_position(row->pos));
+    }
+    return path;
+}
+
+/* Fill in @iter for @row, FALSE if the model doesn't have the row. */
+static gboolean
+capplet_model_row_get_iter(capplet_model_index_t *index, capplet_model_row_t *row, GtkTreeIter *iter)
+{
+    GtkTreePath *path;
+    gboolean     ret;
+
+    if (index->iters_persist) {
+        *iter = row->iter;
+        return TRUE;
+    }
+    path = capplet_model_row_get_path(row);
+    ret = gtk_tree_model_get_iter(index->model, iter, path);
+    gtk_tree_path_free(path);
+    return ret;
+}
+
+static void
+capplet_model_index_add_children(capplet_model_index_t *index, capplet_model_row_t *parent, GtkTreeIter *parent_iter)
+{
+    GtkTreeIter iter;
+    gboolean    valid;
+    gint        n = 0;
+
+    for (valid = gtk_tree_model_iter_children(index->model, &iter, parent_iter);
+         valid;
+         valid = gtk_tree_model_iter_next(index->model, &iter)) {
+        capplet_model_row_t *row = capplet_model_row_new(parent, n++);
+
+        capplet_model_row_update(index, row, &iter);
+        capplet_model_index_add_children(index, row, &iter);
+    }
+}
+
+static void
+capplet_model_index_row_changed(GtkTreeModel *model, GtkTreePath *path, GtkTreeIter *iter, gpointer user_data)
+{
+    capplet_model_index_t *index = (capplet_model_index_t *)user_data;
+    capplet_model_row_t   *row;
+
+    if ((row = capplet_model_row_at_path(index, path, gtk_tree_path_get_depth(path))) == NULL) {
+        capplet_model_index_invalidate(index);
+        return;
+    }
+    capplet_model_row_update(index, row, iter);
+}
+
+static void
+capplet_model_index_row_inserted(GtkTreeModel *model, GtkTreePath *path, GtkTreeIter *iter, gpointer user_data)
+{
+    capplet_model_index_t *index = (capplet_model_index_t *)user_data;
+    capplet_model_row_t   *parent;
+    gint                   depth = gtk_tree_path_get_depth(path);
+    gint                   pos = gtk_tree_path_get_indices(path)[depth - 1];
+
+    if ((parent = capplet_model_row_at_path(index, path, depth - 1)) == NULL ||
+      pos > (parent->children ? g_sequence_get_length(parent->children) : 0)) {
+        capplet_model_index_invalidate(index);
+        return;
+    }
+    /* Set by gtk_list_store_insert_with_values(), else in row-changed. */
+    capplet_model_row_update(index, capplet_model_row_new(parent, pos), iter);
+}
+
+static void
+capplet_model_index_row_deleted(GtkTreeModel *model, GtkTreePath *path, gpointer user_data)
+{
+    capplet_model_index_t *index = (capplet_model_index_t *)user_data;
+    capplet_model_row_t   *row;
+
+    if ((row = capplet_model_row_at_path(index, path, gtk_tree_path_get_depth(path))) == NULL) {
+        capplet_model_index_invalidate(index);
+        return;
+    }
+    /* The row and its descendants. */
+    g_sequence_remove(row->pos);
+    capplet_model_row_free(index, row);
+}
+
+static void
+capplet_model_index_rows_reordered(GtkTreeModel *model, GtkTreePath *path, GtkTreeIter *iter, gint *new_order, gpointer user_data)
+{
+    capplet_model_index_t *index = (capplet_model_index_t *)user_data;
+    capplet_model_row_t   *parent;
+    capplet_model_row_t  **rows;
+    GSequence             *children;
+    GSequenceIter         *i;
+    gint                   n;
+    gint                   k;
+
+    if ((parent = capplet_model_row_at_path(index, path, gtk_tree_path_get_depth(path))) == NULL) {
+        capplet_model_index_invalidate(index);
+        return;
+    }
+    n = parent->children ? g_sequence_get_length(parent->children) : 0;
+    if (n != gtk_tree_model_iter_n_children(model, gtk_tree_path_get_depth(path) > 0 ? iter : NULL)) {
+        capplet_model_index_invalidate(index);
+        return;
+    }
+    if (n == 0) {
+        return;
+    }
+
+    rows = g_new(capplet_model_row_t *, n);
+    for (i = g_sequence_get_begin_iter(parent->children), k = 0;
+         !g_sequence_iter_is_end(i);
+         i = g_sequence_iter_next(i), k++) {
+        rows[k] = g_sequence_get(i);
+    }
+
+    /* new_order[new position] = old position */
+    children = g_sequence_new(NULL);
+    for (k = 0; k < n; k++) {
+        rows[new_order[k]]->pos = g_sequence_append(children, rows[new_order[k]]);
+    }
+    g_sequence_free(parent->children);
+    parent->children = children;
+    g_free(rows);
+}
+
+static void
+capplet_model_index_free(capplet_model_index_t *index)
+{
+    g_signal_handlers_disconnect_matched(index->model, G_SIGNAL_MATCH_DATA,
+      0, 0, NULL, NULL, (gpointer)index);
+    capplet_model_row_free(index, &index->root);
+    g_hash_table_destroy(index->rows);
+    g_free(index);
+}
+
+/* The index is out of step with the model, e.g. the model was changed with
+ * signals blocked. Drop it, the next lookup builds a new one.
+ */
+static void
+capplet_model_index_invalidate(capplet_model_index_t *index)
+{
+    nwamui_debug("index of %s out of step, rebuilding", debug_g_type_name(index->model));
+    g_object_set_data(G_OBJECT(index->model), CAPPLET_MODEL_INDEX_KEY, NULL);
+}
+
+static capplet_model_index_t*
+capplet_model_get_index(GtkTreeModel *model)
+{
+    capplet_model_index_t *index;
+
+    if ((index = g_object_get_data(G_OBJECT(model), CAPPLET_MODEL_INDEX_KEY)) != NULL) {
+        return index;
+    }
+
+    /* Only models keeping objects in column 0. */
+    if (gtk_tree_model_get_n_columns(model) < 1 ||
+      !g_type_is_a(gtk_tree_model_get_column_type(model, 0), G_TYPE_OBJECT)) {
+        return NULL;
+    }
+
+    index = g_new0(capplet_model_index_t, 1);
+    index->model = model;
+    index->rows = g_hash_table_new(g_direct_hash, g_direct_equal);
+    index->iters_persist = (gtk_tree_model_get_flags(model) & GTK_TREE_MODEL_ITERS_PERSIST) != 0;
+    capplet_model_index_add_children(index, &index->root, NULL);
+
+    g_signal_connect(model, "row-changed",
+      G_CALLBACK(capplet_model_index_row_changed), (gpointer)index);
+    g_signal_connect(model, "row-inserted",
+      G_CALLBACK(capplet_model_index_row_inserted), (gpointer)index);
+    g_signal_connect(model, "row-deleted",
+      G_CALLBACK(capplet_model_index_row_deleted), (gpointer)index);
+    g_signal_connect(model, "rows-reordered",
+      G_CALLBACK(capplet_model_index_rows_reordered), (gpointer)index);
+
+    g_object_set_data_full(G_OBJECT(model), CAPPLET_MODEL_INDEX_KEY,
+      (gpointer)index, (GDestroyNotify)capplet_model_index_free);
+
+    return index;
+}
+
+static gboolean
+capplet_model_walk_find_object(GtkTreeModel *model, GObject *object, GtkTreeIter *iter)
+{
+	CappletForeachData data;
+
+	data.user_data = (gpointer)object;
+    data.user_data1 = (gpointer)iter;
+	data.ret_data = NULL;
+
+	gtk_tree_model_foreach(model, capplet_model_foreach_find_object,
+      (gpointer)&data);
+
+	return data.ret_data != NULL;
+}
+
+/*
+ * Returns FALSE if @model can't be indexed, else TRUE with @found telling if
+ * @object is in @model and @iter filled in.
+ */
+static gboolean
+capplet_model_index_lookup(GtkTreeModel *model, GObject *object, GtkTreeIter *iter, gboolean *found)
+{
+    capplet_model_index_t *index;
+    capplet_model_row_t   *row;
+    GSList                *rows;
+    GObject               *row_object = NULL;
+
+    if ((index = capplet_model_get_index(model)) == NULL) {
+        return FALSE;
+    }
+
+    *found = FALSE;
+    if (object == NULL) {
+        return TRUE;
+    }
+
+    if ((rows = g_hash_table_lookup(index->rows, object)) == NULL) {
+        /* The signals keep the index complete, so a miss is final. In
+         * debug mode check it, a model changed with its signals blocked
+         * would leave the index out of step.
+         */
+        if (nwamui_util_is_debug_mode() &&
+          (*found = capplet_model_walk_find_object(model, object, iter))) {
+            g_warning("%s: %s missing from the index of %s", __func__,
+              debug_g_type_name(object), debug_g_type_name(model));
+            capplet_model_index_invalidate(index);
+        }
+        return TRUE;
+    }
+
+    /* The first of its rows, as the walk in capplet_model_find_object()
+     * would find. Only more than one while a row is being moved.
+     */
+    row = (capplet_model_row_t *)rows->data;
+    if (rows->next != NULL) {
+        GtkTreePath *first = capplet_model_row_get_path(row);
+
+        for (rows = rows->next; rows != NULL; rows = rows->next) {
+            GtkTreePath *path = capplet_model_row_get_path((capplet_model_row_t *)rows->data);
+
+            if (gtk_tree_path_compare(path, first) < 0) {
+                gtk_tree_path_free(first);
+                first = path;
+                row = (capplet_model_row_t *)rows->data;
+            } else {
+                gtk_tree_path_free(path);
+            }
+        }
+        gtk_tree_path_free(first);
+    }
+
+    if (capplet_model_row_get_iter(index, row, iter)) {
+        gtk_tree_model_get(model, iter, 0, &row_object, -1);
+        if (row_object) {
+            g_object_unref(row_object);
+        }
+    }
+    if (row_object == object) {
+        *found = TRUE;
+        return TRUE;
+    }
+
+    /* Out of step, e.g. the model was changed with signals blocked. */
+    capplet_model_index_invalidate(index);
+    *found = capplet_model_walk_find_object(model, object, iter);
+    return TRUE;
+}
+
 /*
  * capplet_model_find_object:
  * @object: Could be null
@@ -2489,21 +3006,25 @@ capplet_model_foreach_find_object(GtkTreeModel *model,
 extern gboolean
 capplet_model_find_object(GtkTreeModel *model, GObject *object, GtkTreeIter *iter)
 {
-	CappletForeachData data;
 	GtkTreeIter temp_iter;
+    gboolean found;
 
-	data.user_data = (gpointer)object;
-    if (iter != NULL) {
-        data.user_data1 = (gpointer)iter;
-    } else {
-        data.user_data1 = &temp_iter;
+    if (iter == NULL) {
+        iter = &temp_iter;
     }
-	data.ret_data = NULL;
 
-	gtk_tree_model_foreach(model, capplet_model_foreach_find_object,
-      (gpointer)&data);
+    /* Object list models index their rows, no need to walk them. */
+    if (NWAMUI_IS_OBJECT_LIST_MODEL(model)) {
+        return object != NULL &&
+          nwamui_object_list_model_get_iter(NWAMUI_OBJECT_LIST_MODEL(model),
+            NWAMUI_OBJECT(object), iter);
+    }
 
-	return data.ret_data != NULL;
+    if (capplet_model_index_lookup(model, object, iter, &found)) {
+        return found;
+    }
+
+	return capplet_model_walk_find_object(model, object, iter);
 }
 
 /*
@@ -2520,13 +3041,36 @@ capplet_model_find_object_with_parent(GtkTreeModel *model, GtkTreeIter *parent,
 	GtkTreeIter temp_iter;
     GtkTreeIter i;
     gboolean valid;
+    gboolean found;
 
-	data.user_data = (gpointer)object;
-    if (iter != NULL) {
-        data.user_data1 = (gpointer)iter;
-    } else {
-        data.user_data1 = &temp_iter;
+    if (iter == NULL) {
+        iter = &temp_iter;
+    }
+
+    if (capplet_model_index_lookup(model, object, iter, &found)) {
+        GtkTreeIter  p;
+        GtkTreePath *parent_path;
+        GtkTreePath *p_path;
+
+        if (!found) {
+            return FALSE;
+        }
+        /* Objects are in the model once, check it is a child of @parent. */
+        if (!gtk_tree_model_iter_parent(model, &p, iter)) {
+            return parent == NULL;
+        } else if (parent == NULL) {
+            return FALSE;
+        }
+        parent_path = gtk_tree_model_get_path(model, parent);
+        p_path = gtk_tree_model_get_path(model, &p);
+        found = gtk_tree_path_compare(parent_path, p_path) == 0;
+        gtk_tree_path_free(parent_path);
+        gtk_tree_path_free(p_path);
+        return found;
     }
+
+	data.user_data = (gpointer)object;
+    data.user_data1 = (gpointer)iter;
 	data.ret_data = NULL;
 
     for (valid = gtk_tree_model_iter_children(model, &i, parent);
@@ -2600,6 +3144,92 @@ capplet_model_1_level_foreach(GtkTreeModel *model, GtkTreeIter *parent, GtkTreeM
     return valid;
 }
 
+/* The index row of @iter, the root if @iter is NULL. */
+static capplet_model_row_t*
+capplet_model_row_for_iter(capplet_model_index_t *index, GtkTreeIter *iter)
+{
+    capplet_model_row_t *row;
+    GtkTreePath         *path;
+    GSList              *rows = NULL;
+    GObject             *object = NULL;
+
+    if (iter == NULL) {
+        return &index->root;
+    }
+
+    if (index->iters_persist) {
+        gtk_tree_model_get(index->model, iter, 0, &object, -1);
+        if (object) {
+            rows = g_hash_table_lookup(index->rows, object);
+            g_object_unref(object);
+        }
+        for (; rows != NULL; rows = rows->next) {
+            row = (capplet_model_row_t *)rows->data;
+            if (row->iter.user_data == iter->user_data &&
+              row->iter.user_data2 == iter->user_data2 &&
+              row->iter.user_data3 == iter->user_data3) {
+                return row;
+            }
+        }
+    }
+
+    path = gtk_tree_model_get_path(index->model, iter);
+    row = capplet_model_row_at_path(index, path, gtk_tree_path_get_depth(path));
+    gtk_tree_path_free(path);
+    return row;
+}
+
+/**
+ * capplet_model_1_level_find_first:
+ *
+ * Like capplet_model_1_level_foreach(), for children of @parent sorted so
+ * that @func returns FALSE for a leading run of them and TRUE for the rest.
+ * Finds the first child @func returns TRUE for with a binary search of the
+ * model's index, calling @func O(log n) times.
+ */
+gboolean
+capplet_model_1_level_find_first(GtkTreeModel *model, GtkTreeIter *parent, GtkTreeModelForeachFunc func, gpointer user_data, GtkTreeIter *iter)
+{
+    capplet_model_index_t *index;
+    capplet_model_row_t   *row;
+    GtkTreeIter            temp_iter;
+    GtkTreeIter            child;
+    GtkTreePath           *path;
+    gint                   lo = 0;
+    gint                   hi;
+
+    if ((index = capplet_model_get_index(model)) == NULL ||
+      (row = capplet_model_row_for_iter(index, parent)) == NULL) {
+        return capplet_model_1_level_foreach(model, parent, func, user_data, iter);
+    }
+
+    if (iter == NULL)
+        iter = &temp_iter;
+
+    hi = row->children ? g_sequence_get_length(row->children) : 0;
+    while (lo < hi) {
+        gint                 mid = lo + (hi - lo) / 2;
+        capplet_model_row_t *mid_row = g_sequence_get(g_sequence_get_iter_at_pos(row->children, mid));
+
+        if (!capplet_model_row_get_iter(index, mid_row, &child)) {
+            return capplet_model_1_level_foreach(model, parent, func, user_data, iter);
+        }
+        path = capplet_model_row_get_path(mid_row);
+        if (func(model, path, &child, user_data)) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+        gtk_tree_path_free(path);
+    }
+
+    if (row->children == NULL || lo >= g_sequence_get_length(row->children)) {
+        return FALSE;
+    }
+    return capplet_model_row_get_iter(index,
+      g_sequence_get(g_sequence_get_iter_at_pos(row->children, lo)), iter);
+}
+
 const gchar*
 debug_g_type_name(gpointer object)
 {
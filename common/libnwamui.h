@@ -52,6 +52,26 @@ G_BEGIN_DECLS
 #include "nwamui_object.h"
 #endif /*_NWAMUI_OBJECT_H */
 
+#ifndef _NWAMUI_ALLOC_STATS_H
+#include "nwamui_alloc_stats.h"
+#endif /*_NWAMUI_ALLOC_STATS_H */
+
+#ifndef _NWAMUI_DISPATCH_H
+#include "nwamui_dispatch.h"
+#endif /*_NWAMUI_DISPATCH_H */
+
+#ifndef _NWAMUI_TRACE_H
+#include "nwamui_trace.h"
+#endif /*_NWAMUI_TRACE_H */
+
+#ifndef _NWAMUI_SMF_CACHE_H
+#include "nwamui_smf_cache.h"
+#endif /*_NWAMUI_SMF_CACHE_H */
+
+#ifndef _NWAMUI_PROP_H
+#include "nwamui_prop.h"
+#endif /*_NWAMUI_PROP_H */
+
 #ifndef _NWAMUI_PROF_H
 #include "nwamui_prof.h"
 #endif /*_NWAMUI_PROF_H */
@@ -96,6 +116,14 @@ G_BEGIN_DECLS
 #include "nwamui_daemon.h"
 #endif /* _NWAMUI_DAEMON_H */
 
+#ifndef _NWAMUI_OBJECT_LIST_MODEL_H
+#include "nwamui_object_list_model.h"
+#endif /* _NWAMUI_OBJECT_LIST_MODEL_H */
+
+#ifndef _NWAMUI_COMMIT_H
+#include "nwamui_commit.h"
+#endif /* _NWAMUI_COMMIT_H */
+
 #ifndef _HELP_REFS_H 
 #include "help_refs.h"
 #endif /* _HELP_REFS_H  */
@@ -403,6 +431,7 @@ gboolean capplet_model_find_object_with_parent(GtkTreeModel *model, GtkTreeIter
 gboolean capplet_model_foreach(GtkTreeModel *model, GtkTreeModelForeachFunc func, gpointer user_data, GtkTreeIter *iter);
 
 gboolean capplet_model_1_level_foreach(GtkTreeModel *model, GtkTreeIter *parent, GtkTreeModelForeachFunc func, gpointer user_data, GtkTreeIter *iter);
+gboolean capplet_model_1_level_find_first(GtkTreeModel *model, GtkTreeIter *parent, GtkTreeModelForeachFunc func, gpointer user_data, GtkTreeIter *iter);
 
 const gchar* debug_g_type_name(gpointer object);
 
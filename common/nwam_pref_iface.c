@@ -30,6 +30,7 @@
  */
 
 #include <gtk/gtk.h>
+#include "libnwamui.h"
 #include "nwam_pref_iface.h"
 
 static void
@@ -94,11 +95,16 @@ gboolean
 nwam_pref_refresh (NwamPrefIFace *iface, gpointer user_data, gboolean force)
 {
     NwamPrefInterface *interface = NWAM_GET_PREF_INTERFACE (iface);
+    gboolean           rval;
 
     g_return_val_if_fail(interface != NULL, FALSE );
     g_return_val_if_fail(interface->refresh, FALSE );
 
-    return interface->refresh(iface, user_data, force);
+    nwamui_alloc_stats_enter("nwam_pref_refresh");
+    rval = interface->refresh(iface, user_data, force);
+    nwamui_alloc_stats_leave("nwam_pref_refresh");
+
+    return rval;
 }
 
 /**
@@ -117,11 +123,16 @@ gboolean
 nwam_pref_apply (NwamPrefIFace *iface, gpointer user_data)
 {
 	NwamPrefInterface *interface = NWAM_GET_PREF_INTERFACE (iface);
+    gboolean           rval;
 
     g_return_val_if_fail(interface != NULL, FALSE );
     g_return_val_if_fail(interface->apply, FALSE );
 
-    return interface->apply(iface, user_data);
+    nwamui_alloc_stats_enter("nwam_pref_apply");
+    rval = interface->apply(iface, user_data);
+    nwamui_alloc_stats_leave("nwam_pref_apply");
+
+    return rval;
 }
 
 /**
@@ -140,11 +151,16 @@ gboolean
 nwam_pref_cancel (NwamPrefIFace *iface, gpointer user_data)
 {
 	NwamPrefInterface *interface = NWAM_GET_PREF_INTERFACE (iface);
+    gboolean           rval;
 
     g_return_val_if_fail(interface != NULL, FALSE );
     g_return_val_if_fail(interface->cancel, FALSE );
 
-    return interface->cancel(iface, user_data);
+    nwamui_alloc_stats_enter("nwam_pref_cancel");
+    rval = interface->cancel(iface, user_data);
+    nwamui_alloc_stats_leave("nwam_pref_cancel");
+
+    return rval;
 }
 
 /**
@@ -0,0 +1,449 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_alloc_stats.c
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <pthread.h>
+#include <glib-object.h>
+
+#include "libnwamui.h"
+
+#define ALLOC_STATS_MAX_ENTRY_POINTS    (64)
+
+/* Blocks we handed out are remembered in an open addressing table, with
+ * their size, so g_free() can tell them from memory that came from plain
+ * malloc(), e.g. strings returned by libnwam, without touching anything
+ * outside the block. The table is allocated with malloc() directly and
+ * guarded by a pthread mutex, GLib can't be used from inside the vtable.
+ */
+#define ALLOC_TABLE_MIN_SIZE            (1024)
+#define ALLOC_HASH(mem, mask)           ((((gsize)(mem)) >> 4) * 2654435761UL & (mask))
+
+typedef struct {
+    gpointer    mem;
+    gsize       size;
+} alloc_block_t;
+
+static alloc_block_t       *blocks = NULL;
+static gsize                blocks_mask = 0;
+static gsize                blocks_count = 0;
+static pthread_mutex_t      blocks_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static gboolean             enabled = FALSE;
+
+/* Entries are only ever appended, so a slot can be updated without a lock
+ * once its name is set. Allocations may happen on any thread, counters are
+ * updated atomically.
+ */
+static nwamui_alloc_stats_t entry_points[ALLOC_STATS_MAX_ENTRY_POINTS];
+static volatile gint        num_entry_points = 0;
+static volatile gint        current = -1;       /* Outermost running entry point */
+static volatile gint        depth = 0;
+
+static void
+alloc_stats_count(gboolean alloc, gsize size)
+{
+    gint                  i = g_atomic_int_get(&current);
+    nwamui_alloc_stats_t *stats;
+
+    if (i < 0) {
+        return;
+    }
+
+    stats = &entry_points[i];
+    if (alloc) {
+        g_atomic_int_inc((gint*)&stats->allocs);
+        g_atomic_int_add((gint*)&stats->bytes_allocated, (gint)size);
+    } else {
+        g_atomic_int_inc((gint*)&stats->frees);
+        g_atomic_int_add((gint*)&stats->bytes_freed, (gint)size);
+    }
+}
+
+/* Callers hold blocks_lock. */
+static alloc_block_t*
+alloc_table_find(gpointer mem)
+{
+    gsize i;
+
+    if (blocks == NULL) {
+        return NULL;
+    }
+    for (i = ALLOC_HASH(mem, blocks_mask); blocks[i].mem != NULL; i = (i + 1) & blocks_mask) {
+        if (blocks[i].mem == mem) {
+            return &blocks[i];
+        }
+    }
+    return NULL;
+}
+
+static gboolean
+alloc_table_grow(void)
+{
+    alloc_block_t  *old = blocks;
+    gsize           old_size = (blocks != NULL ? blocks_mask + 1 : 0);
+    gsize           size = (old_size > 0 ? old_size * 2 : ALLOC_TABLE_MIN_SIZE);
+    gsize           i;
+    gsize           j;
+
+    if ((blocks = calloc(size, sizeof(alloc_block_t))) == NULL) {
+        blocks = old;
+        return FALSE;
+    }
+    blocks_mask = size - 1;
+
+    for (i = 0; i < old_size; i++) {
+        if (old[i].mem == NULL) {
+            continue;
+        }
+        for (j = ALLOC_HASH(old[i].mem, blocks_mask); blocks[j].mem != NULL; j = (j + 1) & blocks_mask);
+        blocks[j] = old[i];
+    }
+    free(old);
+
+    return TRUE;
+}
+
+/* Callers hold blocks_lock. Keeps the load factor below one half. */
+static gboolean
+alloc_table_insert(gpointer mem, gsize size)
+{
+    gsize i;
+
+    if ((blocks_count + 1) * 2 > (blocks != NULL ? blocks_mask + 1 : 0) && !alloc_table_grow()) {
+        return FALSE;
+    }
+    for (i = ALLOC_HASH(mem, blocks_mask); blocks[i].mem != NULL; i = (i + 1) & blocks_mask);
+    blocks[i].mem = mem;
+    blocks[i].size = size;
+    blocks_count++;
+
+    return TRUE;
+}
+
+/* Callers hold blocks_lock. Linear probing, so later entries of the cluster
+ * are shifted back instead of leaving tombstones.
+ */
+static void
+alloc_table_remove(alloc_block_t *slot)
+{
+    gsize i = slot - blocks;
+    gsize j = i;
+    gsize k;
+
+    for (;;) {
+        blocks[i].mem = NULL;
+        for (;;) {
+            j = (j + 1) & blocks_mask;
+            if (blocks[j].mem == NULL) {
+                blocks_count--;
+                return;
+            }
+            k = ALLOC_HASH(blocks[j].mem, blocks_mask);
+            /* Move j back to i unless its home slot k lies cyclically in (i, j]. */
+            if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) {
+                continue;
+            }
+            break;
+        }
+        blocks[i] = blocks[j];
+        i = j;
+    }
+}
+
+/* Record a fresh block, if the table can't grow the block is released and
+ * the allocation reported as failed, so nothing escapes unaccounted.
+ */
+static gpointer
+alloc_track(gpointer mem, gsize n_bytes)
+{
+    gboolean tracked;
+
+    if (mem == NULL) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&blocks_lock);
+    tracked = alloc_table_insert(mem, n_bytes);
+    pthread_mutex_unlock(&blocks_lock);
+
+    if (!tracked) {
+        free(mem);
+        return NULL;
+    }
+    alloc_stats_count(TRUE, n_bytes);
+
+    return mem;
+}
+
+static gpointer
+counting_malloc(gsize n_bytes)
+{
+    return alloc_track(malloc(n_bytes), n_bytes);
+}
+
+static gpointer
+counting_calloc(gsize n_blocks, gsize n_block_bytes)
+{
+    return alloc_track(calloc(n_blocks, n_block_bytes), n_blocks * n_block_bytes);
+}
+
+static void
+counting_free(gpointer mem)
+{
+    alloc_block_t  *slot;
+    gsize           size = 0;
+    gboolean        ours = FALSE;
+
+    if (mem == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&blocks_lock);
+    if ((slot = alloc_table_find(mem)) != NULL) {
+        size = slot->size;
+        ours = TRUE;
+        alloc_table_remove(slot);
+    }
+    pthread_mutex_unlock(&blocks_lock);
+
+    if (ours) {
+        alloc_stats_count(FALSE, size);
+    }
+    free(mem);
+}
+
+/* A realloc is counted as a free of the old block plus a new allocation.
+ * The old block is forgotten before realloc() may release it, so another
+ * thread can't be handed the same address while it's still recorded.
+ * Blocks that didn't come from us are resized without being adopted.
+ */
+static gpointer
+counting_realloc(gpointer mem, gsize n_bytes)
+{
+    alloc_block_t  *slot;
+    gsize           size = 0;
+    gboolean        ours = FALSE;
+    gpointer        new_mem;
+
+    if (mem == NULL) {
+        return counting_malloc(n_bytes);
+    }
+
+    pthread_mutex_lock(&blocks_lock);
+    if ((slot = alloc_table_find(mem)) != NULL) {
+        size = slot->size;
+        ours = TRUE;
+        alloc_table_remove(slot);
+    }
+    pthread_mutex_unlock(&blocks_lock);
+
+    if (!ours) {
+        return realloc(mem, n_bytes);
+    }
+
+    if ((new_mem = realloc(mem, n_bytes)) == NULL) {
+        /* The old block is still valid, remember it again. */
+        pthread_mutex_lock(&blocks_lock);
+        (void) alloc_table_insert(mem, size);
+        pthread_mutex_unlock(&blocks_lock);
+        return NULL;
+    }
+
+    alloc_stats_count(FALSE, size);
+    return alloc_track(new_mem, n_bytes);
+}
+
+static GMemVTable counting_vtable = {
+    counting_malloc,
+    counting_realloc,
+    counting_free,
+    counting_calloc,
+    counting_malloc,
+    counting_realloc
+};
+
+/**
+ * nwamui_alloc_stats_enable:
+ *
+ * Install the counting allocator. As for g_mem_set_vtable(), this has to be
+ * called before any other GLib function, including g_thread_init(). GSlice
+ * is switched to plain g_malloc() so slice allocations are seen too.
+ *
+ * @returns: TRUE if accounting is enabled.
+ **/
+extern gboolean
+nwamui_alloc_stats_enable(void)
+{
+    if (enabled) {
+        return TRUE;
+    }
+
+    /* Can't use g_setenv() here, it allocates. */
+    setenv("G_SLICE", "always-malloc", 1);
+
+    g_mem_set_vtable(&counting_vtable);
+    enabled = TRUE;
+
+    return TRUE;
+}
+
+extern gboolean
+nwamui_alloc_stats_is_enabled(void)
+{
+    return enabled;
+}
+
+static gint
+alloc_stats_find(const gchar *entry_point, gboolean create)
+{
+    gint i;
+
+    for (i = 0; i < num_entry_points; i++) {
+        if (entry_points[i].name == entry_point ||
+          strcmp(entry_points[i].name, entry_point) == 0) {
+            return i;
+        }
+    }
+
+    if (!create || i >= ALLOC_STATS_MAX_ENTRY_POINTS) {
+        return -1;
+    }
+
+    bzero(&entry_points[i], sizeof(nwamui_alloc_stats_t));
+    entry_points[i].name = entry_point;
+    g_atomic_int_inc(&num_entry_points);
+
+    return i;
+}
+
+/**
+ * nwamui_alloc_stats_enter:
+ * @entry_point: a static string naming the public function.
+ *
+ * Start charging allocations to @entry_point, unless another entry point is
+ * already running, in which case that one keeps being charged. Entry points
+ * are expected to be called from the main thread.
+ **/
+extern void
+nwamui_alloc_stats_enter(const gchar *entry_point)
+{
+    gint i;
+
+    if (!enabled) {
+        return;
+    }
+
+    if (depth++ > 0) {
+        return;
+    }
+
+    if ((i = alloc_stats_find(entry_point, TRUE)) >= 0) {
+        entry_points[i].calls++;
+    }
+    g_atomic_int_set(&current, i);
+}
+
+extern void
+nwamui_alloc_stats_leave(const gchar *entry_point)
+{
+    if (!enabled) {
+        return;
+    }
+
+    g_return_if_fail(depth > 0);
+
+    if (--depth == 0) {
+        g_atomic_int_set(&current, -1);
+    }
+}
+
+extern void
+nwamui_alloc_stats_object_new(void)
+{
+    gint i;
+
+    if (enabled && (i = g_atomic_int_get(&current)) >= 0) {
+        g_atomic_int_inc((gint*)&entry_points[i].objects_new);
+    }
+}
+
+extern void
+nwamui_alloc_stats_object_finalized(void)
+{
+    gint i;
+
+    if (enabled && (i = g_atomic_int_get(&current)) >= 0) {
+        g_atomic_int_inc((gint*)&entry_points[i].objects_finalized);
+    }
+}
+
+extern const nwamui_alloc_stats_t*
+nwamui_alloc_stats_lookup(const gchar *entry_point)
+{
+    gint i;
+
+    g_return_val_if_fail(entry_point != NULL, NULL);
+
+    if ((i = alloc_stats_find(entry_point, FALSE)) < 0) {
+        return NULL;
+    }
+    return &entry_points[i];
+}
+
+extern void
+nwamui_alloc_stats_foreach(nwamui_alloc_stats_func_t func, gpointer user_data)
+{
+    gint i;
+
+    g_return_if_fail(func != NULL);
+
+    for (i = 0; i < num_entry_points; i++) {
+        func(&entry_points[i], user_data);
+    }
+}
+
+/**
+ * nwamui_alloc_stats_reset:
+ *
+ * Zero the counters of every entry point, names are kept.
+ **/
+extern void
+nwamui_alloc_stats_reset(void)
+{
+    gint i;
+
+    for (i = 0; i < num_entry_points; i++) {
+        const gchar *name = entry_points[i].name;
+
+        bzero(&entry_points[i], sizeof(nwamui_alloc_stats_t));
+        entry_points[i].name = name;
+    }
+}
@@ -0,0 +1,81 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_alloc_stats.h
+ *
+ */
+
+#ifndef _NWAMUI_ALLOC_STATS_H
+#define	_NWAMUI_ALLOC_STATS_H
+
+#ifndef _libnwamui_H
+#error "Please include libnwamui.h header instead."
+#endif
+
+G_BEGIN_DECLS
+
+/*
+ * Allocation accounting for test runs. When enabled, g_malloc() and friends
+ * are routed through a counting GMemVTable and every allocation made while a
+ * public entry point is running (in any thread, since NCP reloads use a
+ * worker pool) is charged to the outermost entry point. NwamuiObject
+ * construction and finalization are counted as well.
+ *
+ * Disabled by default, entering or leaving a scope is then a single test.
+ */
+typedef struct {
+    const gchar    *name;
+    guint           calls;
+    guint           allocs;
+    guint           frees;
+    guint           bytes_allocated;
+    guint           bytes_freed;
+    guint           objects_new;
+    guint           objects_finalized;
+} nwamui_alloc_stats_t;
+
+typedef void (*nwamui_alloc_stats_func_t)(const nwamui_alloc_stats_t *stats, gpointer user_data);
+
+extern gboolean                     nwamui_alloc_stats_enable( void );
+
+extern gboolean                     nwamui_alloc_stats_is_enabled( void );
+
+extern void                         nwamui_alloc_stats_enter( const gchar *entry_point );
+
+extern void                         nwamui_alloc_stats_leave( const gchar *entry_point );
+
+extern void                         nwamui_alloc_stats_object_new( void );
+
+extern void                         nwamui_alloc_stats_object_finalized( void );
+
+extern const nwamui_alloc_stats_t*  nwamui_alloc_stats_lookup( const gchar *entry_point );
+
+extern void                         nwamui_alloc_stats_foreach( nwamui_alloc_stats_func_t func, gpointer user_data );
+
+extern void                         nwamui_alloc_stats_reset( void );
+
+G_END_DECLS
+
+#endif	/* _NWAMUI_ALLOC_STATS_H */
@@ -0,0 +1,265 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_commit.c
+ *
+ */
+
+#include <glib-object.h>
+
+#include "libnwamui.h"
+
+typedef struct {
+    guint                           id;
+    GList                          *objects;    /* Ref'd, in commit order */
+    guint                           total;
+    nwamui_commit_progress_func_t   progress;
+    nwamui_commit_done_func_t       done;
+    gpointer                        user_data;
+    volatile gint                   cancelled;
+
+    /* Result, set by the worker */
+    gboolean                        success;
+    NwamuiObject                   *failed;
+    nwamui_commit_stage_t           failed_stage;
+    gchar                          *prop_name;
+} commit_job_t;
+
+typedef struct {
+    commit_job_t           *job;
+    NwamuiObject           *object;
+    nwamui_commit_stage_t   stage;
+    guint                   n;
+} commit_progress_t;
+
+/* Jobs run one at a time, in submission order. */
+static GThreadPool *commit_pool = NULL;
+
+/* Main loop only. */
+static GHashTable  *pending_jobs = NULL;
+static guint        last_job_id = 0;
+
+static void
+commit_job_free(commit_job_t *job)
+{
+    g_list_foreach(job->objects, (GFunc)g_object_unref, NULL);
+    g_list_free(job->objects);
+    if (job->failed) {
+        g_object_unref(job->failed);
+    }
+    g_free(job->prop_name);
+    g_free(job);
+}
+
+static gboolean
+commit_progress_cb(gpointer data)
+{
+    commit_progress_t *p = (commit_progress_t *)data;
+
+    if (p->job->progress && !g_atomic_int_get(&p->job->cancelled)) {
+        p->job->progress(p->object, p->stage, p->n, p->job->total, p->job->user_data);
+    }
+    g_free(p);
+    return FALSE;
+}
+
+/* Worker, the job outlives the idle since done is queued after it. */
+static void
+commit_progress_post(commit_job_t *job, NwamuiObject *object, nwamui_commit_stage_t stage, guint n)
+{
+    commit_progress_t *p = g_new(commit_progress_t, 1);
+
+    p->job = job;
+    p->object = object;
+    p->stage = stage;
+    p->n = n;
+    g_idle_add(commit_progress_cb, (gpointer)p);
+}
+
+static gboolean
+commit_done_cb(gpointer data)
+{
+    commit_job_t *job    = (commit_job_t *)data;
+    NwamuiDaemon *daemon = nwamui_daemon_get_instance();
+
+    g_hash_table_remove(pending_jobs, GUINT_TO_POINTER(job->id));
+
+    nwamui_daemon_release_events(daemon);
+    g_object_unref(daemon);
+
+    if (job->done) {
+        job->done(job->success,
+          !job->success && g_atomic_int_get(&job->cancelled),
+          job->failed, job->failed_stage, job->prop_name, job->user_data);
+    }
+    commit_job_free(job);
+    return FALSE;
+}
+
+static void
+commit_worker(gpointer data, gpointer user_data)
+{
+    commit_job_t *job = (commit_job_t *)data;
+    GList        *i;
+    guint         n;
+
+    job->success = FALSE;
+
+    for (i = job->objects, n = 1; i; i = g_list_next(i), n++) {
+        NwamuiObject *object = NWAMUI_OBJECT(i->data);
+
+        if (g_atomic_int_get(&job->cancelled)) {
+            goto L_exit;
+        }
+        if (!nwamui_object_validate(object, &job->prop_name)) {
+            job->failed = g_object_ref(object);
+            job->failed_stage = NWAMUI_COMMIT_VALIDATED;
+            goto L_exit;
+        }
+        commit_progress_post(job, object, NWAMUI_COMMIT_VALIDATED, n);
+    }
+
+    for (i = job->objects, n = 1; i; i = g_list_next(i), n++) {
+        NwamuiObject *object = NWAMUI_OBJECT(i->data);
+
+        if (g_atomic_int_get(&job->cancelled)) {
+            goto L_exit;
+        }
+        /* Already done if a container committed it. */
+        if (nwamui_object_has_modifications(object) && !nwamui_object_commit(object)) {
+            job->failed = g_object_ref(object);
+            job->failed_stage = NWAMUI_COMMIT_COMMITTED;
+            goto L_exit;
+        }
+        commit_progress_post(job, object, NWAMUI_COMMIT_COMMITTED, n);
+    }
+    job->success = TRUE;
+
+L_exit:
+    g_idle_add(commit_done_cb, (gpointer)job);
+}
+
+static void
+commit_snapshot_append(gpointer data, gpointer user_data)
+{
+    NwamuiObject *object = NWAMUI_OBJECT(data);
+    GList       **list   = (GList **)user_data;
+
+    if (nwamui_object_has_modifications(object)) {
+        *list = g_list_prepend(*list, g_object_ref(object));
+    }
+}
+
+static void
+commit_snapshot_add(gpointer data, gpointer user_data)
+{
+    NwamuiObject *object = NWAMUI_OBJECT(data);
+    GList       **list   = (GList **)user_data;
+
+    if (NWAMUI_IS_DAEMON(object)) {
+        GList *children = NULL;
+
+        nwamui_daemon_foreach_ncp(NWAMUI_DAEMON(object), commit_snapshot_append, &children);
+        nwamui_daemon_foreach_loc(NWAMUI_DAEMON(object), commit_snapshot_append, &children);
+        nwamui_daemon_foreach_enm(NWAMUI_DAEMON(object), commit_snapshot_append, &children);
+        nwamui_daemon_foreach_fav_wifi(NWAMUI_DAEMON(object), commit_snapshot_append, &children);
+
+        children = g_list_reverse(children);
+        g_list_foreach(children, commit_snapshot_add, list);
+        g_list_foreach(children, (GFunc)g_object_unref, NULL);
+        g_list_free(children);
+    } else if (g_list_find(*list, object) == NULL) {
+        *list = g_list_prepend(*list, g_object_ref(object));
+
+        /* A new NCP is created by its own commit, before its NCUs. */
+        if (NWAMUI_IS_NCP(object)) {
+            nwamui_ncp_foreach_ncu(NWAMUI_NCP(object), commit_snapshot_append, list);
+        }
+    }
+}
+
+/**
+ * nwamui_commit_async:
+ * @objects: a list of #NwamuiObject.
+ * @progress: called after each object is validated and committed, may be
+ * NULL.
+ * @done: called once at the end, may be NULL.
+ *
+ * Validate and commit @objects on a worker thread.
+ *
+ * Returns: the job id, for nwamui_commit_cancel().
+ **/
+extern guint
+nwamui_commit_async(GList *objects, nwamui_commit_progress_func_t progress, nwamui_commit_done_func_t done, gpointer user_data)
+{
+    commit_job_t *job;
+    NwamuiDaemon *daemon;
+
+    if (commit_pool == NULL) {
+        commit_pool = g_thread_pool_new(commit_worker, NULL, 1, FALSE, NULL);
+        pending_jobs = g_hash_table_new(g_direct_hash, g_direct_equal);
+    }
+
+    job = g_new0(commit_job_t, 1);
+    job->id = ++last_job_id;
+    job->progress = progress;
+    job->done = done;
+    job->user_data = user_data;
+
+    g_list_foreach(objects, commit_snapshot_add, &job->objects);
+    job->objects = g_list_reverse(job->objects);
+    job->total = g_list_length(job->objects);
+
+    g_hash_table_insert(pending_jobs, GUINT_TO_POINTER(job->id), job);
+
+    daemon = nwamui_daemon_get_instance();
+    nwamui_daemon_hold_events(daemon);
+    g_object_unref(daemon);
+
+    g_thread_pool_push(commit_pool, (gpointer)job, NULL);
+
+    return job->id;
+}
+
+/**
+ * nwamui_commit_cancel:
+ *
+ * Stop job @job_id before the next object, its done function is still
+ * called, with cancelled set.
+ *
+ * Returns: TRUE if the job was still pending.
+ **/
+extern gboolean
+nwamui_commit_cancel(guint job_id)
+{
+    commit_job_t *job;
+
+    if (pending_jobs == NULL ||
+      (job = g_hash_table_lookup(pending_jobs, GUINT_TO_POINTER(job_id))) == NULL) {
+        return FALSE;
+    }
+    g_atomic_int_set(&job->cancelled, 1);
+    return TRUE;
+}
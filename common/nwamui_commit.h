@@ -0,0 +1,83 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_commit.h
+ *
+ */
+
+#ifndef _NWAMUI_COMMIT_H
+#define	_NWAMUI_COMMIT_H
+
+#ifndef _libnwamui_H
+#error "Please include libnwamui.h header instead."
+#endif
+
+G_BEGIN_DECLS
+
+/*
+ * Asynchronous validate and commit. The objects to commit are snapshotted
+ * in the main loop: an NCP expands to itself and its modified NCUs, the
+ * daemon to its modified children. All of them are validated and then
+ * committed, one at a time, on a worker thread. Progress and the result are
+ * reported back in the main loop.
+ *
+ * The objects must not be edited until the job is done, callers keep their
+ * UI insensitive meanwhile. Daemon events are held back for the same time,
+ * so that objects aren't reloaded under the worker.
+ */
+typedef enum {
+    NWAMUI_COMMIT_VALIDATED = 0,
+    NWAMUI_COMMIT_COMMITTED,
+} nwamui_commit_stage_t;
+
+/* @n counts from 1 to @total within each stage. */
+typedef void (*nwamui_commit_progress_func_t)( NwamuiObject *object,
+                                               nwamui_commit_stage_t stage,
+                                               guint n,
+                                               guint total,
+                                               gpointer user_data );
+
+/* On failure @failed is the object which didn't validate or commit, as told
+ * by @failed_stage, and @prop_name the property that failed validation if
+ * known. Objects committed
+ * before a failure or cancellation stay committed.
+ */
+typedef void (*nwamui_commit_done_func_t)( gboolean success,
+                                           gboolean cancelled,
+                                           NwamuiObject *failed,
+                                           nwamui_commit_stage_t failed_stage,
+                                           const gchar *prop_name,
+                                           gpointer user_data );
+
+extern guint        nwamui_commit_async( GList *objects,
+                                         nwamui_commit_progress_func_t progress,
+                                         nwamui_commit_done_func_t done,
+                                         gpointer user_data );
+
+extern gboolean     nwamui_commit_cancel( guint job_id );
+
+G_END_DECLS
+
+#endif	/* _NWAMUI_COMMIT_H */
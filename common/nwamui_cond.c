@@ -490,7 +490,7 @@ nwamui_cond_to_string( NwamuiCond* self )
     if ( (nerr = nwam_condition_to_condition_string( condition_object, 
                                                      condition, value, &new_str )) != NWAM_SUCCESS ) {
         g_warning("Failed to generate condition string");
-        return( NULL );
+        new_str = NULL;
     }
 
     free(value);
@@ -119,6 +119,8 @@ struct _NwamuiDaemonPrivate {
     GQueue                 *wlan_scan_queue;
     gint                    num_scanned_wifi;
     gint                    online_enm_num;
+    gint                    event_hold_count;
+    GQueue                 *held_events; /* Events deferred while held */
 };
 
 #define NWAMUI_DAEMON_GET_PRIVATE(o) (G_TYPE_INSTANCE_GET_PRIVATE((o), NWAMUI_TYPE_DAEMON, NwamuiDaemonPrivate))
@@ -269,6 +271,8 @@ nwamui_daemon_init (NwamuiDaemon *self)
     
     self->prv = prv;
     
+    nwamui_trace_begin("nwamui_daemon_init");
+
     prv->nwam_events_gthread = g_thread_create(nwam_events_thread, g_object_ref(self), TRUE, &error);
     if( prv->nwam_events_gthread == NULL ) {
         g_debug("Error creating nwam events thread: %s", (error && error->message)?error->message:"" );
@@ -280,6 +284,8 @@ nwamui_daemon_init (NwamuiDaemon *self)
      * without this dup call.
      */
     nwamui_object_real_reload(NWAMUI_OBJECT(self));
+
+    nwamui_trace_end("nwamui_daemon_init");
 }
 
 /**
@@ -294,6 +300,8 @@ nwamui_object_real_reload(NwamuiObject* object)
     nwam_error_t nerr;
     int cbret;
     
+    nwamui_trace_begin("nwamui_daemon_reload");
+
     /* NCPs */
 
     /* Get list of Ncps from libnwam */
@@ -369,6 +377,8 @@ nwamui_object_real_reload(NwamuiObject* object)
         prv->temp_list = NULL;
     }
     g_debug ("### nwam_walk_know_wlans  end ###");
+
+    nwamui_trace_end("nwamui_daemon_reload");
 }
 
 static void
@@ -504,6 +514,11 @@ nwamui_daemon_finalize (NwamuiDaemon *self)
             g_list_free(prv->managed_list[i]);
         }
     }
+
+    if (prv->held_events) {
+        g_queue_foreach(prv->held_events, (GFunc)nwamui_event_free, NULL);
+        g_queue_free(prv->held_events);
+    }
     
     self->prv = NULL;
 
@@ -599,9 +614,11 @@ nwamui_daemon_wifi_start_scan(NwamuiDaemon *self)
 
     g_debug("Wireless Scan initiated");
 
+    nwamui_alloc_stats_enter("nwamui_daemon_wifi_start_scan");
     if (prv->active_ncp != NULL) {
         nwamui_ncp_foreach_ncu(NWAMUI_NCP(prv->active_ncp), foreach_wireless_trigger_scan, NULL);
     }
+    nwamui_alloc_stats_leave("nwamui_daemon_wifi_start_scan");
 }
 
 /**
@@ -1223,6 +1240,11 @@ dispatch_scan_results_from_wlan_array( NwamuiDaemon *daemon, NwamuiNcu* ncu,  ui
                  */
                 wifi_net = nwamui_ncu_wifi_hash_insert_or_update_from_wlan_t(ncu, wlan_p);
 
+                /* Hold notifications until the merge of this wlan is done,
+                 * so its changes are published once.
+                 */
+                g_object_freeze_notify(G_OBJECT(wifi_net));
+
                 fav_net = nwamui_daemon_find_fav_wifi_net_by_name(daemon, wlan_p->nww_essid);
                 if (fav_net != NULL) {
                     /* Exists as a favourite, so update it's information */
@@ -1254,6 +1276,7 @@ dispatch_scan_results_from_wlan_array( NwamuiDaemon *daemon, NwamuiNcu* ncu,  ui
                     /* nwamui_wifi_net_set_status(wifi_net, NWAMUI_WIFI_STATUS_DISCONNECTED); */
                 }
 
+                g_object_thaw_notify(G_OBJECT(wifi_net));
                 g_object_unref(wifi_net);
             }
         }
@@ -1304,9 +1327,13 @@ nwamui_daemon_dispatch_wifi_scan_events_from_cache(NwamuiDaemon* daemon)
     NwamuiDaemonPrivate  *prv = NWAMUI_DAEMON_GET_PRIVATE(daemon);
     
     g_debug("Dispatch wifi scan events from cache called");
+    nwamui_alloc_stats_enter("nwamui_daemon_dispatch_wifi_scan_events_from_cache");
+    nwamui_trace_begin("nwamui_daemon_dispatch_wifi_scan_events_from_cache");
     if (prv->active_ncp != NULL && nwamui_ncp_get_wireless_link_num(NWAMUI_NCP(prv->active_ncp)) > 0) {
         nwamui_ncp_foreach_ncu(NWAMUI_NCP(prv->active_ncp), dispatch_scan_results_if_wireless, (gpointer)daemon);
     }
+    nwamui_trace_end("nwamui_daemon_dispatch_wifi_scan_events_from_cache");
+    nwamui_alloc_stats_leave("nwamui_daemon_dispatch_wifi_scan_events_from_cache");
 }
 
 static NwamuiEvent*
@@ -1470,6 +1497,16 @@ nwamd_event_handler(gpointer data)
 	nwam_event_t         nwamevent = event->nwamevent;
     nwam_error_t         err;
 
+    if (prv->event_hold_count > 0) {
+        /* A commit is in progress, replay this once it is released. Take
+         * over the nwam event, the caller frees the original wrapper.
+         */
+        g_queue_push_tail(prv->held_events,
+          nwamui_event_new(daemon, event->e, nwamevent));
+        event->nwamevent = NULL;
+        return FALSE;
+    }
+
     switch (event->e) {
     case NWAMUI_DAEMON_INFO_UNKNOWN:
     case NWAMUI_DAEMON_INFO_ERROR:
@@ -1481,6 +1518,7 @@ nwamd_event_handler(gpointer data)
         /* Set to UNINITIALIZED first, status will then be got later when icon is to be shown
          */
         prv->connected_to_nwamd = TRUE;
+        nwamui_trace_instant("nwamd connected");
 
         nwamui_daemon_set_status(daemon, NWAMUI_DAEMON_STATUS_UNINITIALIZED);
 
@@ -2552,7 +2590,11 @@ nwam_events_thread ( gpointer data )
 
     g_debug ("nwam_events_thread");
     
-    if ( nwamui_daemon_nwam_connect( FALSE ) ) {
+    nwamui_trace_begin("nwamui_daemon_nwam_connect");
+    connected_to_nwamd = nwamui_daemon_nwam_connect( FALSE );
+    nwamui_trace_end("nwamui_daemon_nwam_connect");
+
+    if ( connected_to_nwamd ) {
 		/*
          * We can emit NWAMUI_DAEMON_INFO_ACTIVE here, so we can populate all
          * the info in nwamd_event_handler
@@ -2806,6 +2848,49 @@ nwam_known_wlan_walker_cb (nwam_known_wlan_handle_t wlan_h, void *data)
     return(0);
 }
 
+/**
+ * nwamui_daemon_hold_events:
+ *
+ * Defer handling of nwamd events until nwamui_daemon_release_events() is
+ * called, e.g. while objects are being committed from a worker thread and
+ * must not be reloaded underneath it. Calls nest.
+ **/
+extern void
+nwamui_daemon_hold_events(NwamuiDaemon *self)
+{
+    NwamuiDaemonPrivate *prv = NWAMUI_DAEMON_GET_PRIVATE(self);
+
+    if (prv->event_hold_count++ == 0 && prv->held_events == NULL) {
+        prv->held_events = g_queue_new();
+    }
+}
+
+/**
+ * nwamui_daemon_release_events:
+ *
+ * Undo one nwamui_daemon_hold_events(), when the last hold is released the
+ * deferred events are dispatched again in the order they arrived.
+ **/
+extern void
+nwamui_daemon_release_events(NwamuiDaemon *self)
+{
+    NwamuiDaemonPrivate *prv = NWAMUI_DAEMON_GET_PRIVATE(self);
+    NwamuiEvent         *event;
+
+    g_return_if_fail(prv->event_hold_count > 0);
+
+    if (--prv->event_hold_count > 0) {
+        return;
+    }
+
+    while ((event = g_queue_pop_head(prv->held_events)) != NULL) {
+        g_idle_add_full(G_PRIORITY_DEFAULT_IDLE,
+          nwamd_event_handler,
+          (gpointer) event,
+          (GDestroyNotify) nwamui_event_free);
+    }
+}
+
 extern void
 nwamui_daemon_foreach_ncp(NwamuiDaemon *self, GFunc func, gpointer user_data)
 {
@@ -158,6 +158,9 @@ extern nwamui_daemon_status_t       nwamui_daemon_get_status_icon_type( NwamuiDa
 
 extern const gchar*                 nwamui_deamon_status_to_string( nwamui_daemon_status_t status );
 
+extern void                         nwamui_daemon_hold_events(NwamuiDaemon *self);
+extern void                         nwamui_daemon_release_events(NwamuiDaemon *self);
+
 extern void                         nwamui_daemon_foreach_ncp(NwamuiDaemon *self, GFunc func, gpointer user_data);
 extern void                         nwamui_daemon_foreach_loc(NwamuiDaemon *self, GFunc func, gpointer user_data);
 extern void                         nwamui_daemon_foreach_enm(NwamuiDaemon *self, GFunc func, gpointer user_data);
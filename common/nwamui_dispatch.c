@@ -0,0 +1,356 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_dispatch.c
+ *
+ */
+
+
+#include <string.h>
+#include <glib-object.h>
+
+#include "libnwamui.h"
+
+typedef struct {
+    guint                   id;             /* 0 once unsubscribed */
+    NwamuiObject           *object;         /* NULL for any object */
+    guint                   change_mask;
+    nwamui_dispatch_func_t  func;
+    gpointer                user_data;
+} subscription_t;
+
+static const struct {
+    const gchar    *name;
+    guint           change_mask;
+} pspec_masks[] = {
+    { "nwam-state",         NWAMUI_CHANGE_STATE },
+    { "active",             NWAMUI_CHANGE_ACTIVE },
+    { "status",             NWAMUI_CHANGE_STATE },
+    { "switching",          NWAMUI_CHANGE_STATE },
+    { "name",               NWAMUI_CHANGE_NAME },
+    { "signal-strength",    NWAMUI_CHANGE_SIGNAL },
+    { "wifi-info",          NWAMUI_CHANGE_SIGNAL },
+    { "enabled",            NWAMUI_CHANGE_ENABLED },
+    { "activation-mode",    NWAMUI_CHANGE_ENABLED },
+    { NULL,                 0 }
+};
+
+/* Subscriptions are only touched from the main loop. */
+static GHashTable  *subscriptions = NULL;           /* id -> subscription_t */
+static GHashTable  *object_subscriptions = NULL;    /* object -> GSList of subscription_t */
+static GSList      *any_subscriptions = NULL;
+static guint        next_subscription_id = 1;
+static volatile gint num_subscriptions = 0;
+static guint        dispatching = 0;
+static GSList      *dead_subscriptions = NULL;      /* Unlinked after dispatching */
+
+/* Objects may publish from the NCP reload workers, pending changes are
+ * guarded by a lock. Each pending object holds a reference until flushed.
+ */
+G_LOCK_DEFINE_STATIC(pending);
+static GHashTable  *pending = NULL;                 /* object -> change mask */
+static GPtrArray   *pending_order = NULL;
+static guint        flush_idle_id = 0;
+
+static gboolean     flush_idle_func( gpointer data );
+
+static gpointer
+pspec_mask_table_init( gpointer data )
+{
+    GHashTable *table = g_hash_table_new(g_str_hash, g_str_equal);
+    gint        i;
+
+    for ( i = 0; pspec_masks[i].name != NULL; i++ ) {
+        g_hash_table_insert(table, (gpointer)pspec_masks[i].name,
+          GUINT_TO_POINTER(pspec_masks[i].change_mask));
+    }
+    return( table );
+}
+
+/* Called from the NCP reload workers too, the table is built once and
+ * never changed afterwards, so lookups need no lock.
+ */
+extern guint
+nwamui_dispatch_mask_from_pspec( GParamSpec *pspec )
+{
+    static GOnce    once = G_ONCE_INIT;     /* Property name -> change mask */
+    guint           mask;
+
+    g_once(&once, pspec_mask_table_init, NULL);
+
+    mask = GPOINTER_TO_UINT(g_hash_table_lookup((GHashTable *)once.retval, pspec->name));
+
+    return( mask != 0 ? mask : NWAMUI_CHANGE_OTHER );
+}
+
+/**
+ * nwamui_dispatch_publish:
+ * @object: the object that changed
+ * @change_mask: what changed, a combination of #nwamui_change_mask_t
+ *
+ * Queue @change_mask for @object. Masks published for the same object before
+ * the next flush are merged.
+ **/
+extern void
+nwamui_dispatch_publish( NwamuiObject *object, guint change_mask )
+{
+    guint   old_mask;
+
+    g_return_if_fail(NWAMUI_IS_OBJECT(object));
+
+    if ( change_mask == 0 || g_atomic_int_get(&num_subscriptions) == 0 ) {
+        return;
+    }
+
+    G_LOCK(pending);
+
+    if ( pending == NULL ) {
+        pending = g_hash_table_new(g_direct_hash, g_direct_equal);
+        pending_order = g_ptr_array_new();
+    }
+
+    old_mask = GPOINTER_TO_UINT(g_hash_table_lookup(pending, object));
+    if ( old_mask == 0 ) {
+        g_ptr_array_add(pending_order, g_object_ref(object));
+    }
+    g_hash_table_insert(pending, object, GUINT_TO_POINTER(old_mask | change_mask));
+
+    if ( flush_idle_id == 0 ) {
+        /* Run ahead of GTK+ redraws so widgets are updated in the same pass */
+        flush_idle_id = g_idle_add_full(G_PRIORITY_HIGH_IDLE, flush_idle_func, NULL, NULL);
+    }
+
+    G_UNLOCK(pending);
+}
+
+static void
+unlink_subscription( subscription_t *sub )
+{
+    if ( sub->object != NULL ) {
+        GSList *list = g_hash_table_lookup(object_subscriptions, sub->object);
+
+        list = g_slist_remove(list, sub);
+        if ( list != NULL ) {
+            g_hash_table_insert(object_subscriptions, sub->object, list);
+        } else {
+            g_hash_table_remove(object_subscriptions, sub->object);
+        }
+    } else {
+        any_subscriptions = g_slist_remove(any_subscriptions, sub);
+    }
+    g_free(sub);
+}
+
+static void
+remove_subscription( subscription_t *sub )
+{
+    g_hash_table_remove(subscriptions, GUINT_TO_POINTER(sub->id));
+    sub->id = 0;
+    g_atomic_int_add(&num_subscriptions, -1);
+
+    /* List nodes must stay valid while a dispatch walks them */
+    if ( dispatching > 0 ) {
+        dead_subscriptions = g_slist_prepend(dead_subscriptions, sub);
+    } else {
+        unlink_subscription(sub);
+    }
+}
+
+static void
+deliver( GSList *list, NwamuiObject *object, guint change_mask )
+{
+    /* New subscriptions are prepended, so they are not seen here */
+    for ( ; list != NULL; list = g_slist_next(list) ) {
+        subscription_t *sub = (subscription_t*)list->data;
+
+        if ( sub->id != 0 && (sub->change_mask & change_mask) != 0 ) {
+            sub->func(object, sub->change_mask & change_mask, sub->user_data);
+        }
+    }
+}
+
+static void
+flush_pending( GHashTable *table, GPtrArray *order )
+{
+    guint   i;
+
+    dispatching++;
+
+    for ( i = 0; i < order->len; i++ ) {
+        NwamuiObject   *object = NWAMUI_OBJECT(g_ptr_array_index(order, i));
+        guint           change_mask = GPOINTER_TO_UINT(g_hash_table_lookup(table, object));
+
+        if ( object_subscriptions != NULL ) {
+            deliver(g_hash_table_lookup(object_subscriptions, object), object, change_mask);
+        }
+        deliver(any_subscriptions, object, change_mask);
+
+        g_object_unref(object);
+    }
+
+    if ( --dispatching == 0 ) {
+        while ( dead_subscriptions != NULL ) {
+            unlink_subscription((subscription_t*)dead_subscriptions->data);
+            dead_subscriptions = g_slist_delete_link(dead_subscriptions, dead_subscriptions);
+        }
+    }
+
+    g_hash_table_destroy(table);
+    g_ptr_array_free(order, TRUE);
+}
+
+static gboolean
+flush_idle_func( gpointer data )
+{
+    /* Returning FALSE removes the source */
+    G_LOCK(pending);
+    flush_idle_id = 0;
+    G_UNLOCK(pending);
+
+    nwamui_dispatch_flush();
+    return( FALSE );
+}
+
+/**
+ * nwamui_dispatch_flush:
+ *
+ * Deliver all pending changes now. Must be called from the main loop.
+ **/
+extern void
+nwamui_dispatch_flush( void )
+{
+    GHashTable *table;
+    GPtrArray  *order;
+
+    G_LOCK(pending);
+    table = pending;
+    order = pending_order;
+    pending = NULL;
+    pending_order = NULL;
+    if ( flush_idle_id != 0 ) {
+        g_source_remove(flush_idle_id);
+        flush_idle_id = 0;
+    }
+    G_UNLOCK(pending);
+
+    if ( table != NULL ) {
+        flush_pending(table, order);
+    }
+}
+
+/**
+ * nwamui_dispatch_subscribe:
+ * @object: the object to watch, or NULL for all objects
+ * @change_mask: the changes of interest
+ * @func: called with the subset of @change_mask that changed
+ * @user_data: passed to @func
+ *
+ * The subscription does not hold a reference on @object, it has to be
+ * removed before the object goes away.
+ *
+ * Returns: the subscription id, for nwamui_dispatch_unsubscribe().
+ **/
+extern guint
+nwamui_dispatch_subscribe( NwamuiObject *object, guint change_mask, nwamui_dispatch_func_t func, gpointer user_data )
+{
+    subscription_t *sub;
+
+    g_return_val_if_fail(object == NULL || NWAMUI_IS_OBJECT(object), 0);
+    g_return_val_if_fail(func != NULL, 0);
+
+    if ( subscriptions == NULL ) {
+        subscriptions = g_hash_table_new(g_direct_hash, g_direct_equal);
+        object_subscriptions = g_hash_table_new(g_direct_hash, g_direct_equal);
+    }
+
+    sub = g_new0(subscription_t, 1);
+    sub->id = next_subscription_id++;
+    sub->object = object;
+    sub->change_mask = change_mask;
+    sub->func = func;
+    sub->user_data = user_data;
+
+    g_hash_table_insert(subscriptions, GUINT_TO_POINTER(sub->id), sub);
+    if ( object != NULL ) {
+        g_hash_table_insert(object_subscriptions, object,
+          g_slist_prepend(g_hash_table_lookup(object_subscriptions, object), sub));
+    } else {
+        any_subscriptions = g_slist_prepend(any_subscriptions, sub);
+    }
+    g_atomic_int_add(&num_subscriptions, 1);
+
+    return( sub->id );
+}
+
+extern void
+nwamui_dispatch_unsubscribe( guint id )
+{
+    subscription_t *sub;
+
+    if ( subscriptions == NULL || id == 0 ) {
+        return;
+    }
+
+    if ( (sub = g_hash_table_lookup(subscriptions, GUINT_TO_POINTER(id))) != NULL ) {
+        remove_subscription(sub);
+    }
+}
+
+/**
+ * nwamui_dispatch_unsubscribe_by_data:
+ * @object: the object passed to nwamui_dispatch_subscribe(), may be NULL
+ * @user_data: the data passed to nwamui_dispatch_subscribe()
+ *
+ * Remove all subscriptions on @object made with @user_data.
+ **/
+extern void
+nwamui_dispatch_unsubscribe_by_data( NwamuiObject *object, gpointer user_data )
+{
+    GSList *list;
+    GSList *matches = NULL;
+
+    if ( subscriptions == NULL ) {
+        return;
+    }
+
+    if ( object != NULL ) {
+        list = g_hash_table_lookup(object_subscriptions, object);
+    } else {
+        list = any_subscriptions;
+    }
+
+    for ( ; list != NULL; list = g_slist_next(list) ) {
+        subscription_t *sub = (subscription_t*)list->data;
+
+        if ( sub->id != 0 && sub->user_data == user_data ) {
+            matches = g_slist_prepend(matches, sub);
+        }
+    }
+
+    while ( matches != NULL ) {
+        remove_subscription((subscription_t*)matches->data);
+        matches = g_slist_delete_link(matches, matches);
+    }
+}
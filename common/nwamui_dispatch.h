@@ -0,0 +1,78 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_dispatch.h
+ *
+ */
+
+
+#ifndef _NWAMUI_DISPATCH_H
+#define	_NWAMUI_DISPATCH_H
+
+#ifndef _libnwamui_H
+#error "Please include libnwamui.h header instead."
+#endif
+
+G_BEGIN_DECLS
+
+/*
+ * Change dispatcher for NwamuiObjects. Property notifications are folded
+ * into a small change mask per object and delivered to subscribers once per
+ * main loop iteration, so a scan merge that touches a handful of properties
+ * on hundreds of wireless networks results in one callback per network and
+ * interested subscriber, instead of a "notify" emission per property and
+ * connected handler.
+ *
+ * Subscribers may register for a single object or, passing NULL, for every
+ * object. Callbacks are always run in the main loop.
+ */
+typedef enum {
+    NWAMUI_CHANGE_NONE      = 0,
+    NWAMUI_CHANGE_STATE     = 1 << 0,   /* nwam_state, status, switching */
+    NWAMUI_CHANGE_NAME      = 1 << 1,
+    NWAMUI_CHANGE_SIGNAL    = 1 << 2,   /* signal_strength, wifi_info */
+    NWAMUI_CHANGE_ENABLED   = 1 << 3,   /* enabled, activation_mode */
+    NWAMUI_CHANGE_OTHER     = 1 << 4,
+    NWAMUI_CHANGE_ACTIVE    = 1 << 5,
+    NWAMUI_CHANGE_ALL       = (1 << 6) - 1
+} nwamui_change_mask_t;
+
+typedef void (*nwamui_dispatch_func_t)(NwamuiObject *object, guint change_mask, gpointer user_data);
+
+extern guint    nwamui_dispatch_mask_from_pspec( GParamSpec *pspec );
+
+extern void     nwamui_dispatch_publish( NwamuiObject *object, guint change_mask );
+
+extern void     nwamui_dispatch_flush( void );
+
+extern guint    nwamui_dispatch_subscribe( NwamuiObject *object, guint change_mask, nwamui_dispatch_func_t func, gpointer user_data );
+
+extern void     nwamui_dispatch_unsubscribe( guint id );
+
+extern void     nwamui_dispatch_unsubscribe_by_data( NwamuiObject *object, gpointer user_data );
+
+G_END_DECLS
+
+#endif	/* _NWAMUI_DISPATCH_H */
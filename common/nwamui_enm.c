@@ -63,18 +63,10 @@ static void nwamui_enm_get_property ( GObject         *object,
 
 static void nwamui_enm_finalize (     NwamuiEnm *self);
 
-static gboolean get_nwam_enm_boolean_prop( nwam_enm_handle_t enm, const char* prop_name );
 
-static gchar* get_nwam_enm_string_prop( nwam_enm_handle_t enm, const char* prop_name );
 
-static gchar*       get_nwam_enm_string_prop( nwam_enm_handle_t enm, const char* prop_name );
-static gboolean     set_nwam_enm_string_prop( nwam_enm_handle_t enm, const char* prop_name, const char* str );
 
-static gchar**      get_nwam_enm_string_array_prop( nwam_enm_handle_t enm, const char* prop_name );
-static gboolean     set_nwam_enm_string_array_prop( nwam_enm_handle_t enm, const char* prop_name, char** strs, guint len);
 
-static guint64      get_nwam_enm_uint64_prop( nwam_enm_handle_t enm, const char* prop_name );
-static gboolean     set_nwam_enm_uint64_prop( nwam_enm_handle_t enm, const char* prop_name, guint64 value );
 
 static gint         nwamui_object_real_open(NwamuiObject *object, const gchar *name, gint flag);
 static nwam_state_t nwamui_object_real_get_nwam_state(NwamuiObject *object, nwam_aux_state_t* aux_state_p, const gchar**aux_state_string_p);
@@ -229,7 +221,7 @@ nwamui_enm_get_property (   GObject         *object,
         case PROP_START_COMMAND: {
                 gchar* start_command = NULL;
                 if (self->prv->nwam_enm != NULL) {
-                    start_command = get_nwam_enm_string_prop( self->prv->nwam_enm, NWAM_ENM_PROP_START );
+                    start_command = nwamui_prop_get_string( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_START );
                 }
                 else {
                     g_warning("Unexpected null enm handle");
@@ -241,7 +233,7 @@ nwamui_enm_get_property (   GObject         *object,
         case PROP_STOP_COMMAND: {
                 gchar* stop_command = NULL;
                 if (self->prv->nwam_enm != NULL) {
-                    stop_command = get_nwam_enm_string_prop( self->prv->nwam_enm, NWAM_ENM_PROP_STOP );
+                    stop_command = nwamui_prop_get_string( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_STOP );
                 }
                 else {
                     g_warning("Unexpected null enm handle");
@@ -253,7 +245,7 @@ nwamui_enm_get_property (   GObject         *object,
         case PROP_SMF_FMRI: {
                 gchar* smf_fmri = NULL;
                 if (self->prv->nwam_enm != NULL) {
-                    smf_fmri = get_nwam_enm_string_prop( self->prv->nwam_enm, NWAM_ENM_PROP_FMRI );
+                    smf_fmri = nwamui_prop_get_string( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_FMRI );
                 }
                 else {
                     g_warning("Unexpected null enm handle");
@@ -268,331 +260,6 @@ nwamui_enm_get_property (   GObject         *object,
     }
 }
 
-static gboolean
-get_nwam_enm_boolean_prop( nwam_enm_handle_t enm, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    boolean_t           value = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_BOOLEAN ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_enm_get_prop_value (enm, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_boolean(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get boolean value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (gboolean)value );
-}
-
-static gboolean
-set_nwam_enm_boolean_prop( nwam_enm_handle_t enm, const char* prop_name, gboolean bool_value )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( enm == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_BOOLEAN ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_boolean ((boolean_t)bool_value, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a boolean value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_enm_set_prop_value (enm, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-
-static gchar*
-get_nwam_enm_string_prop( nwam_enm_handle_t enm, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar*              retval = NULL;
-    char*               value = NULL;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( enm == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_enm_get_prop_value (enm, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL ) {
-        retval  = g_strdup ( value );
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-set_nwam_enm_string_prop( nwam_enm_handle_t enm, const char* prop_name, const gchar* str )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( enm == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_string( (char*)str, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a string value for string %s", str?str:"NULL");
-        return retval;
-    }
-
-    if ( (nerr = nwam_enm_set_prop_value (enm, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gchar**
-get_nwam_enm_string_array_prop( nwam_enm_handle_t enm, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar**             retval = NULL;
-    char**              value = NULL;
-    uint_t              num = 0;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( enm == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_enm_get_prop_value (enm, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string_array(nwam_data, &value, &num )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL && num > 0 ) {
-        int i;
-
-        /* Create a NULL terminated list of stirngs, allocate 1 extra place
-         * for NULL termination. */
-        retval = (gchar**)g_malloc0( sizeof(gchar*) * (num+1) );
-
-        for (i = 0; i < num; i++ ) {
-            retval[i]  = g_strdup ( value[i] );
-        }
-        retval[num]=NULL;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-set_nwam_enm_string_array_prop( nwam_enm_handle_t enm, const char* prop_name, char** strs, guint len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( enm == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( strs == NULL ) {
-        nwam_error_t nerr;
-
-        /* Delete property, don't set to empty list */
-        if ( (nerr = nwam_enm_delete_prop( enm, prop_name ))  != NWAM_SUCCESS ) {
-            retval = FALSE;
-        }
-        else {
-            retval = TRUE;
-        }
-        return retval;
-    }
-
-
-    if ( len == 0 ) { /* Assume a strv, i.e. NULL terminated list, otherwise strs would be NULL */
-        int i;
-
-        for( i = 0; strs != NULL && strs[i] != NULL; i++ ) {
-            /* Do Nothing, just count. */
-        }
-        len = i;
-    }
-
-    if ( (nerr = nwam_value_create_string_array (strs, len, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a value for string array 0x%08X", strs);
-        return retval;
-    }
-
-    if ( (nerr = nwam_enm_set_prop_value (enm, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static guint64
-get_nwam_enm_uint64_prop( nwam_enm_handle_t enm, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t            value = 0;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( enm == NULL ) {
-        return( value );
-    }
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_enm_get_prop_value (enm, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_uint64(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (guint64)value );
-}
-
-static gboolean
-set_nwam_enm_uint64_prop( nwam_enm_handle_t enm, const char* prop_name, guint64 value )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( enm == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_enm_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for enm property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_uint64 (value, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a uint64 value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_enm_set_prop_value (enm, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for enm property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
 /**
  * nwamui_enm_new:
  * @returns: a new #NwamuiEnm.
@@ -839,7 +506,7 @@ nwamui_object_real_set_enabled (   NwamuiObject *object, gboolean        enabled
     nwam_error_t    nerr;
 
     if (prv->nwam_enm != NULL) {
-        if ( !set_nwam_enm_boolean_prop( prv->nwam_enm, NWAM_ENM_PROP_ENABLED, enabled ) ) {
+        if ( !nwamui_prop_set_boolean( NWAMUI_PROP_CLASS_ENM, prv->nwam_enm, NWAM_ENM_PROP_ENABLED, enabled ) ) {
             g_debug("Error setting ENM boolean prop ENABLED");
         }
         prv->nwam_enm_modified = TRUE;
@@ -864,7 +531,7 @@ nwamui_object_real_get_enabled (NwamuiObject *object)
     g_return_val_if_fail (NWAMUI_IS_ENM (object), enabled);
 
     if (prv->nwam_enm != NULL) {
-        enabled = get_nwam_enm_boolean_prop( prv->nwam_enm, NWAM_ENM_PROP_ENABLED ); 
+        enabled = nwamui_prop_get_boolean( NWAMUI_PROP_CLASS_ENM, prv->nwam_enm, NWAM_ENM_PROP_ENABLED ); 
     } else {
         g_warning("Unexpected null enm handle");
     }
@@ -889,7 +556,7 @@ nwamui_enm_set_start_command (   NwamuiEnm *self,
         gboolean delete_prop = TRUE;
 
         if ( start_command != NULL && strlen( start_command ) > 0 ) {
-            if ( !set_nwam_enm_string_prop( self->prv->nwam_enm, NWAM_ENM_PROP_START, start_command ) ) {
+            if ( !nwamui_prop_set_string( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_START, start_command ) ) {
                 return( FALSE );
             }
         }
@@ -943,7 +610,7 @@ nwamui_enm_set_stop_command (   NwamuiEnm *self,
         gboolean delete_prop = TRUE;
 
         if ( stop_command != NULL && strlen( stop_command ) > 0 ) {
-            if ( !set_nwam_enm_string_prop( self->prv->nwam_enm, NWAM_ENM_PROP_STOP, stop_command ) ) {
+            if ( !nwamui_prop_set_string( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_STOP, stop_command ) ) {
                 return( FALSE );
             }
         } else {
@@ -1000,7 +667,7 @@ nwamui_enm_set_smf_fmri (   NwamuiEnm *self,
         gboolean delete_prop = TRUE;
 
         if ( smf_fmri != NULL && strlen( smf_fmri ) > 0 ) {
-            if ( !set_nwam_enm_string_prop( self->prv->nwam_enm, NWAM_ENM_PROP_FMRI, smf_fmri ) ) {
+            if ( !nwamui_prop_set_string( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_FMRI, smf_fmri ) ) {
                 return( FALSE );
             }
         }
@@ -1051,7 +718,7 @@ nwamui_object_real_set_activation_mode ( NwamuiObject *object, gint activation_m
 
     if (self->prv->nwam_enm != NULL) {
 
-        set_nwam_enm_uint64_prop( self->prv->nwam_enm, NWAM_ENM_PROP_ACTIVATION_MODE, (guint64)nwamui_from_ui_activation_mode(activation_mode) );
+        nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_ACTIVATION_MODE, (guint64)nwamui_from_ui_activation_mode(activation_mode) );
         self->prv->nwam_enm_modified = TRUE;
     } else {
         g_warning("Unexpected null enm handle");
@@ -1068,7 +735,7 @@ nwamui_object_real_get_activation_mode ( NwamuiObject *object )
     g_return_val_if_fail (NWAMUI_IS_ENM (self), activation_mode );
 
     if (self->prv->nwam_enm != NULL) {
-        nwamvalue = get_nwam_enm_uint64_prop( self->prv->nwam_enm, NWAM_ENM_PROP_ACTIVATION_MODE );
+        nwamvalue = nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_ENM, self->prv->nwam_enm, NWAM_ENM_PROP_ACTIVATION_MODE );
     }
     else {
         g_warning("Unexpected null enm handle");
@@ -1088,7 +755,7 @@ nwamui_object_real_get_conditions( NwamuiObject *object )
     g_return_val_if_fail(NWAMUI_IS_ENM(object), conditions );
 
     if (prv->nwam_enm != NULL) {
-        gchar** condition_strs = get_nwam_enm_string_array_prop(prv->nwam_enm, NWAM_ENM_PROP_CONDITIONS);
+        gchar** condition_strs = nwamui_prop_get_string_array(NWAMUI_PROP_CLASS_ENM, prv->nwam_enm, NWAM_ENM_PROP_CONDITIONS, NULL );
         conditions = nwamui_util_map_condition_strings_to_object_list( condition_strs );
         g_strfreev( condition_strs );
     } else {
@@ -1118,7 +785,7 @@ nwamui_object_real_set_conditions( NwamuiObject *object, const GList* conditions
             nwamui_object_real_set_enabled(object, FALSE );
             nwamui_object_real_set_activation_mode(object, NWAMUI_COND_ACTIVATION_MODE_MANUAL);
         } else {
-            set_nwam_enm_string_array_prop(prv->nwam_enm, NWAM_ENM_PROP_CONDITIONS, condition_strs, len);
+            nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_ENM, prv->nwam_enm, NWAM_ENM_PROP_CONDITIONS, condition_strs, len);
             prv->nwam_enm_modified = TRUE;
             g_debug("%s set conditions", prv->name);
             free(condition_strs);
@@ -46,7 +46,8 @@ struct _NwamuiEnvPrivate {
     gboolean                    nwam_loc_modified;
     gboolean                    enabled; /* Cache state we we can "enable" on commit */
 
-    GtkListStore*               svcs_model;
+    GHashTable*                 svcs;       /* Case-folded FMRI -> NwamuiSvc */
+    GtkListStore*               svcs_model; /* View of svcs, built on demand */
     GtkListStore*               sys_svcs_model;
 
     /* Not used for Phase 1 any more */
@@ -135,21 +136,10 @@ static void nwamui_env_finalize (     NwamuiEnv *self);
 static guint64*     convert_name_services_glist_to_unint64_array( GList* ns_glist, guint *count );
 static GList*       convert_name_services_uint64_array_to_glist( guint64* ns_list, guint count );
 
-static gboolean     get_nwam_loc_boolean_prop( nwam_loc_handle_t loc, const char* prop_name );
-static gboolean     set_nwam_loc_boolean_prop( nwam_loc_handle_t loc, const char* prop_name, gboolean bool_value );
 
-static gchar*       get_nwam_loc_string_prop( nwam_loc_handle_t loc, const char* prop_name );
-static gboolean     set_nwam_loc_string_prop( nwam_loc_handle_t loc, const char* prop_name, const char* str );
 
-static gchar**      get_nwam_loc_string_array_prop( nwam_loc_handle_t loc, const char* prop_name );
-static gboolean     set_nwam_loc_string_array_prop( nwam_loc_handle_t loc, const char* prop_name, char** strs, guint len);
 
-static guint64      get_nwam_loc_uint64_prop( nwam_loc_handle_t loc, const char* prop_name );
-static gboolean     set_nwam_loc_uint64_prop( nwam_loc_handle_t loc, const char* prop_name, guint64 value );
 
-static guint64*     get_nwam_loc_uint64_array_prop( nwam_loc_handle_t loc, const char* prop_name , guint* out_num );
-static gboolean     set_nwam_loc_uint64_array_prop( nwam_loc_handle_t loc, const char* prop_name , 
-                                                    const guint64* value, guint len );
 
 static gint         nwamui_object_real_open(NwamuiObject *object, const gchar *name, gint flag);
 static nwam_state_t nwamui_object_real_get_nwam_state(NwamuiObject *object, nwam_aux_state_t* aux_state_p, const gchar**aux_state_string_p);
@@ -162,6 +152,7 @@ static void         nwamui_object_real_set_conditions ( NwamuiObject *object, co
 static GList*       nwamui_object_real_get_conditions ( NwamuiObject *object );
 static gboolean     nwamui_object_real_get_active (NwamuiObject *object);
 static void         nwamui_object_real_set_active (NwamuiObject *object, gboolean active );
+static gint         nwamui_object_real_activate (const gchar *name, gboolean active );
 static void         nwamui_object_real_set_enabled ( NwamuiObject *object, gboolean enabled );
 static gboolean     nwamui_object_real_get_enabled ( NwamuiObject *object );
 static gboolean     nwamui_object_real_validate(NwamuiObject *object, gchar **prop_name_ret);
@@ -215,6 +206,7 @@ nwamui_env_class_init (NwamuiEnvClass *klass)
     nwamuiobject_class->set_activation_mode = nwamui_object_real_set_activation_mode;
     nwamuiobject_class->get_active = nwamui_object_real_get_active;
     nwamuiobject_class->set_active = nwamui_object_real_set_active;
+    nwamuiobject_class->activate = nwamui_object_real_activate;
     nwamuiobject_class->get_enabled = nwamui_object_real_get_enabled;
     nwamuiobject_class->set_enabled = nwamui_object_real_set_enabled;
     nwamuiobject_class->get_nwam_state = nwamui_object_real_get_nwam_state;
@@ -557,7 +549,7 @@ nwamui_env_init (NwamuiEnv *self)
     NwamuiEnvPrivate *prv      = NWAMUI_ENV_GET_PRIVATE(self);
     self->prv = prv;
     
-    prv->svcs_model = gtk_list_store_new(SVC_N_COL, G_TYPE_OBJECT);
+    prv->svcs = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_object_unref);
 
 #ifdef ENABLE_PROXY
     prv->proxy_type = NWAMUI_ENV_PROXY_TYPE_DIRECT;
@@ -567,12 +559,38 @@ nwamui_env_init (NwamuiEnv *self)
     prv->proxy_gopher_port = 80;
     prv->proxy_socks_port = 1080;
 #endif /* ENABLE_PROXY */
+}
+
+/* The services model is only a view for the location dialog, build it from
+ * the service table the first time it's asked for and keep it in step after
+ * that.
+ */
+static GtkListStore*
+nwamui_env_get_svcs_model(NwamuiEnv *self)
+{
+    NwamuiEnvPrivate *prv = NWAMUI_ENV_GET_PRIVATE(self);
 
-    /*
-    g_signal_connect(G_OBJECT(prv->svcs_model), "row-deleted", (GCallback)svc_row_deleted_cb, (gpointer)self);
-    g_signal_connect(G_OBJECT(prv->svcs_model), "row-changed", (GCallback)svc_row_inserted_or_changed_cb, (gpointer)self);
-    g_signal_connect(G_OBJECT(prv->svcs_model), "row-inserted", (GCallback)svc_row_inserted_or_changed_cb, (gpointer)self);
-    */
+    if (prv->svcs_model == NULL) {
+        GHashTableIter  hiter;
+        NwamuiSvc      *svcobj;
+
+        prv->svcs_model = gtk_list_store_new(SVC_N_COL, G_TYPE_OBJECT);
+
+        g_hash_table_iter_init(&hiter, prv->svcs);
+        while (g_hash_table_iter_next(&hiter, NULL, (gpointer*)&svcobj)) {
+            GtkTreeIter iter;
+
+            gtk_list_store_insert_with_values(prv->svcs_model, &iter, -1,
+              SVC_OBJECT, svcobj, -1);
+        }
+
+        /*
+        g_signal_connect(G_OBJECT(prv->svcs_model), "row-deleted", (GCallback)svc_row_deleted_cb, (gpointer)self);
+        g_signal_connect(G_OBJECT(prv->svcs_model), "row-changed", (GCallback)svc_row_inserted_or_changed_cb, (gpointer)self);
+        g_signal_connect(G_OBJECT(prv->svcs_model), "row-inserted", (GCallback)svc_row_inserted_or_changed_cb, (gpointer)self);
+        */
+    }
+    return prv->svcs_model;
 }
 
 static void
@@ -670,7 +688,7 @@ nwamui_env_set_property (   GObject         *object,
     case PROP_SVCS_ENABLE: {
         GList*  fmri = g_value_get_pointer( value );
         gchar** fmri_strs = nwamui_util_glist_to_strv( fmri );
-        set_nwam_loc_string_array_prop( self->prv->nwam_loc, NWAM_LOC_PROP_SVCS_ENABLE, fmri_strs, 0 );
+        nwamui_prop_set_string_array( NWAMUI_PROP_CLASS_LOC, self->prv->nwam_loc, NWAM_LOC_PROP_SVCS_ENABLE, fmri_strs, 0 );
         g_strfreev(fmri_strs);
     }
         break;
@@ -678,7 +696,7 @@ nwamui_env_set_property (   GObject         *object,
     case PROP_SVCS_DISABLE: {
         GList*  fmri = g_value_get_pointer( value );
         gchar** fmri_strs = nwamui_util_glist_to_strv( fmri );
-        set_nwam_loc_string_array_prop( self->prv->nwam_loc, NWAM_LOC_PROP_SVCS_DISABLE, fmri_strs, 0 );
+        nwamui_prop_set_string_array( NWAMUI_PROP_CLASS_LOC, self->prv->nwam_loc, NWAM_LOC_PROP_SVCS_DISABLE, fmri_strs, 0 );
         g_strfreev(fmri_strs);
     }
         break;
@@ -932,14 +950,14 @@ nwamui_env_get_property (GObject         *object,
 
 #ifdef ENABLE_NETSERVICES
     case PROP_SVCS_ENABLE: {
-        gchar **strv = get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_SVCS_ENABLE );
+        gchar **strv = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_SVCS_ENABLE, NULL );
         g_value_set_pointer( value, nwamui_util_strv_to_glist( strv ) );
         g_strfreev( strv );
     }
         break;
 
     case PROP_SVCS_DISABLE: {
-        gchar **strv = get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_SVCS_DISABLE );
+        gchar **strv = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_SVCS_DISABLE, NULL );
         g_value_set_pointer( value, nwamui_util_strv_to_glist( strv ) );
         g_strfreev( strv );
     }
@@ -947,7 +965,7 @@ nwamui_env_get_property (GObject         *object,
 #endif /* ENABLE_NETSERVICES */
 
         case PROP_SVCS: {
-                g_value_set_object (value, self->prv->svcs_model);
+                g_value_set_object (value, nwamui_env_get_svcs_model(self));
             }
             break;
 
@@ -1102,406 +1120,6 @@ nwamui_env_new_with_handle (nwam_loc_handle_t envh)
     return object;
 }
 
-static gchar*
-get_nwam_loc_string_prop( nwam_loc_handle_t loc, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar*              retval = NULL;
-    char*               value = NULL;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_loc_get_prop_value (loc, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL ) {
-        retval  = g_strdup ( value );
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-set_nwam_loc_string_prop( nwam_loc_handle_t loc, const char* prop_name, const gchar* str )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( loc == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-    if (str != NULL && *str != '\0') {
-        /* str is meaningful */
-
-        if ( (nerr = nwam_value_create_string( (char*)str, &nwam_data )) != NWAM_SUCCESS ) {
-            g_debug("Error creating a string value for string %s", str?str:"NULL");
-            return retval;
-        }
-
-        if ( (nerr = nwam_loc_set_prop_value (loc, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-            g_debug("Unable to set value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        }
-        else {
-            retval = TRUE;
-        }
-
-        nwam_value_free(nwam_data);
-    } else {
-        /* str is empty or NULL */
-
-        if ( (nerr = nwam_loc_delete_prop (loc, prop_name)) != NWAM_SUCCESS ) {
-            g_debug("Unable to delete loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        }
-        else {
-            retval = TRUE;
-        }
-    }
-    
-    return( retval );
-}
-
-
-static gchar**
-get_nwam_loc_string_array_prop( nwam_loc_handle_t loc, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar**             retval = NULL;
-    char**              value = NULL;
-    uint_t              num = 0;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_loc_get_prop_value (loc, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string_array(nwam_data, &value, &num )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL && num > 0 ) {
-        int i;
-
-        /* Create a NULL terminated list of stirngs, allocate 1 extra place
-         * for NULL termination. */
-        retval = (gchar**)g_malloc0( sizeof(gchar*) * (num+1) );
-
-        for ( i = 0; i < num; i++ ) {
-            retval[i]  = g_strdup ( value[i] );
-        }
-        retval[num]=NULL;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-set_nwam_loc_string_array_prop( nwam_loc_handle_t loc, const char* prop_name, char** strs, guint len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( loc == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( strs == NULL ) {
-        if ( (nerr = nwam_loc_delete_prop (loc, prop_name)) != NWAM_SUCCESS ) {
-            g_debug("Unable to delete loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        }
-        else {
-            retval = TRUE;
-        }
-        return retval;
-    }
-
-
-    if ( len == 0 ) { /* Assume a strv, i.e. NULL terminated list, otherwise strs would be NULL */
-        int i;
-
-        for( i = 0; strs != NULL && strs[i] != NULL; i++ ) {
-            /* Do Nothing, just count. */
-        }
-        len = i;
-    }
-
-    if ( (nerr = nwam_value_create_string_array (strs, len, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a value for string array 0x%08X", strs);
-        return retval;
-    }
-
-    if ( (nerr = nwam_loc_set_prop_value (loc, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-get_nwam_loc_boolean_prop( nwam_loc_handle_t loc, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    boolean_t           value = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_BOOLEAN ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_loc_get_prop_value (loc, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_boolean(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get boolean value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (gboolean)value );
-}
-
-static gboolean
-set_nwam_loc_boolean_prop( nwam_loc_handle_t loc, const char* prop_name, gboolean bool_value )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( loc == NULL ) {
-        return( retval );
-    }
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_BOOLEAN ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_boolean ((boolean_t)bool_value, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a boolean value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_loc_set_prop_value (loc, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( retval );
-}
-
-static guint64
-get_nwam_loc_uint64_prop( nwam_loc_handle_t loc, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t            value = 0;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_loc_get_prop_value (loc, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_uint64(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (guint64)value );
-}
-
-static gboolean
-set_nwam_loc_uint64_prop( nwam_loc_handle_t loc, const char* prop_name, guint64 value )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( loc == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_uint64 (value, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a uint64 value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_loc_set_prop_value (loc, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static guint64* 
-get_nwam_loc_uint64_array_prop( nwam_loc_handle_t loc, const char* prop_name , guint *out_num )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t           *value = NULL;
-    uint_t              num = 0;
-    guint64            *retval = NULL;
-    int                 i;
-
-    g_return_val_if_fail( prop_name != NULL && out_num != NULL, retval );
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_loc_get_prop_value (loc, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_uint64_array(nwam_data, &value, &num )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    retval = (guint64*)g_malloc( sizeof(guint64) * num );
-    for ( i = 0; i < num; i++ ) {
-        retval[i] = (guint64)value[i];
-    }
-
-    nwam_value_free(nwam_data);
-
-    *out_num = num;
-
-    return( retval );
-}
-
-static gboolean
-set_nwam_loc_uint64_array_prop( nwam_loc_handle_t loc, const char* prop_name, 
-                                const guint64 *value_array, guint len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( loc == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_loc_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for loc property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_uint64_array ((uint64_t*)value_array, len, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a uint64 array value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_loc_set_prop_value (loc, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for loc property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-
 static GList*
 convert_name_services_uint64_array_to_glist( guint64* ns_list, guint count )
 {
@@ -1560,50 +1178,50 @@ populate_env_with_handle( NwamuiEnv* env, nwam_loc_handle_t prv->nwam_loc )
     guint               num_nameservices = 0;
     nwam_nameservices_t *nameservices = NULL;
 
-    prv->modifiable = !get_nwam_loc_boolean_prop( prv->nwam_loc, NWAM_LOC_PROP_READ_ONLY );
-    prv->activation_mode = (nwamui_cond_activation_mode_t)get_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_ACTIVATION_MODE );
-    condition_str = get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_CONDITIONS );
+    prv->modifiable = !nwamui_prop_get_boolean( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_READ_ONLY );
+    prv->activation_mode = (nwamui_cond_activation_mode_t)nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_ACTIVATION_MODE );
+    condition_str = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_CONDITIONS, NULL );
     prv->conditions = nwamui_util_map_condition_strings_to_object_list( condition_str);
     g_strfreev( condition_str );
 
-    prv->enabled = get_nwam_loc_boolean_prop( prv->nwam_loc, NWAM_LOC_PROP_ENABLED );
+    prv->enabled = nwamui_prop_get_boolean( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_ENABLED );
 
     /* Nameservice location properties */
-    nameservices = (nwam_nameservices_t*)get_nwam_loc_uint64_array_prop(
+    nameservices = (nwam_nameservices_t*)nwamui_prop_get_uint64_array(NWAMUI_PROP_CLASS_LOC, 
                                            prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES, &num_nameservices );
     prv->nameservices = convert_name_services_array_to_glist( nameservices, num_nameservices );
-    prv->nameservices_config_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES_CONFIG_FILE );
-    prv->default_domainname = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_DEFAULT_DOMAIN );
-    prv->dns_nameservice_domain = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_DOMAIN );
+    prv->nameservices_config_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES_CONFIG_FILE );
+    prv->default_domainname = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DEFAULT_DOMAIN );
+    prv->dns_nameservice_domain = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_DOMAIN );
     prv->dns_nameservice_servers = nwamui_util_strv_to_glist(
-            get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SERVERS ) );
-    prv->dns_nameservice_search = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SEARCH );
+            nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SERVERS, NULL ) );
+    prv->dns_nameservice_search = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SEARCH );
     prv->nis_nameservice_servers = nwamui_util_strv_to_glist(
-        get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_SERVERS ) );
+        nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_SERVERS, NULL ) );
     prv->ldap_nameservice_servers = nwamui_util_strv_to_glist(
-        get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_SERVERS ) );
+        nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_SERVERS, NULL ) );
 
     /* Path to hosts/ipnodes database */
-    prv->hosts_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_HOSTS_FILE );
+    prv->hosts_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_HOSTS_FILE );
 
     /* NFSv4 domain */
-    prv->nfsv4_domain = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_NFSV4_DOMAIN );
+    prv->nfsv4_domain = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NFSV4_DOMAIN );
 
     /* IPfilter configuration */
-    prv->ipfilter_config_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_CONFIG_FILE );
-    prv->ipfilter_v6_config_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_V6_CONFIG_FILE );
-    prv->ipnat_config_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPNAT_CONFIG_FILE );
-    prv->ippool_config_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPPOOL_CONFIG_FILE );
+    prv->ipfilter_config_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_CONFIG_FILE );
+    prv->ipfilter_v6_config_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_V6_CONFIG_FILE );
+    prv->ipnat_config_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPNAT_CONFIG_FILE );
+    prv->ippool_config_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPPOOL_CONFIG_FILE );
 
     /* IPsec configuration */
-    prv->ike_config_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IKE_CONFIG_FILE );
-    prv->ipsecpolicy_config_file = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPSECPOLICY_CONFIG_FILE );
+    prv->ike_config_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IKE_CONFIG_FILE );
+    prv->ipsecpolicy_config_file = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPSECPOLICY_CONFIG_FILE );
 
     /* List of SMF services to enable/disable */
     prv->svcs_enable = nwamui_util_strv_to_glist(
-            get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_SVCS_ENABLE ) );
+            nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_SVCS_ENABLE, NULL ) );
     prv->svcs_disable = nwamui_util_strv_to_glist(
-        get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_SVCS_DISABLE ) );
+        nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_SVCS_DISABLE, NULL ) );
 }
 #endif /* 0 */
 
@@ -1764,7 +1382,7 @@ nwamui_object_real_reload(NwamuiObject* object)
     g_object_notify(G_OBJECT(object), "activation-mode");
 
     /* Initialise enabled to be the original value */
-    enabled = get_nwam_loc_boolean_prop( prv->nwam_loc, NWAM_LOC_PROP_ENABLED );
+    enabled = nwamui_prop_get_boolean( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_ENABLED );
 
     if ( prv->enabled != enabled ) {
         g_object_notify(G_OBJECT(object), "enabled" );
@@ -1888,21 +1506,43 @@ static void
 nwamui_object_real_set_active (NwamuiObject *object, gboolean active )
 {
     NwamuiEnv *self = NWAMUI_ENV(object);
+    nwam_error_t nerr;
+
     g_return_if_fail (NWAMUI_IS_ENV (self));
 
     /* Activate immediately */
     if ( active ) {
-        nwam_error_t nerr;
-        if ( (nerr = nwam_loc_enable (self->prv->nwam_loc)) != NWAM_SUCCESS ) {
-            g_warning("Failed to enable location due to error: %s", nwam_strerror(nerr));
-        }
+        nerr = nwam_loc_enable (self->prv->nwam_loc);
     }
     else {
-        nwam_error_t nerr;
-        if ( (nerr = nwam_loc_disable (self->prv->nwam_loc)) != NWAM_SUCCESS ) {
-            g_warning("Failed to disable location due to error: %s", nwam_strerror(nerr));
-        }
+        nerr = nwam_loc_disable (self->prv->nwam_loc);
+    }
+    if ( nerr != NWAM_SUCCESS ) {
+        g_warning("Failed to %s location due to error: %s",
+          active ? "enable" : "disable", nwam_strerror(nerr));
+    }
+}
+
+/* Blocking, called from a worker thread. The object's own handle may be
+ * replaced by a reload meanwhile, so read a private one.
+ */
+static gint
+nwamui_object_real_activate (const gchar *name, gboolean active )
+{
+    nwam_loc_handle_t   handle;
+    nwam_error_t        nerr;
+
+    if ( (nerr = nwam_loc_read (name, 0, &handle)) != NWAM_SUCCESS ) {
+        return nerr;
     }
+    if ( active ) {
+        nerr = nwam_loc_enable (handle);
+    }
+    else {
+        nerr = nwam_loc_disable (handle);
+    }
+    nwam_loc_free (handle);
+    return nerr;
 }
 
 
@@ -1923,7 +1563,7 @@ nwamui_env_set_nameservices (   NwamuiEnv *self,
     guint                   count = 0;
 
     ns_array = convert_name_services_glist_to_unint64_array((GList*)nameservices, &count );
-    set_nwam_loc_uint64_array_prop( prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES, 
+    nwamui_prop_set_uint64_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES, 
       ns_array, count );
 
     prv->nwam_loc_modified = TRUE;
@@ -1943,7 +1583,7 @@ nwamui_env_get_nameservices (NwamuiEnv *self)
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
     guint       num_nameservices = 0;
-    guint64*    ns_64 = (guint64*)get_nwam_loc_uint64_array_prop(
+    guint64*    ns_64 = (guint64*)nwamui_prop_get_uint64_array(NWAMUI_PROP_CLASS_LOC, 
         prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES, &num_nameservices );
     GList*      ns_list = convert_name_services_uint64_array_to_glist( ns_64, num_nameservices );
     return ns_list;
@@ -1962,7 +1602,7 @@ nwamui_env_set_nameservices_config_file (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES_CONFIG_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES_CONFIG_FILE, 
       nameservices_config_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -1981,7 +1621,7 @@ nwamui_env_get_nameservices_config_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES_CONFIG_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NAMESERVICES_CONFIG_FILE );
     return str;
 }
 
@@ -1998,7 +1638,7 @@ nwamui_env_set_default_domainname (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_DEFAULT_DOMAIN, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DEFAULT_DOMAIN, 
       default_domainname);
 
     prv->nwam_loc_modified = TRUE;
@@ -2019,7 +1659,7 @@ nwamui_env_get_default_domainname (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), default_domainname);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    default_domainname = get_nwam_loc_string_prop(prv->nwam_loc, NWAM_LOC_PROP_DEFAULT_DOMAIN);
+    default_domainname = nwamui_prop_get_string(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DEFAULT_DOMAIN);
 
     return( default_domainname );
 }
@@ -2037,7 +1677,7 @@ nwamui_env_set_dns_nameservice_domain (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop(prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_DOMAIN,
+    nwamui_prop_set_string(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_DOMAIN,
       dns_nameservice_domain);
 
     prv->nwam_loc_modified = TRUE;
@@ -2058,7 +1698,7 @@ nwamui_env_get_dns_nameservice_domain (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), dns_nameservice_domain);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    dns_nameservice_domain = get_nwam_loc_string_prop(prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_DOMAIN);
+    dns_nameservice_domain = nwamui_prop_get_string(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_DOMAIN);
 
     return( dns_nameservice_domain );
 }
@@ -2078,7 +1718,7 @@ nwamui_env_set_dns_nameservice_config_source (   NwamuiEnv *self,
               && dns_nameservice_config_source <= NWAMUI_COND_ACTIVATION_MODE_LAST );
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_CONFIGSRC, dns_nameservice_config_source);
+    nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_CONFIGSRC, dns_nameservice_config_source);
 
     prv->nwam_loc_modified = TRUE;
 	g_object_notify(G_OBJECT(self), "dns_nameservice_config_source");
@@ -2096,7 +1736,7 @@ nwamui_env_get_dns_nameservice_config_source (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NWAMUI_ENV_CONFIG_SOURCE_DHCP);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    return (gint)get_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_CONFIGSRC );
+    return (gint)nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_CONFIGSRC );
 }
 
 /** 
@@ -2113,7 +1753,7 @@ nwamui_env_set_dns_nameservice_servers (   NwamuiEnv *self,
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
     gchar** ns_server_strs = nwamui_util_glist_to_strv((GList*)dns_nameservice_servers);
-    set_nwam_loc_string_array_prop(prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SERVERS, ns_server_strs, 0 );
+    nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SERVERS, ns_server_strs, 0 );
     g_strfreev(ns_server_strs);
 
     prv->nwam_loc_modified = TRUE;
@@ -2134,7 +1774,7 @@ nwamui_env_get_dns_nameservice_servers (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), dns_nameservice_servers);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar **strv = get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SERVERS );
+    gchar **strv = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SERVERS, NULL );
     dns_nameservice_servers = nwamui_util_strv_to_glist( strv );
     g_strfreev( strv );
 
@@ -2156,7 +1796,7 @@ nwamui_env_set_dns_nameservice_search (   NwamuiEnv *self,
 
     gchar** ns_server_strs = nwamui_util_glist_to_strv((GList*)dns_nameservice_search);
     /* We may need to/from convert to , separated string?? */
-    set_nwam_loc_string_array_prop(prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SEARCH, ns_server_strs, 0 );
+    nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SEARCH, ns_server_strs, 0 );
     g_strfreev(ns_server_strs);
 
     prv->nwam_loc_modified = TRUE;
@@ -2177,7 +1817,7 @@ nwamui_env_get_dns_nameservice_search (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), dns_nameservice_search);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar **strv = get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SEARCH );
+    gchar **strv = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_DNS_NAMESERVICE_SEARCH, NULL );
     /* We may need to/from convert to , separated string?? */
     dns_nameservice_search = nwamui_util_strv_to_glist( strv );
     g_strfreev( strv );
@@ -2200,7 +1840,7 @@ nwamui_env_set_nis_nameservice_config_source (   NwamuiEnv *self,
               && nis_nameservice_config_source <= NWAMUI_COND_ACTIVATION_MODE_LAST );
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_CONFIGSRC, nis_nameservice_config_source);
+    nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_CONFIGSRC, nis_nameservice_config_source);
 
     prv->nwam_loc_modified = TRUE;
 	g_object_notify(G_OBJECT(self), "nis_nameservice_config_source");
@@ -2218,7 +1858,7 @@ nwamui_env_get_nis_nameservice_config_source (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NWAMUI_ENV_CONFIG_SOURCE_DHCP);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    return (gint)get_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_CONFIGSRC );
+    return (gint)nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_CONFIGSRC );
 }
 
 /** 
@@ -2235,7 +1875,7 @@ nwamui_env_set_nis_nameservice_servers (   NwamuiEnv *self,
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
     gchar** ns_server_strs = nwamui_util_glist_to_strv((GList*)nis_nameservice_servers);
-    set_nwam_loc_string_array_prop(prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_SERVERS, ns_server_strs, 0 );
+    nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_SERVERS, ns_server_strs, 0 );
     g_strfreev(ns_server_strs);
 
     prv->nwam_loc_modified = TRUE;
@@ -2256,7 +1896,7 @@ nwamui_env_get_nis_nameservice_servers (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), nis_nameservice_servers);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar **strv = get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_SERVERS );
+    gchar **strv = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NIS_NAMESERVICE_SERVERS, NULL );
     nis_nameservice_servers = nwamui_util_strv_to_glist( strv );
     g_strfreev( strv );
 
@@ -2278,7 +1918,7 @@ nwamui_env_set_ldap_nameservice_config_source (   NwamuiEnv *self,
               && ldap_nameservice_config_source <= NWAMUI_COND_ACTIVATION_MODE_LAST );
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_uint64_prop(prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_CONFIGSRC, ldap_nameservice_config_source);
+    nwamui_prop_set_uint64(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_CONFIGSRC, ldap_nameservice_config_source);
 
     prv->nwam_loc_modified = TRUE;
 	g_object_notify(G_OBJECT(self), "ldap_nameservice_config_source");
@@ -2296,7 +1936,7 @@ nwamui_env_get_ldap_nameservice_config_source (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NWAMUI_ENV_CONFIG_SOURCE_DHCP);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    return (gint)get_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_CONFIGSRC );
+    return (gint)nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_CONFIGSRC );
 }
 
 /** 
@@ -2313,7 +1953,7 @@ nwamui_env_set_ldap_nameservice_servers (   NwamuiEnv *self,
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
     gchar** ns_server_strs = nwamui_util_glist_to_strv((GList*)ldap_nameservice_servers);
-    set_nwam_loc_string_array_prop(prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_SERVERS, ns_server_strs, 0 );
+    nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_SERVERS, ns_server_strs, 0 );
     g_strfreev(ns_server_strs);
 
     prv->nwam_loc_modified = TRUE;
@@ -2334,7 +1974,7 @@ nwamui_env_get_ldap_nameservice_servers (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), ldap_nameservice_servers);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar **strv = get_nwam_loc_string_array_prop( prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_SERVERS );
+    gchar **strv = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_LDAP_NAMESERVICE_SERVERS, NULL );
     ldap_nameservice_servers = nwamui_util_strv_to_glist( strv );
 g_strfreev( strv );
 
@@ -2354,7 +1994,7 @@ nwamui_env_set_hosts_file (   NwamuiEnv *self,
 {
     g_return_if_fail (NWAMUI_IS_ENV (self));
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_HOSTS_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_HOSTS_FILE, 
       hosts_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -2373,7 +2013,7 @@ nwamui_env_get_hosts_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), hosts_file);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_HOSTS_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_HOSTS_FILE );
 
     return str;
 }
@@ -2392,7 +2032,7 @@ nwamui_env_set_nfsv4_domain (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_NFSV4_DOMAIN, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NFSV4_DOMAIN, 
       nfsv4_domain);
 
     prv->nwam_loc_modified = TRUE;
@@ -2411,7 +2051,7 @@ nwamui_env_get_nfsv4_domain (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_NFSV4_DOMAIN );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_NFSV4_DOMAIN );
     return str;
 }
 
@@ -2428,7 +2068,7 @@ nwamui_env_set_ipfilter_config_file (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_CONFIG_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_CONFIG_FILE, 
       ipfilter_config_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -2447,7 +2087,7 @@ nwamui_env_get_ipfilter_config_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_CONFIG_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_CONFIG_FILE );
     return str;
 }
 
@@ -2464,7 +2104,7 @@ nwamui_env_set_ipfilter_v6_config_file (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_V6_CONFIG_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_V6_CONFIG_FILE, 
       ipfilter_v6_config_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -2483,7 +2123,7 @@ nwamui_env_get_ipfilter_v6_config_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_V6_CONFIG_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPFILTER_V6_CONFIG_FILE );
     return str;
 }
 
@@ -2500,7 +2140,7 @@ nwamui_env_set_ipnat_config_file (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPNAT_CONFIG_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPNAT_CONFIG_FILE, 
       ipnat_config_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -2519,7 +2159,7 @@ nwamui_env_get_ipnat_config_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPNAT_CONFIG_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPNAT_CONFIG_FILE );
     return str;
 }
 
@@ -2536,7 +2176,7 @@ nwamui_env_set_ippool_config_file (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPPOOL_CONFIG_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPPOOL_CONFIG_FILE, 
       ippool_config_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -2555,7 +2195,7 @@ nwamui_env_get_ippool_config_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPPOOL_CONFIG_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPPOOL_CONFIG_FILE );
     return str;
 }
 
@@ -2572,7 +2212,7 @@ nwamui_env_set_ike_config_file (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IKE_CONFIG_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IKE_CONFIG_FILE, 
       ike_config_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -2591,7 +2231,7 @@ nwamui_env_get_ike_config_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IKE_CONFIG_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IKE_CONFIG_FILE );
     return str;
 }
 
@@ -2608,7 +2248,7 @@ nwamui_env_set_ipsecpolicy_config_file (   NwamuiEnv *self,
     g_return_if_fail (NWAMUI_IS_ENV (self));
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    set_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPSECPOLICY_CONFIG_FILE, 
+    nwamui_prop_set_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPSECPOLICY_CONFIG_FILE, 
       ipsecpolicy_config_file);
 
     prv->nwam_loc_modified = TRUE;
@@ -2627,7 +2267,7 @@ nwamui_env_get_ipsecpolicy_config_file (NwamuiEnv *self)
     g_return_val_if_fail (NWAMUI_IS_ENV (self), NULL);
     NwamuiEnvPrivate  *prv     = NWAMUI_ENV_GET_PRIVATE(self);
 
-    gchar* str = get_nwam_loc_string_prop( prv->nwam_loc, NWAM_LOC_PROP_IPSECPOLICY_CONFIG_FILE );
+    gchar* str = nwamui_prop_get_string( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_IPSECPOLICY_CONFIG_FILE );
     return str;
 }
 
@@ -3348,7 +2988,7 @@ nwamui_object_real_set_activation_mode (   NwamuiObject *object, gint activation
     g_return_if_fail (NWAMUI_IS_ENV(object));
     g_assert (activation_mode >= NWAMUI_COND_ACTIVATION_MODE_MANUAL && activation_mode <= NWAMUI_COND_ACTIVATION_MODE_LAST );
 
-    set_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_ACTIVATION_MODE, activation_mode);
+    nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_ACTIVATION_MODE, activation_mode);
 
     prv->nwam_loc_modified = TRUE;
 }
@@ -3367,7 +3007,7 @@ nwamui_object_real_get_activation_mode (NwamuiObject *object)
 
     g_return_val_if_fail (NWAMUI_IS_ENV (object), activation_mode);
 
-    activation_mode = (gint)get_nwam_loc_uint64_prop( prv->nwam_loc, NWAM_LOC_PROP_ACTIVATION_MODE );
+    activation_mode = (gint)nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_ACTIVATION_MODE );
 
     return( (nwamui_cond_activation_mode_t)activation_mode );
 }
@@ -3389,7 +3029,7 @@ nwamui_object_real_set_conditions(NwamuiObject *object, const GList* conditions
 
     if ( conditions != NULL ) {
         condition_strs = nwamui_util_map_object_list_to_condition_strings((GList*)conditions, &len);
-        set_nwam_loc_string_array_prop(prv->nwam_loc, NWAM_LOC_PROP_CONDITIONS, condition_strs, len);
+        nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_CONDITIONS, condition_strs, len);
         if (condition_strs) {
             free(condition_strs);
         }
@@ -3414,7 +3054,7 @@ nwamui_object_real_get_conditions(NwamuiObject *object)
 
     g_return_val_if_fail(NWAMUI_IS_ENV(object), conditions);
 
-    condition_strs = get_nwam_loc_string_array_prop(prv->nwam_loc, NWAM_LOC_PROP_CONDITIONS );
+    condition_strs = nwamui_prop_get_string_array(NWAMUI_PROP_CLASS_LOC, prv->nwam_loc, NWAM_LOC_PROP_CONDITIONS, NULL );
     conditions = nwamui_util_map_condition_strings_to_object_list(condition_strs);
 
     g_strfreev( condition_strs );
@@ -3445,7 +3085,7 @@ nwamui_env_get_svc (NwamuiEnv *self, GtkTreeIter *iter)
 
     g_return_val_if_fail (NWAMUI_IS_ENV (self), svcobj);
 
-    gtk_tree_model_get (GTK_TREE_MODEL (self->prv->svcs_model), iter, SVC_OBJECT, &svcobj, -1);
+    gtk_tree_model_get (GTK_TREE_MODEL (nwamui_env_get_svcs_model(self)), iter, SVC_OBJECT, &svcobj, -1);
 
     return svcobj;
 }
@@ -3454,52 +3094,65 @@ extern NwamuiSvc*
 nwamui_env_find_svc (NwamuiEnv *self, const gchar *svc)
 {
     NwamuiSvc *svcobj = NULL;
-    GtkTreeIter iter;
+    gchar *key;
 
     g_return_val_if_fail (svc, NULL);
     g_return_val_if_fail (NWAMUI_IS_ENV (self), svcobj);
 
-    if (gtk_tree_model_get_iter_first (GTK_TREE_MODEL(self->prv->svcs_model), &iter)) {
-        do {
-            gchar *name;
-            
-            gtk_tree_model_get (GTK_TREE_MODEL(self->prv->svcs_model), &iter, SVC_OBJECT, &svcobj, -1);
-            name = nwamui_svc_get_name (svcobj);
-            
-            if (g_ascii_strcasecmp (name, svc) == 0) {
-                g_free (name);
-                return svcobj;
-            }
-            g_free (name);
-            g_object_unref (svcobj);
-        } while (gtk_tree_model_iter_next(GTK_TREE_MODEL(self->prv->svcs_model), &iter));
+    key = g_ascii_strdown (svc, -1);
+    if ((svcobj = g_hash_table_lookup (self->prv->svcs, key)) != NULL) {
+        g_object_ref (svcobj);
     }
-    return NULL;
+    g_free (key);
+
+    return svcobj;
 }
 
 extern void
 nwamui_env_svc_remove (NwamuiEnv *self, GtkTreeIter *iter)
 {
-    gtk_list_store_remove (GTK_LIST_STORE(self->prv->svcs_model), iter);
+    GtkListStore *model = nwamui_env_get_svcs_model(self);
+    NwamuiSvc *svcobj = NULL;
+
+    gtk_tree_model_get (GTK_TREE_MODEL(model), iter, SVC_OBJECT, &svcobj, -1);
+    if (svcobj) {
+        gchar *name = nwamui_svc_get_name (svcobj);
+        gchar *key = g_ascii_strdown (name, -1);
+
+        g_hash_table_remove (self->prv->svcs, key);
+        g_free (key);
+        g_free (name);
+        g_object_unref (svcobj);
+    }
+    gtk_list_store_remove (model, iter);
 }
 
 extern void
 nwamui_env_svc_foreach (NwamuiEnv *self, GtkTreeModelForeachFunc func, gpointer data)
 {
-    gtk_tree_model_foreach (GTK_TREE_MODEL(self->prv->svcs_model), func, data);
+    gtk_tree_model_foreach (GTK_TREE_MODEL(nwamui_env_get_svcs_model(self)), func, data);
 }
 
 extern gboolean
 nwamui_env_svc_insert (NwamuiEnv *self, NwamuiSvc *svc)
 {
 	GtkTreeIter iter;
-    NwamuiSvc *svcobj;
-    nwam_error_t nerr;
+    gchar *name = nwamui_svc_get_name (svc);
+    gchar *key = g_ascii_strdown (name, -1);
 
-    gtk_list_store_append (GTK_LIST_STORE(self->prv->svcs_model), &iter);
-    gtk_list_store_set (GTK_LIST_STORE(self->prv->svcs_model), &iter,
-      SVC_OBJECT, svcobj, -1);
-    
+    g_free (name);
+    if (g_hash_table_lookup (self->prv->svcs, key) != NULL) {
+        g_free (key);
+        return FALSE;
+    }
+    g_hash_table_insert (self->prv->svcs, key, g_object_ref (svc));
+
+    /* Keep the model, if it has been built, in step. */
+    if (self->prv->svcs_model != NULL) {
+        gtk_list_store_append (GTK_LIST_STORE(self->prv->svcs_model), &iter);
+        gtk_list_store_set (GTK_LIST_STORE(self->prv->svcs_model), &iter,
+          SVC_OBJECT, svc, -1);
+    }
     return TRUE;
 }
 
@@ -3507,13 +3160,23 @@ extern gboolean
 nwamui_env_svc_delete (NwamuiEnv *self, NwamuiSvc *svc)
 {
 	GtkTreeIter iter;
+    gchar *name = nwamui_svc_get_name (svc);
+    gchar *key = g_ascii_strdown (name, -1);
     NwamuiSvc *svcobj;
-    nwam_error_t nerr;
 
-    gtk_list_store_append (GTK_LIST_STORE(self->prv->svcs_model), &iter);
-    gtk_list_store_set (GTK_LIST_STORE(self->prv->svcs_model), &iter,
-      SVC_OBJECT, svcobj, -1);
-   
+    g_free (name);
+    if ((svcobj = g_hash_table_lookup (self->prv->svcs, key)) == NULL) {
+        g_free (key);
+        return FALSE;
+    }
+
+    /* Keep the model, if it has been built, in step. */
+    if (self->prv->svcs_model != NULL &&
+      capplet_model_find_object (GTK_TREE_MODEL(self->prv->svcs_model), G_OBJECT(svcobj), &iter)) {
+        gtk_list_store_remove (GTK_LIST_STORE(self->prv->svcs_model), &iter);
+    }
+    g_hash_table_remove (self->prv->svcs, key);
+    g_free (key);
     return TRUE;
 }
 
@@ -3528,9 +3191,12 @@ nwamui_env_svc_add (NwamuiEnv *self, nwam_loc_prop_template_t svc)
     if ( ( err = nwam_loc_prop_template_get_fmri( svc, &fmri )) == NWAM_SUCCESS ) {
         if ( fmri != NULL && (svcobj = nwamui_env_find_svc (self, fmri)) == NULL) {
             svcobj = nwamui_svc_new (svc);
-            gtk_list_store_append (GTK_LIST_STORE(self->prv->svcs_model), &iter);
-            gtk_list_store_set (GTK_LIST_STORE(self->prv->svcs_model), &iter,
-              SVC_OBJECT, svcobj, -1);
+            g_hash_table_insert (self->prv->svcs, g_ascii_strdown (fmri, -1), g_object_ref (svcobj));
+            if (self->prv->svcs_model != NULL) {
+                gtk_list_store_append (GTK_LIST_STORE(self->prv->svcs_model), &iter);
+                gtk_list_store_set (GTK_LIST_STORE(self->prv->svcs_model), &iter,
+                  SVC_OBJECT, svcobj, -1);
+            }
         }
     }
     return svcobj;
@@ -3651,7 +3317,7 @@ nwamui_object_real_commit( NwamuiObject *object )
             return( FALSE );
         }
 
-        currently_enabled = get_nwam_loc_boolean_prop( self->prv->nwam_loc, NWAM_LOC_PROP_ENABLED );
+        currently_enabled = nwamui_prop_get_boolean( NWAMUI_PROP_CLASS_LOC, self->prv->nwam_loc, NWAM_LOC_PROP_ENABLED );
         
         if ( self->prv->enabled != currently_enabled ) {
             /* Need to set enabled/disabled regardless of current state
@@ -3695,6 +3361,12 @@ nwamui_env_finalize (NwamuiEnv *self)
         nwam_loc_free (self->prv->nwam_loc);
     }
     
+    g_hash_table_destroy( self->prv->svcs );
+
+    if (self->prv->svcs_model != NULL ) {
+        g_object_unref( self->prv->svcs_model );
+    }
+
 #ifdef ENABLE_PROXY
     if (self->prv->proxy_pac_file != NULL ) {
         g_free( self->prv->proxy_pac_file );
@@ -3724,10 +3396,6 @@ nwamui_env_finalize (NwamuiEnv *self)
         g_free( self->prv->proxy_bypass_list );
     }
 
-    if (self->prv->svcs_model != NULL ) {
-        g_object_unref( self->prv->svcs_model );
-    }
-
     if (self->prv->proxy_username != NULL ) {
         g_free( self->prv->proxy_username );
     }
@@ -63,31 +63,14 @@ static void nwamui_known_wlan_get_property (  GObject         *object,
 
 static void nwamui_known_wlan_finalize (      NwamuiKnownWlan *self);
 
-static gchar*       get_nwam_known_wlan_string_prop( nwam_known_wlan_handle_t known_wlan, 
-                                                     const char* prop_name );
 
-static gboolean     set_nwam_known_wlan_string_prop( nwam_known_wlan_handle_t known_wlan, 
-                                                     const char* prop_name, const gchar* str );
 
-static gchar**      get_nwam_known_wlan_string_array_prop(
-                                    nwam_known_wlan_handle_t known_wlan, const char* prop_name );
 
-static gboolean     set_nwam_known_wlan_string_array_prop( nwam_known_wlan_handle_t known_wlan, 
-                                                           const char* prop_name, char** strs, guint len );
 
-static gboolean     get_nwam_known_wlan_boolean_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name );
 
-static guint64      get_nwam_known_wlan_uint64_prop( nwam_known_wlan_handle_t known_wlan, 
-                                                     const char* prop_name );
 
-static gboolean     set_nwam_known_wlan_uint64_prop( nwam_known_wlan_handle_t known_wlan, 
-                                                     const char* prop_name, guint64 value );
 
-static guint64*     get_nwam_known_wlan_uint64_array_prop(
-                                    nwam_known_wlan_handle_t known_wlan, const char* prop_name , guint* out_num );
 
-static gboolean     set_nwam_known_wlan_uint64_array_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name, 
-                                                           const guint64 *value_array, guint len );
 
 static void   nwamui_known_wlan_real_set_bssid_list(NwamuiKnownWlan *self, GList *bssid_list);
 static GList* nwamui_known_wlan_real_get_bssid_list(NwamuiKnownWlan *self);
@@ -203,14 +186,14 @@ nwamui_known_wlan_set_property (  GObject         *object,
     switch (prop_id) {
     case PROP_SECURITY: {
         prv->security = g_value_get_int(value);
-        set_nwam_known_wlan_uint64_prop( self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_SECURITY_MODE, 
+        nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_KNOWN_WLAN, self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_SECURITY_MODE, 
           nwamui_wifi_net_security_map_to_nwam( prv->security));
     }
         break;
 
     case PROP_WEP_KEY_INDEX: {
         prv->wep_key_index = g_value_get_uint64(value);
-        set_nwam_known_wlan_uint64_prop( self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_KEYSLOT, 
+        nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_KNOWN_WLAN, self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_KEYSLOT, 
           g_value_get_uint64( value ) );
     }
         break;
@@ -220,7 +203,7 @@ nwamui_known_wlan_set_property (  GObject         *object,
         break;
 
     case PROP_PRIORITY: {
-        set_nwam_known_wlan_uint64_prop( self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_PRIORITY, 
+        nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_KNOWN_WLAN, self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_PRIORITY, 
           g_value_get_uint64( value ) );
     }
         break;
@@ -256,7 +239,7 @@ nwamui_known_wlan_get_property (GObject         *object,
         guint64 rval = 0;
 
         if (self->prv->known_wlan_h != NULL) {
-            rval = get_nwam_known_wlan_uint64_prop( self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_KEYSLOT );
+            rval = nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_KNOWN_WLAN, self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_KEYSLOT );
             /* 0 if the entity isn't existing. */
         }
         else {
@@ -271,7 +254,7 @@ nwamui_known_wlan_get_property (GObject         *object,
     case PROP_PRIORITY: {
         guint64 rval = 0;
 
-        rval = get_nwam_known_wlan_uint64_prop( self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_PRIORITY );
+        rval = nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_KNOWN_WLAN, self->prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_PRIORITY );
         g_value_set_uint64( value, rval );
     }
         break;
@@ -298,7 +281,7 @@ nwamui_object_real_reload(NwamuiObject* object)
 
     g_object_freeze_notify(G_OBJECT(object));
 
-    sec_mode = get_nwam_known_wlan_uint64_prop(prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_SECURITY_MODE);
+    sec_mode = nwamui_prop_get_uint64(NWAMUI_PROP_CLASS_KNOWN_WLAN, prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_SECURITY_MODE);
             
     security = nwamui_wifi_net_security_map(sec_mode);
 
@@ -698,7 +681,7 @@ nwamui_known_wlan_real_set_bssid_list(NwamuiKnownWlan *self, GList *bssid_list)
 
     bssid_strv = nwamui_util_glist_to_strv(bssid_list);
 
-    set_nwam_known_wlan_string_array_prop(prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_BSSIDS, bssid_strv, 0 );
+    nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_KNOWN_WLAN, prv->known_wlan_h, NWAM_KNOWN_WLAN_PROP_BSSIDS, bssid_strv, 0 );
 
     /* if ( prv->bssid_strv ) { */
     /*     g_strfreev( prv->bssid_strv ); */
@@ -726,8 +709,8 @@ nwamui_known_wlan_real_get_bssid_list(NwamuiKnownWlan *self)
 
     g_return_val_if_fail(NWAMUI_IS_KNOWN_WLAN(self), bssid_list);
 
-    bssid_strv = get_nwam_known_wlan_string_array_prop(prv->known_wlan_h, 
-      NWAM_KNOWN_WLAN_PROP_BSSIDS);
+    bssid_strv = nwamui_prop_get_string_array(NWAMUI_PROP_CLASS_KNOWN_WLAN, prv->known_wlan_h, 
+      NWAM_KNOWN_WLAN_PROP_BSSIDS, NULL );
 
     bssid_list = nwamui_util_strv_to_glist( bssid_strv );
 
@@ -736,358 +719,6 @@ nwamui_known_wlan_real_get_bssid_list(NwamuiKnownWlan *self)
     return bssid_list;
 }
 
-static gchar*
-get_nwam_known_wlan_string_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar*              retval = NULL;
-    char*               value = NULL;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for known_wlan property %s\n", prop_name );
-        return retval;
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_value (known_wlan, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL ) {
-        retval  = g_strdup ( value );
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-set_nwam_known_wlan_string_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name, const gchar* str )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( known_wlan == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for known_wlan property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_string( (char*)str, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a string value for string %s", str?str:"NULL");
-        return retval;
-    }
-
-    if ( (nerr = nwam_known_wlan_set_prop_value (known_wlan, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gchar**
-get_nwam_known_wlan_string_array_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar**             retval = NULL;
-    char**              value = NULL;
-    uint_t              num = 0;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for known_wlan property %s\n", prop_name );
-        return retval;
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_value (known_wlan, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string_array(nwam_data, &value, &num )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL && num > 0 ) {
-        int i;
-
-        /* Create a NULL terminated list of stirngs, allocate 1 extra place
-         * for NULL termination. */
-        retval = (gchar**)g_malloc0( sizeof(gchar*) * (num+1) );
-
-        for (i = 0; i < num; i++ ) {
-            retval[i]  = g_strdup ( value[i] );
-        }
-        retval[num]=NULL;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-set_nwam_known_wlan_string_array_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name, char** strs, guint len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( known_wlan == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for known_wlan property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( strs == NULL ) {
-        if ( (nerr = nwam_known_wlan_delete_prop (known_wlan, prop_name)) != NWAM_SUCCESS ) {
-            g_debug("Unable to delete known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        }
-        else {
-            retval = TRUE;
-        }
-
-        return retval;
-    }
-
-
-    if ( len == 0 ) { /* Assume a strv, i.e. NULL terminated list, otherwise strs would be NULL */
-        int i;
-
-        for( i = 0; strs != NULL && strs[i] != NULL; i++ ) {
-            /* Do Nothing, just count. */
-        }
-        len = i;
-    }
-
-    if ( (nerr = nwam_value_create_string_array (strs, len, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a value for string array 0x%08X", strs);
-        return retval;
-    }
-
-    if ( (nerr = nwam_known_wlan_set_prop_value (known_wlan, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-get_nwam_known_wlan_boolean_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    boolean_t           value = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_BOOLEAN ) {
-        g_warning("Unexpected type for known_wlan property %s\n", prop_name );
-        return value;
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_value (known_wlan, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_boolean(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get boolean value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (gboolean)value );
-}
-
-static guint64
-get_nwam_known_wlan_uint64_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t            value = 0;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for known_wlan property %s\n", prop_name );
-        return value;
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_value (known_wlan, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_uint64(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (guint64)value );
-}
-
-static gboolean
-set_nwam_known_wlan_uint64_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name, guint64 value )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( known_wlan == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for known_wlan property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_uint64 (value, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a uint64 value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_known_wlan_set_prop_value (known_wlan, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static guint64* 
-get_nwam_known_wlan_uint64_array_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name , guint *out_num )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t           *value = NULL;
-    uint_t              num = 0;
-    guint64            *retval = NULL;
-    int                 i;
-
-    g_return_val_if_fail( prop_name != NULL && out_num != NULL, retval );
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for known_wlan property %s\n", prop_name );
-        return value;
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_value (known_wlan, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_uint64_array(nwam_data, &value, &num )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    retval = (guint64*)g_malloc( sizeof(guint64) * num );
-    for ( i = 0; i < num; i++ ) {
-        retval[i] = (guint64)value[i];
-    }
-
-    nwam_value_free(nwam_data);
-
-    *out_num = num;
-
-    return( retval );
-}
-
-static gboolean
-set_nwam_known_wlan_uint64_array_prop( nwam_known_wlan_handle_t known_wlan, const char* prop_name, 
-                                const guint64 *value_array, guint len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( known_wlan == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_known_wlan_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for known_wlan property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_uint64_array ((uint64_t*)value_array, len, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a uint64 array value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_known_wlan_set_prop_value (known_wlan, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for known_wlan property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
 static gboolean
 nwamui_object_real_has_modifications(NwamuiObject* object)
 {
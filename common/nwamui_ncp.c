@@ -31,6 +31,7 @@
 #include <glib-object.h>
 #include <glib/gi18n.h>
 #include <strings.h>
+#include <string.h>
 #include <gtk/gtkliststore.h>
 #include <gtk/gtktreestore.h>
 
@@ -40,8 +41,10 @@
 #include <sys/dlpi.h>
 #include <libdllink.h>
 
+/* Upper bound of threads used to read NCUs in parallel on reload. */
+#define NCU_PREFETCH_MAX_THREADS    4
+
 static NwamuiNcp       *instance        = NULL;
-static gint _num_wireless = 0; /* Count wireless i/fs */
 
 enum {
     PROP_PRIORITY_GROUP = 1,
@@ -69,6 +72,11 @@ typedef struct {
     GString        *report;
 } check_online_info_t;
 
+typedef struct {
+    NwamuiNcp      *self;
+    gint            sum_signal_strength;
+} gather_status_info_t;
+
 struct _NwamuiNcpPrivate {
     nwam_ncp_handle_t nwam_ncp;
     gchar*            name;
@@ -78,10 +86,26 @@ struct _NwamuiNcpPrivate {
     GList*        ncu_list;
     GtkListStore* ncu_list_store;
 
+    /* Indexes over ncu_list, the NCUs are not ref-ed here.
+     * ncu_by_device_name: case-folded device name -> GList of NCUs, the
+     *   first one is returned by lookups, the rest take over on removal.
+     * ncu_index_key: NCU -> key it is indexed under in ncu_by_device_name.
+     * ncus_by_type: NCUs of each nwamui_ncu_type_t, sorted by name.
+     */
+    GHashTable*   ncu_by_device_name;
+    GHashTable*   ncu_index_key;
+    GList*        ncus_by_type[NWAMUI_NCU_TYPE_LAST];
+
     GList* temp_list; /* Used to temporarily track not found objects in walkers */
+    GPtrArray* walk_items; /* ncu_walk_item_t found by the NCU walker */
+    GHashTable* walk_names; /* Device names in walk_items, not owned */
 
     /* Cached Priority Group */
     gint   priority_group;
+
+    /* Cached nwamui_ncp_get_status_info(), dropped on any NCU change. */
+    gboolean                 status_info_valid;
+    nwamui_ncp_status_info_t status_info;
 };
 
 #define NWAMUI_NCP_GET_PRIVATE(o) (G_TYPE_INSTANCE_GET_PRIVATE((o), NWAMUI_TYPE_NCP, NwamuiNcpPrivate))
@@ -104,6 +128,7 @@ static const gchar*  nwamui_object_real_get_name ( NwamuiObject *object );
 static gboolean      nwamui_object_real_can_rename(NwamuiObject *object);
 static gboolean      nwamui_object_real_set_name(NwamuiObject *object, const gchar* name);
 static void          nwamui_object_real_set_active ( NwamuiObject *object, gboolean active );
+static gint          nwamui_object_real_activate ( const gchar *name, gboolean active );
 static gboolean      nwamui_object_real_get_active( NwamuiObject *object );
 static gboolean      nwamui_object_real_validate(NwamuiObject *object, gchar **prop_name_ret);
 static gboolean      nwamui_object_real_commit( NwamuiObject *object );
@@ -115,17 +140,28 @@ static NwamuiObject* nwamui_object_real_clone(NwamuiObject *object, const gchar
 static void          nwamui_object_real_add(NwamuiObject *object, NwamuiObject *child);
 static void          nwamui_object_real_remove(NwamuiObject *object, NwamuiObject *child);
 
+/* Filled by the NCU walker, then by a prefetch worker, then applied in the
+ * main thread.
+ */
+typedef struct {
+    gchar             *device_name;
+    gboolean           exists;
+    NwamuiPropArena   *arena;       /* Of the existing NCU, reused */
+    NwamuiNcuPrefetch *prefetch;
+} ncu_walk_item_t;
+
 /* Callbacks */
 static int nwam_ncu_walker_cb (nwam_ncu_handle_t ncu, void *data);
+static void ncu_prefetch_worker(gpointer data, gpointer user_data);
 static void ncu_notify_cb( GObject *gobject, GParamSpec *arg1, gpointer data);
 static void row_deleted_cb (GtkTreeModel *tree_model, GtkTreePath *path, gpointer user_data);
 static void row_inserted_cb (GtkTreeModel *tree_model, GtkTreePath *path, GtkTreeIter *iter, gpointer user_data);
 static void rows_reordered_cb(GtkTreeModel *tree_model, GtkTreePath *path, GtkTreeIter *iter, gpointer arg3, gpointer user_data);
 
-/* GList callbacks */
-static gint find_ncu_by_device_name(gconstpointer data, gconstpointer user_data);
-static gint find_first_wifi_net(gconstpointer data, gconstpointer user_data);
-static void find_wireless_ncu(gpointer obj, gpointer user_data);
+/* NCU indexes */
+static void ncu_index_add(NwamuiNcp *self, NwamuiNcu *ncu);
+static gint ncu_gather_status_info(gconstpointer data, gconstpointer user_data);
+static void ncu_index_remove(NwamuiNcp *self, NwamuiNcu *ncu);
 
 G_DEFINE_TYPE (NwamuiNcp, nwamui_ncp, NWAMUI_TYPE_OBJECT)
 
@@ -147,6 +183,7 @@ nwamui_ncp_class_init (NwamuiNcpClass *klass)
     nwamuiobject_class->can_rename = nwamui_object_real_can_rename;
     nwamuiobject_class->get_active = nwamui_object_real_get_active;
     nwamuiobject_class->set_active = nwamui_object_real_set_active;
+    nwamuiobject_class->activate = nwamui_object_real_activate;
     nwamuiobject_class->get_nwam_state = nwamui_object_real_get_nwam_state;
     nwamuiobject_class->validate = nwamui_object_real_validate;
     nwamuiobject_class->commit = nwamui_object_real_commit;
@@ -225,6 +262,9 @@ nwamui_ncp_init ( NwamuiNcp *self)
 
     prv->ncu_list_store = gtk_list_store_new ( 1, NWAMUI_TYPE_NCU);
 
+    prv->ncu_by_device_name = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)g_list_free);
+    prv->ncu_index_key = g_hash_table_new(g_direct_hash, g_direct_equal);
+
     g_signal_connect(prv->ncu_list_store, "row_deleted", G_CALLBACK(row_deleted_cb), (gpointer)self);
     g_signal_connect(prv->ncu_list_store, "row_inserted", G_CALLBACK(row_inserted_cb), (gpointer)self);
     g_signal_connect(prv->ncu_list_store, "rows_reordered", G_CALLBACK(rows_reordered_cb), (gpointer)self);
@@ -289,8 +329,16 @@ static void
 nwamui_ncp_finalize (NwamuiNcp *self)
 {
 
+    gint i;
+
     g_free( self->prv->name);
     
+    g_hash_table_destroy(self->prv->ncu_index_key);
+    g_hash_table_destroy(self->prv->ncu_by_device_name);
+    for (i = 0; i < NWAMUI_NCU_TYPE_LAST; i++) {
+        g_list_free(self->prv->ncus_by_type[i]);
+    }
+
     if ( self->prv->ncu_list != NULL ) {
         nwamui_util_free_obj_list(self->prv->ncu_list);
     }
@@ -442,6 +490,10 @@ nwamui_object_real_reload(NwamuiObject* object)
     NwamuiNcpPrivate  *prv                  = NWAMUI_NCP_GET_PRIVATE(object);
     int                cb_ret               = 0;
     nwam_error_t       nerr;
+    GThreadPool       *pool                 = NULL;
+    GError            *error                = NULL;
+    gint               num_wireless         = 0;
+    guint              i;
 
     g_return_if_fail(NWAMUI_IS_NCP(object));
 
@@ -453,12 +505,81 @@ nwamui_object_real_reload(NwamuiObject* object)
     g_object_freeze_notify(G_OBJECT(prv->ncu_list_store));
 
     prv->temp_list = g_list_copy(prv->ncu_list);
-
-    _num_wireless = 0;
+    prv->walk_items = g_ptr_array_new();
+    prv->walk_names = g_hash_table_new(g_str_hash, g_str_equal);
 
     g_debug ("### nwam_ncp_walk_ncus start ###");
     nerr = nwam_ncp_walk_ncus( prv->nwam_ncp, nwam_ncu_walker_cb, (void*)object,
       NWAM_FLAG_NCU_TYPE_CLASS_ALL, &cb_ret );
+
+    /* Known NCUs lend their arena to the prefetch, which resets and reuses
+     * it rather than allocating a new one on each reload.
+     */
+    for (i = 0; i < prv->walk_items->len; i++) {
+        ncu_walk_item_t *item = g_ptr_array_index(prv->walk_items, i);
+        NwamuiObject    *ncu;
+
+        if ((ncu = nwamui_ncp_get_ncu_by_device_name(NWAMUI_NCP(object), item->device_name)) != NULL) {
+            item->arena = nwamui_ncu_take_prop_arena(NWAMUI_NCU(ncu));
+            g_object_unref(ncu);
+        }
+    }
+
+    /* Read the handles and properties of all NCUs concurrently, only libnwam
+     * and libdladm are used by the workers, GObjects are updated below.
+     */
+    if (prv->walk_items->len > 1) {
+        pool = g_thread_pool_new(ncu_prefetch_worker, prv->nwam_ncp,
+          MIN(prv->walk_items->len, NCU_PREFETCH_MAX_THREADS), TRUE, &error);
+        if (pool == NULL) {
+            nwamui_warning("Failed to create NCU prefetch pool: %s", error ? error->message : "");
+            g_clear_error(&error);
+        }
+    }
+    for (i = 0; i < prv->walk_items->len; i++) {
+        if (pool) {
+            g_thread_pool_push(pool, g_ptr_array_index(prv->walk_items, i), NULL);
+        } else {
+            ncu_prefetch_worker(g_ptr_array_index(prv->walk_items, i), prv->nwam_ncp);
+        }
+    }
+    if (pool) {
+        /* Wait for all to finish. */
+        g_thread_pool_free(pool, FALSE, TRUE);
+    }
+
+    for (i = 0; i < prv->walk_items->len; i++) {
+        ncu_walk_item_t *item = g_ptr_array_index(prv->walk_items, i);
+        NwamuiObject    *ncu;
+
+        /* Skip device that don't have a physical equivalent */
+        if (item->exists && item->prefetch) {
+            if ((ncu = nwamui_ncp_get_ncu_by_device_name(NWAMUI_NCP(object), item->device_name)) != NULL) {
+                /* Reload */
+                nwamui_ncu_reload_with_prefetch(NWAMUI_NCU(ncu), item->prefetch);
+                /* Found it, so remove from temp list of ones to be removed */
+                prv->temp_list = g_list_remove(prv->temp_list, ncu);
+            } else {
+                ncu = nwamui_ncu_new_with_prefetch(NWAMUI_NCP(object), item->prefetch);
+                nwamui_object_add(object, ncu);
+            }
+
+            if (nwamui_ncu_get_ncu_type(NWAMUI_NCU(ncu)) == NWAMUI_NCU_TYPE_WIRELESS) {
+                num_wireless++;
+            }
+            g_object_unref(ncu);
+        }
+
+        nwamui_ncu_prefetch_free(item->prefetch);
+        nwamui_prop_arena_free(item->arena);
+        g_free(item->device_name);
+        g_free(item);
+    }
+    g_ptr_array_free(prv->walk_items, TRUE);
+    prv->walk_items = NULL;
+    g_hash_table_destroy(prv->walk_names);
+    prv->walk_names = NULL;
+
     if (nerr == NWAM_SUCCESS) {
         for(;
             prv->temp_list != NULL;
@@ -472,8 +593,8 @@ nwamui_object_real_reload(NwamuiObject* object)
     }
     g_debug ("### nwam_ncp_walk_ncus  end ###");
 
-    if ( prv->wireless_link_num != _num_wireless ) {
-        prv->wireless_link_num = _num_wireless;
+    if ( prv->wireless_link_num != num_wireless ) {
+        prv->wireless_link_num = num_wireless;
         g_object_notify(G_OBJECT(object), "wireless_link_num" );
     }
 
@@ -651,6 +772,27 @@ nwamui_object_real_set_active (NwamuiObject *object, gboolean active)
     }
 }
 
+/* Blocking, called from a worker thread. The object's own handle may be
+ * replaced by a reload meanwhile, so read a private one.
+ */
+static gint
+nwamui_object_real_activate (const gchar *name, gboolean active)
+{
+    nwam_ncp_handle_t   handle;
+    nwam_error_t        nerr;
+
+    if ( !active ) {
+        /* Cannot disable an NCP, enable another one to do this */
+        return NWAM_INVALID_ARG;
+    }
+    if ( (nerr = nwam_ncp_read (name, 0, &handle)) != NWAM_SUCCESS ) {
+        return nerr;
+    }
+    nerr = nwam_ncp_enable (handle);
+    nwam_ncp_free (handle);
+    return nerr;
+}
+
 /**
  * nwamui_object_real_is_modifiable:
  * @nwamui_ncp: a #NwamuiNcp.
@@ -710,10 +852,42 @@ nwamui_ncp_set_prio_group( NwamuiNcp* self, gint64 new_prio )
 
     if (self->prv->priority_group != new_prio) {
         self->prv->priority_group = new_prio;
+        self->prv->status_info_valid = FALSE;
         g_object_notify(G_OBJECT(self), "priority-group");
     }
 }
 
+/**
+ * nwamui_ncp_get_status_info:
+ *
+ * Fill info with the active NCUs of the current priority group, up to the
+ * first exclusive NCU which is up. The result is cached until an NCU of the
+ * NCP changes, so it is cheap enough for the panel icon animation.
+ */
+extern void
+nwamui_ncp_get_status_info( NwamuiNcp* self, nwamui_ncp_status_info_t *info )
+{
+    NwamuiNcpPrivate *prv = NWAMUI_NCP_GET_PRIVATE(self);
+
+    g_return_if_fail(NWAMUI_IS_NCP(self) && info);
+
+    if (!prv->status_info_valid) {
+        gather_status_info_t gather = { self, 0 };
+
+        bzero(&prv->status_info, sizeof(prv->status_info));
+        prv->status_info.average_signal_strength = NWAMUI_WIFI_STRENGTH_NONE;
+
+        prv->status_info_valid = TRUE;
+        nwamui_ncp_find_ncu(self, ncu_gather_status_info, &gather);
+
+        if (prv->status_info.active_wireless_num > 0) {
+            prv->status_info.average_signal_strength =
+              gather.sum_signal_strength / prv->status_info.active_wireless_num;
+        }
+    }
+    *info = prv->status_info;
+}
+
 static void
 check_ncu_online( gpointer obj, gpointer user_data )
 {
@@ -971,15 +1145,17 @@ nwamui_ncp_get_ncu_by_device_name( NwamuiNcp *self, const gchar* device_name )
 {
     NwamuiNcpPrivate *prv             = NWAMUI_NCP_GET_PRIVATE(self);
     NwamuiObject     *ret_ncu         = NULL;
-    gchar            *ncu_device_name = NULL;
-    GList            *found_list;
+    gchar            *key;
+    gpointer          found;
 
     g_return_val_if_fail (device_name, ret_ncu ); 
 
-    found_list = g_list_find_custom(self->prv->ncu_list, (gpointer)device_name, find_ncu_by_device_name);
+    key = g_ascii_strdown(device_name, -1);
+    found = g_hash_table_lookup(prv->ncu_by_device_name, key);
+    g_free(key);
 
-    if (found_list) {
-        ret_ncu = NWAMUI_OBJECT(g_object_ref(found_list->data));
+    if (found) {
+        ret_ncu = NWAMUI_OBJECT(g_object_ref(((GList *)found)->data));
         /* nwamui_debug("NCP %s found NCU %s (0x%p) OK", prv->name, device_name, found_list->data); */
     } else {
         nwamui_debug("NCP %s found NCU %s FAILED", prv->name, device_name);
@@ -1010,6 +1186,10 @@ nwamui_object_real_remove(NwamuiObject *object, NwamuiObject *child)
 
         if ( _ncu == (gpointer)child ) {
             gtk_list_store_remove(GTK_LIST_STORE(prv->ncu_list_store), &iter);
+            ncu_index_remove(self, _ncu);
+            g_signal_handlers_disconnect_by_func(G_OBJECT(_ncu), (gpointer)ncu_notify_cb, (gpointer)self);
+
+            prv->status_info_valid = FALSE;
 
             if ( nwamui_ncu_get_ncu_type( _ncu ) == NWAMUI_NCU_TYPE_WIRELESS ) {
                 prv->wireless_link_num--;
@@ -1057,6 +1237,8 @@ nwamui_object_real_add(NwamuiObject *object, NwamuiObject *child)
 
     /* NCU isn't already in the list, so add it */
     prv->ncu_list = g_list_insert_sorted(prv->ncu_list, g_object_ref(child), (GCompareFunc)nwamui_object_sort_by_name);
+    ncu_index_add(self, NWAMUI_NCU(child));
+    prv->status_info_valid = FALSE;
     g_debug("Add '%s(0x%p)' to '%s'", nwamui_object_get_name(child), child, nwamui_object_get_name(object));
 
     gtk_list_store_append( prv->ncu_list_store, &iter );
@@ -1179,173 +1361,189 @@ device_exists_on_system( gchar* device_name )
     return( rval );
 }
 
-static nwam_ncu_type_t
-get_nwam_ncu_type( nwam_ncu_handle_t ncu )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t            value = 0;
-    nwam_ncu_type_t     rval = NWAM_NCU_TYPE_LINK;
-
-    if ( ncu == NULL ) {
-        return( value );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( NWAM_NCU_PROP_TYPE, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", NWAM_NCU_PROP_TYPE, nwam_type );
-        return rval;
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_value (ncu, NWAM_NCU_PROP_TYPE, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for ncu property %s, error = %s", NWAM_NCU_PROP_TYPE, nwam_strerror( nerr ) );
-        return rval;
-    }
-
-    if ( (nerr = nwam_value_get_uint64(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for ncu property %s, error = %s", NWAM_NCU_PROP_TYPE, nwam_strerror( nerr ) );
-        return rval;
-    }
-
-    nwam_value_free(nwam_data);
-
-    rval = (nwam_ncu_type_t)value;
-
-    return( rval );
-}
-
+/*
+ * Called once for each NCU class, e.g. phys, ip, iptun, so only remember
+ * each device name once. All reading is done later by the prefetch workers.
+ */
 static int
 nwam_ncu_walker_cb (nwam_ncu_handle_t ncu, void *data)
 {
     char*               name;
     nwam_error_t        nerr;
-    NwamuiObject*       new_ncu;
-    GtkTreeIter         iter;
     NwamuiNcp*          ncp = NWAMUI_NCP(data);
     NwamuiNcpPrivate*   prv = ncp->prv;
-    nwam_ncu_type_t     nwam_ncu_type;
+    ncu_walk_item_t    *item;
 
     if ((nerr = nwam_ncu_get_name(ncu, &name)) != NWAM_SUCCESS) {
         g_warning("Failed to get name for ncu, error: %s", nwam_strerror (nerr));
         return 0;
     }
 
-    /* This function (NCU walker cb) will be called multiple time for different
-     * NCU types. e.g. phys, ip, iptun...
-     */
-
-    if (!device_exists_on_system(name)) {
-        /* Skip device that don't have a physical equivalent */
+    if (g_hash_table_lookup(prv->walk_names, name) != NULL) {
         free(name);
         return 0;
     }
 
-    if(name) {
-        if ((new_ncu = nwamui_ncp_get_ncu_by_device_name(ncp, name)) != NULL) {
-            /* Reload */
-            /* nwamui_object_set_handle(new_ncu, ncu); */
-            nwamui_object_reload(NWAMUI_OBJECT(new_ncu));
-            /* Found it, so remove from temp list of ones to be removed */
-            prv->temp_list = g_list_remove(prv->temp_list, new_ncu);
-        } else {
-            new_ncu = nwamui_ncu_new_with_handle(NWAMUI_NCP(ncp), ncu);
-            nwamui_object_add(NWAMUI_OBJECT(ncp), NWAMUI_OBJECT(new_ncu));
-        }
-        free(name);
-    }
-
-    /* Only count if it's a LINK class (to avoid double count) */
-    nwam_ncu_type = get_nwam_ncu_type(ncu);
-    if (nwam_ncu_type == NWAM_NCU_TYPE_LINK && new_ncu
-      && nwamui_ncu_get_ncu_type(NWAMUI_NCU(new_ncu)) == NWAMUI_NCU_TYPE_WIRELESS ) {
-        _num_wireless++;
-    }
+    item = g_new0(ncu_walk_item_t, 1);
+    item->device_name = g_strdup(name);
+    g_ptr_array_add(prv->walk_items, item);
+    g_hash_table_insert(prv->walk_names, item->device_name, item);
 
-    if (new_ncu != NULL) {
-        g_object_unref(new_ncu);
-    }
+    free(name);
 
     return 0;
 }
 
 static void
-find_wireless_ncu( gpointer obj, gpointer user_data )
+ncu_prefetch_worker(gpointer data, gpointer user_data)
 {
-	NwamuiNcu           *ncu = NWAMUI_NCU(obj);
-    GList              **glist_p = (GList**)user_data;
+    ncu_walk_item_t   *item     = (ncu_walk_item_t *)data;
+    nwam_ncp_handle_t  nwam_ncp = (nwam_ncp_handle_t)user_data;
 
-    if ( ncu == NULL || !NWAMUI_IS_NCU(ncu) ) {
-        return;
+    item->exists = device_exists_on_system(item->device_name);
+    if (item->exists) {
+        item->prefetch = nwamui_ncu_prefetch_new(nwam_ncp, item->device_name, item->arena);
+        item->arena = NULL;
+    }
+}
+
+/**
+ * ncu_index_add:
+ *
+ * Index an NCU by its device name and type. Called when the NCU is added
+ * to the NCP, and again after its device name or type changes.
+ **/
+static void
+ncu_index_add(NwamuiNcp *self, NwamuiNcu *ncu)
+{
+    NwamuiNcpPrivate  *prv = self->prv;
+    nwamui_ncu_type_t  type;
+    gchar             *device_name;
+
+    device_name = nwamui_ncu_get_device_name(ncu);
+    if (device_name) {
+        gchar *key = g_ascii_strdown(device_name, -1);
+        gchar *orig_key;
+        GList *ncus;
+
+        if (g_hash_table_lookup_extended(prv->ncu_by_device_name, key,
+            (gpointer *)&orig_key, (gpointer *)&ncus)) {
+            nwamui_debug("NCP %s already has an NCU for device %s", prv->name, device_name);
+            /* Appending keeps the existing list head, no re-insert. */
+            ncus = g_list_append(ncus, ncu);
+            g_free(key);
+            key = orig_key;
+        } else {
+            g_hash_table_insert(prv->ncu_by_device_name, key, g_list_prepend(NULL, ncu));
+        }
+        g_hash_table_insert(prv->ncu_index_key, ncu, key);
+        g_free(device_name);
     }
 
-    if ( nwamui_ncu_get_ncu_type( ncu ) == NWAMUI_NCU_TYPE_WIRELESS ) {
-        (*glist_p) = g_list_append( (*glist_p), (gpointer)g_object_ref(ncu) );
+    type = nwamui_ncu_get_ncu_type(ncu);
+    if (type >= 0 && type < NWAMUI_NCU_TYPE_LAST) {
+        prv->ncus_by_type[type] = g_list_insert_sorted(prv->ncus_by_type[type],
+          ncu, (GCompareFunc)nwamui_object_sort_by_name);
     }
 }
 
-extern GList*
-nwamui_ncp_get_wireless_ncus( NwamuiNcp* self )
+static void
+ncu_index_remove(NwamuiNcp *self, NwamuiNcu *ncu)
 {
-    GList*  ncu_list = NULL;
+    NwamuiNcpPrivate *prv = self->prv;
+    gchar            *key;
+    gint              i;
 
-    g_return_val_if_fail( NWAMUI_IS_NCP(self), ncu_list );
+    if ((key = g_hash_table_lookup(prv->ncu_index_key, ncu)) != NULL) {
+        GList *ncus = g_hash_table_lookup(prv->ncu_by_device_name, key);
 
-    if ( self->prv->wireless_link_num > 0 ) {
-        g_list_foreach( self->prv->ncu_list, find_wireless_ncu, &ncu_list );
+        g_hash_table_remove(prv->ncu_index_key, ncu);
+
+        ncus = g_list_remove(ncus, ncu);
+        if (ncus) {
+            /* The next NCU with this device name takes over. */
+            g_hash_table_steal(prv->ncu_by_device_name, key);
+            g_hash_table_insert(prv->ncu_by_device_name, key, ncus);
+        } else {
+            /* Frees key and the emptied list. */
+            g_hash_table_remove(prv->ncu_by_device_name, key);
+        }
     }
 
-    return( ncu_list );
+    for (i = 0; i < NWAMUI_NCU_TYPE_LAST; i++) {
+        prv->ncus_by_type[i] = g_list_remove(prv->ncus_by_type[i], ncu);
+    }
 }
 
+/* Returns 0 to stop at the first exclusive NCU which is up. */
 static gint
-find_ncu_by_device_name(gconstpointer data, gconstpointer user_data)
+ncu_gather_status_info(gconstpointer data, gconstpointer user_data)
 {
-    NwamuiNcu*  ncu             = NWAMUI_NCU(data);
-    gchar      *ncu_device_name = nwamui_ncu_get_device_name( ncu );
-    gchar      *device_name     = (gchar *)user_data;
-    gint        found           = 1;
+    NwamuiNcu                *ncu            = (NwamuiNcu *)data;
+    gather_status_info_t     *gather         = (gather_status_info_t *)user_data;
+    NwamuiNcpPrivate         *prv            = NWAMUI_NCP_GET_PRIVATE(gather->self);
+    nwam_state_t              state;
+    nwam_aux_state_t          aux_state;
+    gint                      found_excl_ncu = 1;
 
-    g_return_val_if_fail(NWAMUI_IS_NCU(data), 1);
-    g_return_val_if_fail(user_data, 1);
+    g_return_val_if_fail(NWAMUI_IS_NCU(ncu), 1);
 
-    if (g_ascii_strcasecmp(ncu_device_name, device_name) == 0) {
-        found = 0;
-    } else {
-        found = 1;
+    /* Only care about current prio ncus, and first exclusive NCU
+     * that's in UP state 
+     */
+    if (nwamui_ncu_get_priority_group(ncu) != prv->priority_group ||
+      !nwamui_object_get_active(NWAMUI_OBJECT(ncu))) {
+        return found_excl_ncu;
+    }
+
+    state = nwamui_object_get_nwam_state(NWAMUI_OBJECT(ncu), &aux_state, NULL);
+
+    if (nwamui_object_get_activation_mode(NWAMUI_OBJECT(ncu)) == NWAMUI_COND_ACTIVATION_MODE_PRIORITIZED &&
+      nwamui_ncu_get_priority_group_mode(ncu) == NWAMUI_COND_PRIORITY_GROUP_MODE_EXCLUSIVE &&
+      state == NWAM_STATE_ONLINE && aux_state == NWAM_AUX_STATE_UP) {
+        /* Stop here. */
+        found_excl_ncu = 0;
+    }
+
+    switch(nwamui_ncu_get_ncu_type(ncu)) {
+#ifdef TUNNEL_SUPPORT
+    case NWAMUI_NCU_TYPE_TUNNEL:
+#endif /* TUNNEL_SUPPORT */
+    case NWAMUI_NCU_TYPE_WIRED:
+        prv->status_info.active_wired_num++;
+        break;
+    case NWAMUI_NCU_TYPE_WIRELESS:
+        prv->status_info.active_wireless_num++;
+        gather->sum_signal_strength += nwamui_ncu_get_wifi_signal_strength(ncu);
+        break;
+    default:
+        g_assert_not_reached();
+        break;
     }
-    g_free(ncu_device_name);
-    return found;
+
+    return found_excl_ncu;
 }
 
-static gint
-find_first_wifi_net(gconstpointer data, gconstpointer user_data)
+extern GList*
+nwamui_ncp_get_wireless_ncus( NwamuiNcp* self )
 {
-	NwamuiNcu  *ncu          = (NwamuiNcu *) data;
-    NwamuiNcu **wireless_ncu = (NwamuiNcu **) user_data;
-	
-    g_return_val_if_fail(NWAMUI_IS_NCU(ncu), 1);
-    g_return_val_if_fail(user_data, 1);
-    
-	if (nwamui_ncu_get_ncu_type(ncu) == NWAMUI_NCU_TYPE_WIRELESS ) {
-        *wireless_ncu = g_object_ref(ncu);
-        return 0;
-	}
-    return 1;
+    GList*  ncu_list = NULL;
+
+    g_return_val_if_fail( NWAMUI_IS_NCP(self), ncu_list );
+
+    return nwamui_util_copy_obj_list(self->prv->ncus_by_type[NWAMUI_NCU_TYPE_WIRELESS]);
 }
 
 extern NwamuiNcu*
 nwamui_ncp_get_first_wireless_ncu(NwamuiNcp *self)
 {
-    NwamuiNcu *wireless_ncu = NULL;
+    GList *wireless = NULL;
 
     g_return_val_if_fail(NWAMUI_IS_NCP(self), NULL);
 
-    if (self->prv->wireless_link_num > 0) {
-        nwamui_ncp_find_ncu(self, find_first_wifi_net, &wireless_ncu);
-    }
+    wireless = self->prv->ncus_by_type[NWAMUI_NCU_TYPE_WIRELESS];
 
-    return wireless_ncu;
+    return wireless ? NWAMUI_NCU(g_object_ref(wireless->data)) : NULL;
 }
 
 extern gint
@@ -1389,6 +1587,18 @@ ncu_notify_cb( GObject *gobject, GParamSpec *arg1, gpointer data)
     GtkTreeIter     iter;
     gboolean        valid_iter = FALSE;
 
+    self->prv->status_info_valid = FALSE;
+
+    /* Keep the indexes in step with renames and type changes, ncus_by_type
+     * is sorted by name.
+     */
+    if (arg1 && (g_strcmp0(arg1->name, "device-name") == 0 ||
+        g_strcmp0(arg1->name, "name") == 0 ||
+        g_strcmp0(arg1->name, "ncu-type") == 0)) {
+        ncu_index_remove(self, NWAMUI_NCU(gobject));
+        ncu_index_add(self, NWAMUI_NCU(gobject));
+    }
+
     for (valid_iter = gtk_tree_model_get_iter_first( GTK_TREE_MODEL(self->prv->ncu_list_store), &iter);
          valid_iter;
          valid_iter = gtk_tree_model_iter_next( GTK_TREE_MODEL(self->prv->ncu_list_store), &iter)) {
@@ -63,6 +63,13 @@ struct _NwamuiNcpClass
 
 
 
+/* Summary of the active NCUs of the current priority group. */
+typedef struct {
+    gint   active_wired_num;
+    gint   active_wireless_num;
+    nwamui_wifi_signal_strength_t average_signal_strength;
+} nwamui_ncp_status_info_t;
+
 extern  GType                   nwamui_ncp_get_type (void) G_GNUC_CONST;
 
 extern NwamuiObject*            nwamui_ncp_new(const gchar* name );
@@ -97,6 +104,8 @@ extern gint64                   nwamui_ncp_get_prio_group( NwamuiNcp* self );
 
 extern void                     nwamui_ncp_set_prio_group( NwamuiNcp* self, gint64 new_prio );
 
+extern void                     nwamui_ncp_get_status_info( NwamuiNcp* self, nwamui_ncp_status_info_t *info );
+
 extern void                     nwamui_ncp_freeze_notify_ncus( NwamuiNcp* self );
 
 extern void                     nwamui_ncp_thaw_notify_ncus( NwamuiNcp* self );
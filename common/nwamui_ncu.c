@@ -102,6 +102,27 @@ struct _NwamuiNcuPrivate {
 
     /* For caching gui connection state */
     nwamui_connection_state_t state;
+
+    /* Backs the values decoded by the last reload */
+    NwamuiPropArena *prop_arena;
+
+    /* Display strings for list views, built on demand and dropped on every
+     * notify, see ncu_display_invalidate() */
+    guint        display_valid;
+    gchar       *display_summary;
+    gchar       *display_phy_address;
+    gchar       *display_markup;
+    gchar       *display_state_markup;
+    GdkPixbuf   *display_status_icon;
+    gint         display_icon_size;
+};
+
+enum {
+    NCU_DISPLAY_SUMMARY         = 1 << 0,
+    NCU_DISPLAY_PHY_ADDRESS     = 1 << 1,
+    NCU_DISPLAY_MARKUP          = 1 << 2,
+    NCU_DISPLAY_STATE_MARKUP    = 1 << 3,
+    NCU_DISPLAY_STATUS_ICON     = 1 << 4
 };
 
 enum {
@@ -133,6 +154,44 @@ enum {
 
 #define NWAMUI_NCU_GET_PRIVATE(o) (G_TYPE_INSTANCE_GET_PRIVATE((o), NWAMUI_TYPE_NCU, NwamuiNcuPrivate))
 
+/* NCU properties decoded by a single nwam_ncu_walk_props() pass over each
+ * class handle, rather than one nwamui_prop_get_*() call each. Values are
+ * borrowed from the arena, which lives until the next reload.
+ */
+typedef struct {
+    NwamuiPropArena     *arena;
+    nwam_ncu_class_t     walk_class;    /* Class of the handle being walked */
+
+    /* Phys class */
+    gboolean             enabled;
+
+    /* IP class */
+    const guint64       *ip_version;
+    guint                ip_version_num;
+    const guint64       *ipv4_addrsrc;
+    guint                ipv4_addrsrc_num;
+    const gchar* const  *ipv4_addr;
+    const guint64       *ipv6_addrsrc;
+    guint                ipv6_addrsrc_num;
+    const gchar* const  *ipv6_addr;
+
+#ifdef TUNNEL_SUPPORT
+    /* IPTun class */
+    guint64              tun_type;
+    const gchar         *tun_tsrc;
+    const gchar         *tun_tdst;
+    const gchar         *tun_encr;
+    const gchar         *tun_encr_auth;
+    const gchar         *tun_auth;
+#endif /* TUNNEL_SUPPORT */
+} ncu_props_t;
+
+struct _NwamuiNcuPrefetch {
+    gchar             *device_name;
+    nwam_ncu_handle_t  ncu_handles[NWAM_NCU_CLASS_ANY];
+    ncu_props_t        props;   /* Owns its arena until applied */
+};
+
 static void nwamui_ncu_set_property ( GObject         *object,
                                       guint            prop_id,
                                       const GValue    *value,
@@ -145,31 +204,25 @@ static void nwamui_ncu_get_property ( GObject         *object,
 
 static void nwamui_ncu_finalize (     NwamuiNcu *self);
 
-static void populate_iptun_ncu_data(NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu);
-static void populate_ip_ncu_data(NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu);
-static void populate_phys_ncu_data(NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu);
+static void nwamui_ncu_notify(GObject *object, GParamSpec *pspec);
+
+static void ncu_display_invalidate(NwamuiNcu *self);
+
+static void ncu_props_fetch(ncu_props_t *props, NwamuiPropArena *arena, nwam_ncu_handle_t *ncu_handles);
+static void populate_ncu_data(NwamuiNcu *ncu, const ncu_props_t *props);
+static void populate_iptun_ncu_data(NwamuiNcu *ncu, const ncu_props_t *props);
+static void populate_ip_ncu_data(NwamuiNcu *ncu, const ncu_props_t *props);
+static void populate_phys_ncu_data(NwamuiNcu *ncu, const ncu_props_t *props);
 
 static void nwamui_ncu_set_display_name ( NwamuiNcu *self );
 static void set_modified_flag( NwamuiNcu* self, nwam_ncu_class_t ncu_class, gboolean value );
 static void set_enabled_flag(NwamuiNcu* self, nwam_ncu_handle_t nwam_ncu, gboolean value);
 
-static gboolean     delete_nwam_ncu_prop( nwam_ncu_handle_t ncu, const char* prop_name );
 
-static gboolean     get_nwam_ncu_boolean_prop( nwam_ncu_handle_t ncu, const char* prop_name );
-static gboolean     set_nwam_ncu_boolean_prop( nwam_ncu_handle_t ncu, const char* prop_name, gboolean bool_value );
 
-static gchar*       get_nwam_ncu_string_prop( nwam_ncu_handle_t ncu, const char* prop_name );
-static gboolean     set_nwam_ncu_string_prop( nwam_ncu_handle_t ncu, const char* prop_name, const char* str );
 
-static gchar**      get_nwam_ncu_string_array_prop( nwam_ncu_handle_t ncu, const char* prop_name, guint *len );
-static gboolean     set_nwam_ncu_string_array_prop( nwam_ncu_handle_t ncu, const char* prop_name, char** strs, guint len);
 
-static guint64      get_nwam_ncu_uint64_prop( nwam_ncu_handle_t ncu, const char* prop_name );
-static gboolean     set_nwam_ncu_uint64_prop( nwam_ncu_handle_t ncu, const char* prop_name, guint64 value );
 
-static guint64*     get_nwam_ncu_uint64_array_prop( nwam_ncu_handle_t ncu, const char* prop_name , guint* out_num );
-static gboolean     set_nwam_ncu_uint64_array_prop( nwam_ncu_handle_t ncu, const char* prop_name , 
-                                                    const guint64* value, guint len );
 
 static gboolean     get_kstat_uint64 (const gchar *device, const gchar* stat_name, uint64_t *rval );
 
@@ -182,6 +235,7 @@ static gint         nwamui_object_real_sort(NwamuiObject *object, NwamuiObject *
 static gboolean     nwamui_object_real_validate(NwamuiObject *object, gchar **prop_name_ret);
 static gboolean     nwamui_object_real_commit( NwamuiObject* object );
 static void         nwamui_object_real_reload(NwamuiObject* object);
+static void         ncu_reload_from_props(NwamuiNcu *self, const ncu_props_t *props);
 static gboolean     nwamui_object_real_destroy( NwamuiObject* object );
 static gboolean     nwamui_object_real_is_modifiable(NwamuiObject *object);
 static void         nwamui_object_real_set_active ( NwamuiObject *object, gboolean active );
@@ -220,6 +274,7 @@ nwamui_ncu_class_init(NwamuiNcuClass *klass)
     gobject_class->set_property = nwamui_ncu_set_property;
     gobject_class->get_property = nwamui_ncu_get_property;
     gobject_class->finalize = (void (*)(GObject*)) nwamui_ncu_finalize;
+    gobject_class->notify = nwamui_ncu_notify;
 
     /* object get/set name in NCU are VANITY NAME */
     nwamuiobject_class->get_name = nwamui_ncu_get_vanity_name;
@@ -527,7 +582,7 @@ nwamui_ncu_set_property ( GObject         *object,
             break;
         case PROP_PHY_ADDRESS: {
                 const gchar* mac_addr = g_strdup( g_value_get_string( value ) );
-                set_nwam_ncu_string_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MAC_ADDR, mac_addr );
+                nwamui_prop_set_string( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MAC_ADDR, mac_addr );
                 set_modified_flag( self, NWAM_NCU_CLASS_PHYS, TRUE );
             }
             break;
@@ -539,7 +594,7 @@ nwamui_ncu_set_property ( GObject         *object,
             break;
         case PROP_MTU: {
                 guint64 mtu = g_value_get_uint( value );
-                set_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MTU, mtu );
+                nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MTU, mtu );
                 set_modified_flag( self, NWAM_NCU_CLASS_PHYS, TRUE );
             }
             break;
@@ -569,7 +624,7 @@ nwamui_ncu_set_property ( GObject         *object,
         case PROP_IPV4_DEFAULT_ROUTE: {
                 const gchar* default_route = g_strdup( g_value_get_string( value ) );
 
-                set_nwam_ncu_string_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_DEFAULT_ROUTE, default_route );
+                nwamui_prop_set_string( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_DEFAULT_ROUTE, default_route );
 
                 set_modified_flag( self, NWAM_NCU_CLASS_IP, TRUE );
             }
@@ -599,7 +654,7 @@ nwamui_ncu_set_property ( GObject         *object,
         case PROP_IPV6_DEFAULT_ROUTE: {
                 const gchar* default_route = g_strdup( g_value_get_string( value ) );
                 
-                set_nwam_ncu_string_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_DEFAULT_ROUTE, default_route );
+                nwamui_prop_set_string( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_DEFAULT_ROUTE, default_route );
                 
                 set_modified_flag( self, NWAM_NCU_CLASS_IP, TRUE );
             }
@@ -622,14 +677,14 @@ nwamui_ncu_set_property ( GObject         *object,
         case PROP_PRIORITY_GROUP: {
                 guint64 priority_group = g_value_get_uint( value );
 
-                set_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_PRIORITY_GROUP, priority_group );
+                nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_PRIORITY_GROUP, priority_group );
                 set_modified_flag( self, NWAM_NCU_CLASS_PHYS, TRUE );
             }
             break;
 
         case PROP_PRIORITY_GROUP_MODE: {
                 guint64 priority_mode = g_value_get_int( value );
-                set_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_PRIORITY_MODE, priority_mode );
+                nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_PRIORITY_MODE, priority_mode );
                 set_modified_flag( self, NWAM_NCU_CLASS_PHYS, TRUE );
             }
             break;
@@ -637,7 +692,7 @@ nwamui_ncu_set_property ( GObject         *object,
         case PROP_AUTO_PUSH: {
                 GList*  autopush = g_value_get_pointer( value );
                 gchar** autopush_strs = nwamui_util_glist_to_strv( autopush );
-                set_nwam_ncu_string_array_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_AUTOPUSH, autopush_strs, 0 );
+                nwamui_prop_set_string_array( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_AUTOPUSH, autopush_strs, 0 );
                 g_strfreev(autopush_strs);
                 set_modified_flag( self, NWAM_NCU_CLASS_PHYS, TRUE );
             }
@@ -666,7 +721,7 @@ nwamui_ncu_get_property (GObject         *object,
             }
             break;
         case PROP_PHY_ADDRESS: {
-                gchar* mac_addr = get_nwam_ncu_string_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MAC_ADDR );
+                gchar* mac_addr = nwamui_prop_get_string( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MAC_ADDR );
                 g_value_set_string(value, mac_addr );
                 g_free(mac_addr);
             }
@@ -687,7 +742,7 @@ nwamui_ncu_get_property (GObject         *object,
             }
             break;
         case PROP_MTU: {
-                guint64 mtu = get_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MTU);
+                guint64 mtu = nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_MTU);
                 g_value_set_uint( value, (guint)mtu );
             }
             break;
@@ -718,7 +773,7 @@ nwamui_ncu_get_property (GObject         *object,
         case PROP_IPV4_DEFAULT_ROUTE: {
                 gchar *default_route = NULL;
 
-                default_route = get_nwam_ncu_string_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_DEFAULT_ROUTE);
+                default_route = nwamui_prop_get_string( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_DEFAULT_ROUTE);
 
                 g_value_set_string( value, default_route );
             }
@@ -744,7 +799,7 @@ nwamui_ncu_get_property (GObject         *object,
         case PROP_IPV6_DEFAULT_ROUTE: {
                 gchar *default_route = NULL;
 
-                default_route = get_nwam_ncu_string_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_DEFAULT_ROUTE);
+                default_route = nwamui_prop_get_string( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_DEFAULT_ROUTE);
 
                 g_value_set_string( value, default_route );
             }
@@ -767,7 +822,7 @@ nwamui_ncu_get_property (GObject         *object,
             break;
 
         case PROP_PRIORITY_GROUP: {
-                g_value_set_uint( value, (guint)get_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS],
+                g_value_set_uint( value, (guint)nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS],
                                                       NWAM_NCU_PROP_PRIORITY_GROUP ) );
             }
             break;
@@ -775,13 +830,13 @@ nwamui_ncu_get_property (GObject         *object,
         case PROP_PRIORITY_GROUP_MODE: {
                 nwamui_cond_priority_group_mode_t priority_group_mode = 
                         (nwamui_cond_priority_group_mode_t)
-                        get_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_PRIORITY_MODE );
+                        nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_PRIORITY_MODE );
 
                 g_value_set_int( value, (gint)priority_group_mode );
             }
             break;
         case PROP_AUTO_PUSH: {
-                gchar** autopush = get_nwam_ncu_string_array_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_AUTOPUSH, NULL );
+                gchar** autopush = nwamui_prop_get_string_array( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_LINK_AUTOPUSH, NULL );
                 GList*  autopush_list = nwamui_util_strv_to_glist( autopush );
                 g_value_set_pointer( value, autopush_list );
                 g_strfreev(autopush);
@@ -836,38 +891,117 @@ get_if_type( const gchar* device )
     return( type );
 }
 
+/*
+ * Decode the properties we are interested in. Values are owned by libnwam
+ * and freed once we return, so anything kept is copied into the arena.
+ */
+static int
+ncu_props_walker_cb(const char *prop, nwam_value_t value, void *data)
+{
+    ncu_props_t *props = (ncu_props_t *)data;
+
+    if (strcmp(prop, NWAM_NCU_PROP_ENABLED) == 0) {
+        boolean_t enabled = B_FALSE;
+
+        /* Every class has its own enabled, the NCU's is the link's. */
+        if (props->walk_class != NWAM_NCU_CLASS_PHYS) {
+            return 0;
+        }
+
+        if (nwam_value_get_boolean(value, &enabled) == NWAM_SUCCESS) {
+            props->enabled = (gboolean)enabled;
+        }
+    } else if (strcmp(prop, NWAM_NCU_PROP_IP_VERSION) == 0) {
+        props->ip_version = nwamui_prop_arena_decode_uint64_array(props->arena, value, &props->ip_version_num);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPV4_ADDRSRC) == 0) {
+        props->ipv4_addrsrc = nwamui_prop_arena_decode_uint64_array(props->arena, value, &props->ipv4_addrsrc_num);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPV4_ADDR) == 0) {
+        props->ipv4_addr = nwamui_prop_arena_decode_string_array(props->arena, value, NULL);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPV6_ADDRSRC) == 0) {
+        props->ipv6_addrsrc = nwamui_prop_arena_decode_uint64_array(props->arena, value, &props->ipv6_addrsrc_num);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPV6_ADDR) == 0) {
+        props->ipv6_addr = nwamui_prop_arena_decode_string_array(props->arena, value, NULL);
+    }
 #ifdef TUNNEL_SUPPORT
+    else if (strcmp(prop, NWAM_NCU_PROP_IPTUN_TYPE) == 0) {
+        uint64_t tun_type = 0;
+
+        if (nwam_value_get_uint64(value, &tun_type) == NWAM_SUCCESS) {
+            props->tun_type = (guint64)tun_type;
+        }
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPTUN_TSRC) == 0) {
+        props->tun_tsrc = nwamui_prop_arena_decode_string(props->arena, value);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPTUN_TDST) == 0) {
+        props->tun_tdst = nwamui_prop_arena_decode_string(props->arena, value);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPTUN_ENCR) == 0) {
+        props->tun_encr = nwamui_prop_arena_decode_string(props->arena, value);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPTUN_ENCR_AUTH) == 0) {
+        props->tun_encr_auth = nwamui_prop_arena_decode_string(props->arena, value);
+    } else if (strcmp(prop, NWAM_NCU_PROP_IPTUN_AUTH) == 0) {
+        props->tun_auth = nwamui_prop_arena_decode_string(props->arena, value);
+    }
+#endif /* TUNNEL_SUPPORT */
+
+    return 0;
+}
+
+/* Decode the properties of one class into @props, on top of what is there. */
+static void
+ncu_props_fetch_class(ncu_props_t *props, nwam_ncu_class_t i, nwam_ncu_handle_t ncu_handle)
+{
+    nwam_error_t nerr;
+
+    props->walk_class = i;
+    if ((nerr = nwam_ncu_walk_props(ncu_handle, ncu_props_walker_cb,
+          props, 0, NULL)) != NWAM_SUCCESS) {
+        g_debug("Walk props of ncu class '%d' error: %s", i, nwam_strerror(nerr));
+    }
+}
+
+/**
+ * ncu_props_fetch:
+ *
+ * Walk every property of each class handle once and decode it into props,
+ * with values allocated from arena. Only touches libnwam, so it is safe to
+ * call from a worker thread.
+ **/
+static void
+ncu_props_fetch(ncu_props_t *props, NwamuiPropArena *arena, nwam_ncu_handle_t *ncu_handles)
+{
+    nwam_ncu_class_t i;
+
+    bzero(props, sizeof(ncu_props_t));
+    props->arena = arena;
+
+    for (i = 0; i < NWAM_NCU_CLASS_ANY; i++) {
+        if (ncu_handles[i] != NULL) {
+            ncu_props_fetch_class(props, i, ncu_handles[i]);
+        }
+    }
+}
+
 static void
-populate_iptun_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
-{
-    nwam_iptun_type_t tun_type; 
-    gchar* tun_tsrc;
-    gchar* tun_tdst;
-    gchar* tun_encr;
-    gchar* tun_encr_auth;
-    gchar* tun_auth;
-
-    tun_type = get_nwam_ncu_uint64_prop( nwam_ncu, NWAM_NCU_PROP_IPTUN_TYPE );
-    tun_tsrc = get_nwam_ncu_string_prop( nwam_ncu, NWAM_NCU_PROP_IPTUN_TSRC );
-    tun_tdst = get_nwam_ncu_string_prop( nwam_ncu, NWAM_NCU_PROP_IPTUN_TDST );
-    tun_encr = get_nwam_ncu_string_prop( nwam_ncu, NWAM_NCU_PROP_IPTUN_ENCR );
-    tun_encr_auth = get_nwam_ncu_string_prop( nwam_ncu, NWAM_NCU_PROP_IPTUN_ENCR_AUTH );
-    tun_auth = get_nwam_ncu_string_prop( nwam_ncu, NWAM_NCU_PROP_IPTUN_AUTH );
+populate_ncu_data(NwamuiNcu *ncu, const ncu_props_t *props)
+{
+    populate_phys_ncu_data(ncu, props);
+    populate_ip_ncu_data(ncu, props);
+#ifdef TUNNEL_SUPPORT
+    populate_iptun_ncu_data(ncu, props);
+#endif /* TUNNEL_SUPPORT */
+}
 
+#ifdef TUNNEL_SUPPORT
+static void
+populate_iptun_ncu_data( NwamuiNcu *ncu, const ncu_props_t *props )
+{
     g_object_set( ncu, 
-                  "tun_type", tun_type,
-                  "tun_tsrc", tun_tsrc,
-                  "tun_tdst", tun_tdst,
-                  "tun_encr", tun_encr,
-                  "tun_encr_auth", tun_encr_auth,
-                  "tun_auth", tun_auth,
+                  "tun_type", (nwam_iptun_type_t)props->tun_type,
+                  "tun_tsrc", props->tun_tsrc,
+                  "tun_tdst", props->tun_tdst,
+                  "tun_encr", props->tun_encr,
+                  "tun_encr_auth", props->tun_encr_auth,
+                  "tun_auth", props->tun_auth,
                   NULL );
-
-    g_free(tun_tsrc);
-    g_free(tun_tdst);
-    g_free(tun_encr);
-    g_free(tun_encr_auth);
-    g_free(tun_auth);
 }
 #endif /* TUNNEL_SUPPORT */
 
@@ -882,25 +1016,19 @@ populate_iptun_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
  * is Static.
  */
 static void
-populate_ip_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
+populate_ip_ncu_data( NwamuiNcu *ncu, const ncu_props_t *props )
 {
     NwamuiNcuPrivate *prv              = NWAMUI_NCU_GET_PRIVATE(ncu);
-    guint64          *ip_version       = NULL;
-    guint             ip_version_num   = NULL;
-    guint64          *ipv4_addrsrc     = NULL;
-    guint             ipv4_addrsrc_num = 0;
-    gchar**           ipv4_addr        = NULL;
-    guint             ipv4_addr_num    = 0;
-    guint             ipv6_addr_num    = 0;
-    guint64          *ipv6_addrsrc     = NULL;
-    guint             ipv6_addrsrc_num = 0;
-    gchar**           ipv6_addr        = NULL;
+    const guint64    *ip_version       = props->ip_version;
+    guint             ip_version_num   = props->ip_version_num;
+    const guint64    *ipv4_addrsrc     = props->ipv4_addrsrc;
+    guint             ipv4_addrsrc_num = props->ipv4_addrsrc_num;
+    const gchar* const *ipv4_addr      = props->ipv4_addr;
+    const guint64    *ipv6_addrsrc     = props->ipv6_addrsrc;
+    guint             ipv6_addrsrc_num = props->ipv6_addrsrc_num;
+    const gchar* const *ipv6_addr      = props->ipv6_addr;
     int               ip_n;
     
-    ip_version = get_nwam_ncu_uint64_array_prop( nwam_ncu, 
-                                                 NWAM_NCU_PROP_IP_VERSION, 
-                                                 &ip_version_num );
-
     g_object_freeze_notify(G_OBJECT(prv->v4addresses));
     g_object_freeze_notify(G_OBJECT(prv->v6addresses));
 
@@ -912,17 +1040,12 @@ populate_ip_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
 
     for ( ip_n = 0; ip_n < ip_version_num; ip_n++ ) {
         if (ip_version[ip_n] == IPV4_VERSION) {
-            char **ptr;
+            const gchar* const *ptr;
             gint   i;
 
-            ipv4_addrsrc = get_nwam_ncu_uint64_array_prop( nwam_ncu, 
-                                                           NWAM_NCU_PROP_IPV4_ADDRSRC, 
-                                                           &ipv4_addrsrc_num );
-
-            ipv4_addr = get_nwam_ncu_string_array_prop(nwam_ncu, NWAM_NCU_PROP_IPV4_ADDR, &ipv4_addr_num );
-
             /* Populate the v4addresses member */
-            g_debug( "ipv4_addrsrc_num = %d, ipv4_addr_num = %d", ipv4_addrsrc_num, ipv4_addr_num );
+            g_debug( "ipv4_addrsrc_num = %d, ipv4_addr_num = %d", ipv4_addrsrc_num,
+              ipv4_addr ? g_strv_length((gchar**)ipv4_addr) : 0 );
             ptr = ipv4_addr;
 
             for( i = 0; i < ipv4_addrsrc_num; i++ ) {
@@ -957,9 +1080,6 @@ populate_ip_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
                         g_signal_handlers_unblock_by_func(G_OBJECT(prv->v4addresses), (gpointer)ip_row_inserted_or_changed_cb, (gpointer)ncu);
 
                         g_object_unref(ip);
-
-                        /* Free up memory as we go */
-                        g_free(*ptr);
                     }
                 }
                     break;
@@ -967,28 +1087,17 @@ populate_ip_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
                     break;
                 }
             }
-            g_free(ipv4_addrsrc);
-
-            if ( ipv4_addr != NULL ) {
-                g_free(ipv4_addr);
-            }
-
             if ( ipv4_addrsrc_num > 0 ) {
                 prv->ipv4_active = TRUE;
             }
         }
         else if (ip_version[ip_n] == IPV6_VERSION) {
-            char **ptr;
+            const gchar* const *ptr;
             gint   i;
 
-            ipv6_addrsrc = get_nwam_ncu_uint64_array_prop(  nwam_ncu, 
-                                                            NWAM_NCU_PROP_IPV6_ADDRSRC, 
-                                                            &ipv6_addrsrc_num );
-            
-            ipv6_addr = get_nwam_ncu_string_array_prop(nwam_ncu, NWAM_NCU_PROP_IPV6_ADDR, &ipv6_addr_num );
-
             /* Populate the v6addresses member */
-            g_debug( "ipv6_addrsrc_num = %d, ipv6_addr_num = %d", ipv6_addrsrc_num, ipv6_addr_num );
+            g_debug( "ipv6_addrsrc_num = %d, ipv6_addr_num = %d", ipv6_addrsrc_num,
+              ipv6_addr ? g_strv_length((gchar**)ipv6_addr) : 0 );
             ptr = ipv6_addr;
 
             for( i = 0; i < ipv6_addrsrc_num; i++ ) {
@@ -1035,9 +1144,6 @@ populate_ip_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
                         g_signal_handlers_unblock_by_func(G_OBJECT(prv->v6addresses), (gpointer)ip_row_inserted_or_changed_cb, (gpointer)ncu);
 
                         g_object_unref(ip);
-
-                        /* Free up memory as we go */
-                        g_free(*ptr);
                     }
                 }
                     break;
@@ -1045,17 +1151,11 @@ populate_ip_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
                     break;
                 }
             }
-            g_free(ipv6_addrsrc);
             if ( ipv6_addrsrc_num > 0 ) {
                 prv->ipv6_active = TRUE;
             }
-
-            if ( ipv6_addr != NULL ) {
-                g_free(ipv6_addr);
-            }
         }
     }
-    g_free(ip_version);
 
     g_object_thaw_notify(G_OBJECT(prv->v4addresses));
     g_object_thaw_notify(G_OBJECT(prv->v6addresses));
@@ -1063,12 +1163,12 @@ populate_ip_ncu_data( NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu )
 }
 
 static void
-populate_phys_ncu_data(NwamuiNcu *ncu, nwam_ncu_handle_t nwam_ncu)
+populate_phys_ncu_data(NwamuiNcu *ncu, const ncu_props_t *props)
 {
     NwamuiNcuPrivate *prv = NWAMUI_NCU_GET_PRIVATE(ncu);
     gboolean          enabled;
 
-    enabled = get_nwam_ncu_boolean_prop(nwam_ncu, NWAM_NCU_PROP_ENABLED);
+    enabled = props->enabled;
     if ( enabled != prv->enabled ) {
         prv->enabled = enabled;
         g_object_notify(G_OBJECT(ncu), "enabled" );
@@ -1178,14 +1278,14 @@ nwamui_ncu_sync_handle_with_ip_data( NwamuiNcu *self )
         ipv4_addr[addr_index] = NULL;
 
         if ( addr_index > 0 ) {
-            set_nwam_ncu_string_array_prop(self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
+            nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
                                            NWAM_NCU_PROP_IPV4_ADDR, ipv4_addr, 0 );
         }
         else {
-            delete_nwam_ncu_prop(self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_ADDR);
+            nwamui_prop_delete( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_ADDR);
         }
         if ( ipv4_addrsrc_num > 0 ) {
-            set_nwam_ncu_uint64_array_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
+            nwamui_prop_set_uint64_array( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
                                             NWAM_NCU_PROP_IPV4_ADDRSRC, 
                                             ipv4_addrsrc,
                                             ipv4_addrsrc_num );
@@ -1197,8 +1297,8 @@ nwamui_ncu_sync_handle_with_ip_data( NwamuiNcu *self )
     }
     else {
         /* Delete properties for IPV4 */
-        delete_nwam_ncu_prop(self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_ADDR);
-        delete_nwam_ncu_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_ADDRSRC );
+        nwamui_prop_delete( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_ADDR);
+        nwamui_prop_delete( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV4_ADDRSRC );
     }
 
     if ( self->prv->ipv6_active ) {
@@ -1249,14 +1349,14 @@ nwamui_ncu_sync_handle_with_ip_data( NwamuiNcu *self )
         ipv6_addr[addr_index] = NULL;
 
         if ( addr_index > 0 ) {
-            set_nwam_ncu_string_array_prop(self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
+            nwamui_prop_set_string_array(NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
                                            NWAM_NCU_PROP_IPV6_ADDR, ipv6_addr, 0 );
         }
         else {
-            delete_nwam_ncu_prop(self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_ADDR);
+            nwamui_prop_delete( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_ADDR);
         }
         if ( ipv6_addrsrc_num > 0 ) {
-            set_nwam_ncu_uint64_array_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
+            nwamui_prop_set_uint64_array( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
                                             NWAM_NCU_PROP_IPV6_ADDRSRC, 
                                             ipv6_addrsrc,
                                             ipv6_addrsrc_num );
@@ -1268,12 +1368,12 @@ nwamui_ncu_sync_handle_with_ip_data( NwamuiNcu *self )
     }
     else {
         /* Delete properties for IPV6 */
-        delete_nwam_ncu_prop(self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_ADDR);
-        delete_nwam_ncu_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_ADDRSRC );
+        nwamui_prop_delete( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_ADDR);
+        nwamui_prop_delete( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IPV6_ADDRSRC );
     }
 
     if ( ip_version_num > 0 ) {
-        set_nwam_ncu_uint64_array_prop(  self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
+        nwamui_prop_set_uint64_array( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP],
                                          NWAM_NCU_PROP_IP_VERSION, 
                                          ip_version,
                                          ip_version_num );
@@ -1281,7 +1381,7 @@ nwamui_ncu_sync_handle_with_ip_data( NwamuiNcu *self )
     else {
         /* Delete IP_VERSION property, since we shouldn't store an empty list.
          */
-        delete_nwam_ncu_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IP_VERSION);
+        nwamui_prop_delete( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_IP], NWAM_NCU_PROP_IP_VERSION);
     }
 }
 
@@ -1367,6 +1467,146 @@ nwamui_ncu_new_with_handle( NwamuiNcp* ncp, nwam_ncu_handle_t ncu )
     return object;
 }
 
+/**
+ * nwamui_ncu_prefetch_new:
+ * @ncp: the NCP handle the NCU belongs to.
+ * @device_name: the NCU name.
+ * @arena: arena to decode into, taken over and reset, or NULL for a new one.
+ *
+ * Reads every class handle of an NCU and decodes its properties. This only
+ * uses libnwam, so NCPs call it from a worker thread to read several NCUs
+ * at once, then apply the result in the main thread.
+ *
+ * @returns: a #NwamuiNcuPrefetch, free with nwamui_ncu_prefetch_free().
+ **/
+extern NwamuiNcuPrefetch*
+nwamui_ncu_prefetch_new(nwam_ncp_handle_t ncp, const gchar *device_name, NwamuiPropArena *arena)
+{
+    NwamuiNcuPrefetch *prefetch = g_new0(NwamuiNcuPrefetch, 1);
+    nwam_ncu_class_t   i;
+    nwam_error_t       nerr;
+
+    prefetch->device_name = g_strdup(device_name);
+
+    for (i = 0; i < NWAM_NCU_CLASS_ANY; i++) {
+        nerr = nwam_ncu_read(ncp, device_name, nwam_ncu_class_to_type(i), 0,
+          &prefetch->ncu_handles[i]);
+        if (nerr != NWAM_SUCCESS) {
+            g_debug("Failed to read ncu information for %s error: %s", device_name, nwam_strerror(nerr));
+            prefetch->ncu_handles[i] = NULL;
+        }
+    }
+
+    if (arena == NULL) {
+        arena = nwamui_prop_arena_new();
+    } else {
+        nwamui_prop_arena_reset(arena);
+    }
+    ncu_props_fetch(&prefetch->props, arena, prefetch->ncu_handles);
+
+    return prefetch;
+}
+
+extern void
+nwamui_ncu_prefetch_free(NwamuiNcuPrefetch *prefetch)
+{
+    nwam_ncu_class_t i;
+
+    if (prefetch == NULL) {
+        return;
+    }
+
+    for (i = 0; i < NWAM_NCU_CLASS_ANY; i++) {
+        if (prefetch->ncu_handles[i]) {
+            nwam_ncu_free(prefetch->ncu_handles[i]);
+        }
+    }
+    nwamui_prop_arena_free(prefetch->props.arena);
+    g_free(prefetch->device_name);
+    g_free(prefetch);
+}
+
+/**
+ * nwamui_ncu_reload_with_prefetch:
+ *
+ * Same as nwamui_object_reload() but takes handles and properties from
+ * @prefetch instead of reading them. Handles are moved into the NCU.
+ **/
+extern void
+nwamui_ncu_reload_with_prefetch(NwamuiNcu *self, NwamuiNcuPrefetch *prefetch)
+{
+    NwamuiNcuPrivate *prv = NWAMUI_NCU_GET_PRIVATE(self);
+    nwam_ncu_class_t  i;
+
+    g_return_if_fail(NWAMUI_IS_NCU(self));
+    g_return_if_fail(prefetch != NULL);
+
+    for (i = 0; i < NWAM_NCU_CLASS_ANY; i++) {
+        /* As nwamui_object_real_open, keep the in-memory handle if the NCU
+         * class wasn't found, and decode that class from it as reload
+         * would, instead of resetting its properties.
+         */
+        if (prefetch->ncu_handles[i]) {
+            if (prv->ncu_handles[i]) {
+                nwam_ncu_free(prv->ncu_handles[i]);
+            }
+            prv->ncu_handles[i] = prefetch->ncu_handles[i];
+            prefetch->ncu_handles[i] = NULL;
+        } else if (prv->ncu_handles[i]) {
+            ncu_props_fetch_class(&prefetch->props, i, prv->ncu_handles[i]);
+        }
+    }
+
+    ncu_reload_from_props(self, &prefetch->props);
+
+    /* The NCU now owns the values, the previous ones go in one shot. */
+    nwamui_prop_arena_free(prv->prop_arena);
+    prv->prop_arena = prefetch->props.arena;
+    prefetch->props.arena = NULL;
+}
+
+/**
+ * nwamui_ncu_take_prop_arena:
+ *
+ * Detach the arena backing the last reload, so an NCP can hand it to
+ * nwamui_ncu_prefetch_new() and reuse its blocks for the next one. The
+ * decoded values were copied into the NCU by then, nothing reads them.
+ *
+ * @returns: the arena, or NULL.
+ **/
+extern NwamuiPropArena*
+nwamui_ncu_take_prop_arena(NwamuiNcu *self)
+{
+    NwamuiNcuPrivate *prv = NWAMUI_NCU_GET_PRIVATE(self);
+    NwamuiPropArena  *arena;
+
+    g_return_val_if_fail(NWAMUI_IS_NCU(self), NULL);
+
+    arena = prv->prop_arena;
+    prv->prop_arena = NULL;
+    return arena;
+}
+
+extern NwamuiObject*
+nwamui_ncu_new_with_prefetch(NwamuiNcp *ncp, NwamuiNcuPrefetch *prefetch)
+{
+    NwamuiObject     *object;
+    NwamuiNcuPrivate *prv;
+
+    g_return_val_if_fail(prefetch != NULL, NULL);
+
+    object = g_object_new(NWAMUI_TYPE_NCU, "ncp", ncp, NULL);
+    prv = NWAMUI_NCU_GET_PRIVATE(object);
+
+    nwamui_object_set_name(object, prefetch->device_name);
+
+    nwamui_ncu_reload_with_prefetch(NWAMUI_NCU(object), prefetch);
+
+    prv->initialisation = FALSE;
+
+    return object;
+}
+
 static int
 nwam_ncu_handle_clone_each_prop(const char *prop, nwam_value_t value, void *user_data)
 {
@@ -1504,20 +1744,37 @@ nwamui_object_real_reload(NwamuiObject* object)
 {
     NwamuiNcuPrivate  *prv  = NWAMUI_NCU_GET_PRIVATE(object);
     NwamuiNcu         *self = NWAMUI_NCU(object);
-    nwam_ncu_class_t  i;
+    ncu_props_t        props;
 
     nwamui_object_real_open(object, prv->device_name, NWAMUI_OBJECT_OPEN);
 
     g_return_if_fail( NWAMUI_IS_NCU(self) );
 
+    /* Drop everything decoded by the previous reload in one go. */
+    if (prv->prop_arena == NULL) {
+        prv->prop_arena = nwamui_prop_arena_new();
+    } else {
+        nwamui_prop_arena_reset(prv->prop_arena);
+    }
+
+    ncu_props_fetch(&props, prv->prop_arena, prv->ncu_handles);
+    ncu_reload_from_props(self, &props);
+}
+
+/*
+ * Populate the NCU from already decoded properties, shared by reload and the
+ * prefetch path used by the NCP.
+ */
+static void
+ncu_reload_from_props(NwamuiNcu *self, const ncu_props_t *props)
+{
+    NwamuiNcuPrivate  *prv  = NWAMUI_NCU_GET_PRIVATE(self);
+    nwam_ncu_class_t  i;
+
     /* nwamui_object_set_handle will cause re-read from configuration */
     g_object_freeze_notify(G_OBJECT(self));
 
-    populate_phys_ncu_data(self, prv->ncu_handles[NWAM_NCU_CLASS_PHYS]);
-    populate_ip_ncu_data(self, prv->ncu_handles[NWAM_NCU_CLASS_IP]);
-#ifdef TUNNEL_SUPPORT
-    populate_iptun_ncu_data(self, prv->ncu_handles[NWAM_NCU_CLASS_IPTUN]);
-#endif /* TUNNEL_SUPPORT */
+    populate_ncu_data(self, props);
 
     /* Tell GUI to refresh */
     g_object_notify(G_OBJECT(self), "activation-mode");
@@ -1650,7 +1907,7 @@ nwamui_object_real_commit( NwamuiObject *object )
     g_return_val_if_fail(NWAMUI_IS_NCU(object), FALSE);
 
     activation_mode = (nwamui_cond_activation_mode_t)
-      get_nwam_ncu_uint64_prop( prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE );
+      nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_NCU, prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE );
 
     for (i = 0; i < NWAM_NCU_CLASS_ANY; i++) {
         if (prv->ncu_modified[i] && prv->ncu_handles[i] != NULL) {
@@ -1666,7 +1923,7 @@ nwamui_object_real_commit( NwamuiObject *object )
                 return FALSE;
             }
             /* Set enabled flag. */
-            currently_enabled = get_nwam_ncu_boolean_prop(prv->ncu_handles[i],
+            currently_enabled = nwamui_prop_get_boolean(NWAMUI_PROP_CLASS_NCU, prv->ncu_handles[i],
               NWAM_NCU_PROP_ENABLED);
 
             if (prv->enabled != currently_enabled) {
@@ -2742,7 +2999,7 @@ nwamui_object_real_set_activation_mode (NwamuiObject *object, gint activation_mo
          * a readonly property.
          */
         for (i = 0; i < NWAM_NCU_CLASS_ANY; i++) {
-            currently_enabled = get_nwam_ncu_boolean_prop(self->prv->ncu_handles[i], NWAM_NCU_PROP_ENABLED);
+            currently_enabled = nwamui_prop_get_boolean(NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[i], NWAM_NCU_PROP_ENABLED);
             if (!currently_enabled) {
                 if ((nerr = nwam_ncu_enable(self->prv->ncu_handles[i])) != NWAM_SUCCESS ) {
                     g_warning("Failed to enable NCU '%d' due to error: %s", i, nwam_strerror(nerr));
@@ -2756,7 +3013,7 @@ nwamui_object_real_set_activation_mode (NwamuiObject *object, gint activation_mo
     default:
         break;
     }
-    set_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE, (guint64)activation_mode );
+    nwamui_prop_set_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE, (guint64)activation_mode );
     set_modified_flag( self, NWAM_NCU_CLASS_PHYS, TRUE );
 }
 
@@ -2775,7 +3032,7 @@ nwamui_object_real_get_activation_mode (NwamuiObject *object)
     g_return_val_if_fail (NWAMUI_IS_NCU (self), activation_mode);
 
     activation_mode = (nwamui_cond_activation_mode_t)
-      get_nwam_ncu_uint64_prop( self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE );
+      nwamui_prop_get_uint64( NWAMUI_PROP_CLASS_NCU, self->prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE );
 
     return( (nwamui_cond_activation_mode_t)activation_mode );
 }
@@ -3062,6 +3319,8 @@ nwamui_ncu_finalize (NwamuiNcu *self)
     NwamuiNcuPrivate *prv  = NWAMUI_NCU_GET_PRIVATE(self);
     nwam_ncu_class_t i;
 
+    ncu_display_invalidate(self);
+
     if (prv->v4addresses != NULL ) {
         g_object_unref( G_OBJECT(prv->v4addresses) );
     }
@@ -3096,6 +3355,8 @@ nwamui_ncu_finalize (NwamuiNcu *self)
         }
     }
 
+    nwamui_prop_arena_free(prv->prop_arena);
+
     self->prv = NULL;
 
 	G_OBJECT_CLASS(nwamui_ncu_parent_class)->finalize(G_OBJECT(self));
@@ -3311,6 +3572,7 @@ nwamui_ncu_add_acquired(NwamuiNcu *self,
     }
 
     *l = g_list_prepend(*l, ip);
+    ncu_display_invalidate(self);
     
     g_debug("emit=%d, %s", emit, nwamui_ip_get_address(ip));
     g_debug("need_ipv4=%d need_ipv6=%d", prv->need_ipv4_dhcp, prv->need_ipv6_dhcp);
@@ -3343,6 +3605,7 @@ nwamui_ncu_clean_acquired(NwamuiNcu *self)
     }
     prv->need_ipv4_dhcp = prv->ipv4_has_dhcp;
     prv->need_ipv6_dhcp = prv->ipv6_has_dhcp;
+    ncu_display_invalidate(self);
 }
 
 extern gboolean
@@ -3355,60 +3618,6 @@ nwamui_ncu_acquired_all(NwamuiNcu *self)
     return !(prv->need_ipv4_dhcp || prv->need_ipv6_dhcp);
 }
 
-static gchar*
-get_nwam_ncu_string_prop( nwam_ncu_handle_t ncu, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar*              retval = NULL;
-    char*               value = NULL;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_value (ncu, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL ) {
-        retval  = g_strdup ( value );
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-prop_is_readonly( const char* prop_name ) 
-{
-    boolean_t       read_only = B_FALSE;
-    nwam_error_t    nerr;
-
-    if ( (nerr = nwam_ncu_prop_read_only( prop_name, &read_only ) ) != NWAM_SUCCESS ) {
-        g_warning("Unable to get read-only status for ncu property %s: %s", prop_name, nwam_strerror(nerr) );
-        return FALSE;
-    }
-
-    return( (read_only == B_TRUE)?TRUE:FALSE );
-}
-
 static void 
 set_modified_flag( NwamuiNcu* self, nwam_ncu_class_t ncu_class, gboolean value )
 {
@@ -3433,7 +3642,7 @@ set_enabled_flag(NwamuiNcu* self, nwam_ncu_handle_t nwam_ncu, gboolean value)
     g_return_if_fail(nwam_ncu);
 
     activation_mode = (nwamui_cond_activation_mode_t)
-      get_nwam_ncu_uint64_prop(prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE);
+      nwamui_prop_get_uint64(NWAMUI_PROP_CLASS_NCU, prv->ncu_handles[NWAM_NCU_CLASS_PHYS], NWAM_NCU_PROP_ACTIVATION_MODE);
                 
     if (activation_mode == NWAMUI_COND_ACTIVATION_MODE_MANUAL) {
         nwam_error_t nerr;
@@ -3449,429 +3658,6 @@ set_enabled_flag(NwamuiNcu* self, nwam_ncu_handle_t nwam_ncu, gboolean value)
     }
 }
 
-static gboolean
-delete_nwam_ncu_prop( nwam_ncu_handle_t ncu, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    gboolean            retval = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( prop_is_readonly( prop_name ) ) {
-        g_warning("Attempting to delete a read-only ncu property %s", prop_name );
-        return retval;
-    }
-
-    if ( (nerr = nwam_ncu_delete_prop(ncu, prop_name)) != NWAM_SUCCESS ) {
-        g_debug("Unable to delete ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    return( retval );
-}
-
-static gboolean
-set_nwam_ncu_string_prop( nwam_ncu_handle_t ncu, const char* prop_name, const gchar* str )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( prop_is_readonly( prop_name ) ) {
-        g_warning("Attempting to set a read-only ncu property %s", prop_name );
-        return retval;
-    }
-
-    if ( str == NULL ) {
-        retval = delete_nwam_ncu_prop( ncu, prop_name );
-    }
-    else {
-        if ( (nerr = nwam_value_create_string( (char*)str, &nwam_data )) != NWAM_SUCCESS ) {
-            g_debug("Error creating a string value for string %s", str?str:"NULL");
-            return retval;
-        }
-
-        if ( (nerr = nwam_ncu_set_prop_value (ncu, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-            g_debug("Unable to set value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        }
-        else {
-            retval = TRUE;
-        }
-
-        nwam_value_free(nwam_data);
-    }
-
-    return( retval );
-}
-
-static gchar**
-get_nwam_ncu_string_array_prop( nwam_ncu_handle_t ncu, const char* prop_name, guint *len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gchar**             retval = NULL;
-    char**              value = NULL;
-    uint_t              num = 0;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_value (ncu, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_get_string_array(nwam_data, &value, &num )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get string value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return retval;
-    }
-
-    if ( value != NULL && num > 0 ) {
-        /* Create a NULL terminated list of stirngs, allocate 1 extra place
-         * for NULL termination. */
-        retval = (gchar**)g_malloc0( sizeof(gchar*) * (num+1) );
-        int i;
-
-        for (i = 0; i < num; i++ ) {
-            retval[i]  = g_strdup ( value[i] );
-        }
-        retval[num]=NULL;
-    }
-
-    if ( len != NULL ) {
-        *len = num;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-set_nwam_ncu_string_array_prop( nwam_ncu_handle_t ncu, const char* prop_name, char** strs, guint len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_STRING ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( strs == NULL ) {
-        return retval;
-    }
-
-
-    if ( len == 0 ) { /* Assume a strv, i.e. NULL terminated list, otherwise strs would be NULL */
-        int i;
-
-        for( i = 0; strs != NULL && strs[i] != NULL; i++ ) {
-            /* Do Nothing, just count. */
-        }
-        len = i;
-    }
-
-    if ( prop_is_readonly( prop_name ) ) {
-        g_warning("Attempting to set a read-only ncu property %s", prop_name );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_string_array (strs, len, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a value for string array 0x%08X", strs);
-        return retval;
-    }
-
-    if ( (nerr = nwam_ncu_set_prop_value (ncu, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static gboolean
-get_nwam_ncu_boolean_prop( nwam_ncu_handle_t ncu, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    boolean_t           value = FALSE;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( ncu == NULL ) {
-        return( value );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS ) {
-        g_warning("Unexpected error for ncu property %s - %s\n", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( nwam_type != NWAM_VALUE_TYPE_BOOLEAN ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_value (ncu, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_boolean(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get boolean value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (gboolean)value );
-}
-
-static gboolean
-set_nwam_ncu_boolean_prop( nwam_ncu_handle_t ncu, const char* prop_name, gboolean bool_value )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_BOOLEAN ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( prop_is_readonly( prop_name ) ) {
-        g_warning("Attempting to set a read-only ncu property %s", prop_name );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_boolean ((boolean_t)bool_value, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a boolean value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_ncu_set_prop_value (ncu, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-
-static guint64
-get_nwam_ncu_uint64_prop( nwam_ncu_handle_t ncu, const char* prop_name )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t            value = 0;
-
-    g_return_val_if_fail( prop_name != NULL, value );
-
-    if ( ncu == NULL ) {
-        return( value );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_value (ncu, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_uint64(nwam_data, &value )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    nwam_value_free(nwam_data);
-
-    return( (guint64)value );
-}
-
-static gboolean
-set_nwam_ncu_uint64_prop( nwam_ncu_handle_t ncu, const char* prop_name, guint64 value )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( prop_is_readonly( prop_name ) ) {
-        g_warning("Attempting to set a read-only ncu property %s", prop_name );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_uint64 (value, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a uint64 value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_ncu_set_prop_value (ncu, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
-static guint64* 
-get_nwam_ncu_uint64_array_prop( nwam_ncu_handle_t ncu, const char* prop_name , guint *out_num )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    uint64_t           *value = NULL;
-    uint_t              num = 0;
-    guint64            *retval = NULL;
-    int                 i;
-
-    g_return_val_if_fail( prop_name != NULL && out_num != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return value;
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_value (ncu, prop_name, &nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("No value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    if ( (nerr = nwam_value_get_uint64_array(nwam_data, &value, &num )) != NWAM_SUCCESS ) {
-        g_debug("Unable to get uint64 value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-        return value;
-    }
-
-    retval = (guint64*)g_malloc( sizeof(guint64) * num );
-    for ( i = 0; i < num; i++ ) {
-        retval[i] = (guint64)value[i];
-    }
-
-    nwam_value_free(nwam_data);
-
-    *out_num = num;
-
-    return( retval );
-}
-
-static gboolean
-set_nwam_ncu_uint64_array_prop( nwam_ncu_handle_t ncu, const char* prop_name, 
-                                const guint64 *value_array, guint len )
-{
-    nwam_error_t        nerr;
-    nwam_value_type_t   nwam_type;
-    nwam_value_t        nwam_data;
-    gboolean            retval = FALSE;
-    g_return_val_if_fail( prop_name != NULL, retval );
-
-    if ( ncu == NULL ) {
-        return( retval );
-    }
-
-    if ( (nerr = nwam_ncu_get_prop_type( prop_name, &nwam_type ) ) != NWAM_SUCCESS 
-         || nwam_type != NWAM_VALUE_TYPE_UINT64 ) {
-        g_warning("Unexpected type for ncu property %s - got %d\n", prop_name, nwam_type );
-        return retval;
-    }
-
-    if ( prop_is_readonly( prop_name ) ) {
-        g_warning("Attempting to set a read-only ncu property %s", prop_name );
-        return retval;
-    }
-
-    if ( (nerr = nwam_value_create_uint64_array ((uint64_t*)value_array, len, &nwam_data )) != NWAM_SUCCESS ) {
-        g_debug("Error creating a uint64 array value" );
-        return retval;
-    }
-
-    if ( (nerr = nwam_ncu_set_prop_value (ncu, prop_name, nwam_data)) != NWAM_SUCCESS ) {
-        g_debug("Unable to set value for ncu property %s, error = %s", prop_name, nwam_strerror( nerr ) );
-    }
-    else {
-        retval = TRUE;
-    }
-
-    nwam_value_free(nwam_data);
-    
-    return( retval );
-}
-
 extern nwamui_wifi_signal_strength_t
 nwamui_ncu_get_signal_strength_from_dladm( NwamuiNcu* self )
 {
@@ -3959,7 +3745,7 @@ nwamui_ncu_has_dhcp_configured( NwamuiNcu *ncu, gboolean *ipv4_has_dhcp, gboolea
     gchar**             ipv6_addr = NULL;
     int                 ip_n;
 
-    ip_version = get_nwam_ncu_uint64_array_prop( ncu->prv->ncu_handles[NWAM_NCU_CLASS_IP], 
+    ip_version = nwamui_prop_get_uint64_array( NWAMUI_PROP_CLASS_NCU, ncu->prv->ncu_handles[NWAM_NCU_CLASS_IP], 
                                                  NWAM_NCU_PROP_IP_VERSION, 
                                                  &ip_version_num );
 
@@ -3977,7 +3763,7 @@ nwamui_ncu_has_dhcp_configured( NwamuiNcu *ncu, gboolean *ipv4_has_dhcp, gboolea
         if (ip_version[ip_n] == IPV4_VERSION) {
             int i;
 
-            ipv4_addrsrc = get_nwam_ncu_uint64_array_prop( ncu->prv->ncu_handles[NWAM_NCU_CLASS_IP], 
+            ipv4_addrsrc = nwamui_prop_get_uint64_array( NWAMUI_PROP_CLASS_NCU, ncu->prv->ncu_handles[NWAM_NCU_CLASS_IP], 
                                                            NWAM_NCU_PROP_IPV4_ADDRSRC, 
                                                            &ipv4_addrsrc_num );
 
@@ -3993,7 +3779,7 @@ nwamui_ncu_has_dhcp_configured( NwamuiNcu *ncu, gboolean *ipv4_has_dhcp, gboolea
         else if (ip_version[ip_n] == IPV6_VERSION) {
             int i;
 
-            ipv6_addrsrc = get_nwam_ncu_uint64_array_prop(  ncu->prv->ncu_handles[NWAM_NCU_CLASS_IP], 
+            ipv6_addrsrc = nwamui_prop_get_uint64_array( NWAMUI_PROP_CLASS_NCU, ncu->prv->ncu_handles[NWAM_NCU_CLASS_IP], 
                                                             NWAM_NCU_PROP_IPV6_ADDRSRC, 
                                                             &ipv6_addrsrc_num );
 
@@ -4586,8 +4372,160 @@ nwamui_ncu_get_configuration_summary_string( NwamuiNcu* self )
     return( g_string_free(status_string, FALSE) );
 }
 
+static void
+ncu_display_invalidate(NwamuiNcu *self)
+{
+    NwamuiNcuPrivate *prv = NWAMUI_NCU_GET_PRIVATE(self);
+
+    if (prv->display_valid == 0) {
+        return;
+    }
+    g_free(prv->display_summary);
+    g_free(prv->display_phy_address);
+    g_free(prv->display_markup);
+    g_free(prv->display_state_markup);
+    if (prv->display_status_icon) {
+        g_object_unref(prv->display_status_icon);
+    }
+    prv->display_summary = NULL;
+    prv->display_phy_address = NULL;
+    prv->display_markup = NULL;
+    prv->display_state_markup = NULL;
+    prv->display_status_icon = NULL;
+    prv->display_valid = 0;
+}
+
+/*
+ * The following return strings owned by the NCU, valid until its next
+ * notify, so cell data functions can use them without copying. Anything
+ * they are built from changes with a notify, apart from the acquired
+ * addresses which invalidate explicitly.
+ */
+extern const gchar*
+nwamui_ncu_get_cached_summary_string( NwamuiNcu* self )
+{
+    NwamuiNcuPrivate *prv;
+
+    g_return_val_if_fail( NWAMUI_IS_NCU( self ), NULL );
+
+    prv = NWAMUI_NCU_GET_PRIVATE(self);
+    if (!(prv->display_valid & NCU_DISPLAY_SUMMARY)) {
+        prv->display_summary = nwamui_ncu_get_configuration_summary_string(self);
+        prv->display_valid |= NCU_DISPLAY_SUMMARY;
+    }
+    return prv->display_summary;
+}
+
+extern const gchar*
+nwamui_ncu_get_cached_phy_address( NwamuiNcu* self )
+{
+    NwamuiNcuPrivate *prv;
+
+    g_return_val_if_fail( NWAMUI_IS_NCU( self ), NULL );
+
+    prv = NWAMUI_NCU_GET_PRIVATE(self);
+    if (!(prv->display_valid & NCU_DISPLAY_PHY_ADDRESS)) {
+        prv->display_phy_address = nwamui_ncu_get_phy_address(self);
+        prv->display_valid |= NCU_DISPLAY_PHY_ADDRESS;
+    }
+    return prv->display_phy_address;
+}
+
+/* Name in bold over the configuration summary and phy address. */
+extern const gchar*
+nwamui_ncu_get_cached_markup( NwamuiNcu* self )
+{
+    NwamuiNcuPrivate *prv;
+
+    g_return_val_if_fail( NWAMUI_IS_NCU( self ), NULL );
+
+    prv = NWAMUI_NCU_GET_PRIVATE(self);
+    if (!(prv->display_valid & NCU_DISPLAY_MARKUP)) {
+        const gchar *summary = nwamui_ncu_get_cached_summary_string(self);
+        const gchar *phy_addr = nwamui_ncu_get_cached_phy_address(self);
+
+        if (phy_addr) {
+            prv->display_markup = g_strdup_printf(_("<b>%s</b>\n<small>%s, %s</small>"),
+              nwamui_ncu_get_display_name(self), summary, phy_addr);
+        } else {
+            prv->display_markup = g_strdup_printf(_("<b>%s</b>\n<small>%s</small>"),
+              nwamui_ncu_get_display_name(self), summary);
+        }
+        prv->display_valid |= NCU_DISPLAY_MARKUP;
+    }
+    return prv->display_markup;
+}
+
+/* Name in bold over the connection state details. */
+extern const gchar*
+nwamui_ncu_get_cached_state_markup( NwamuiNcu* self )
+{
+    NwamuiNcuPrivate *prv;
+
+    g_return_val_if_fail( NWAMUI_IS_NCU( self ), NULL );
+
+    prv = NWAMUI_NCU_GET_PRIVATE(self);
+    if (!(prv->display_valid & NCU_DISPLAY_STATE_MARKUP)) {
+        gchar *info = nwamui_ncu_get_connection_state_detail_string(self, TRUE);
+
+        prv->display_state_markup = g_strdup_printf(_("<b>%s</b>\n<small>%s</small>"),
+          nwamui_ncu_get_display_name(self), info);
+        prv->display_valid |= NCU_DISPLAY_STATE_MARKUP;
+        g_free(info);
+    }
+    return prv->display_state_markup;
+}
+
+/* Status icon by type, signal strength and connection state, not ref'd. */
+extern GdkPixbuf*
+nwamui_ncu_get_cached_status_icon( NwamuiNcu* self, gint size )
+{
+    NwamuiNcuPrivate *prv;
+
+    g_return_val_if_fail( NWAMUI_IS_NCU( self ), NULL );
+
+    prv = NWAMUI_NCU_GET_PRIVATE(self);
+    if (!(prv->display_valid & NCU_DISPLAY_STATUS_ICON) || prv->display_icon_size != size) {
+        nwamui_wifi_signal_strength_t   strength = NWAMUI_WIFI_STRENGTH_NONE;
+        gboolean                        connected;
+
+        switch (nwamui_ncu_get_connection_state(self)) {
+        case NWAMUI_STATE_CONNECTED:
+        case NWAMUI_STATE_CONNECTED_ESSID: 
+            connected = TRUE;
+            break;
+        default:
+            connected = FALSE;
+            break;
+        }
+        if (prv->ncu_type == NWAMUI_NCU_TYPE_WIRELESS) {
+            strength = nwamui_ncu_get_signal_strength_from_dladm(self);
+        }
+
+        if (prv->display_status_icon) {
+            g_object_unref(prv->display_status_icon);
+        }
+        prv->display_status_icon = nwamui_util_get_network_status_icon(prv->ncu_type, strength,
+          connected ? NWAMUI_DAEMON_STATUS_ALL_OK : NWAMUI_DAEMON_STATUS_ERROR, size);
+        prv->display_icon_size = size;
+        prv->display_valid |= NCU_DISPLAY_STATUS_ICON;
+    }
+    return prv->display_status_icon;
+}
+
 /* Callbacks */
 
+static void
+nwamui_ncu_notify(GObject *object, GParamSpec *pspec)
+{
+    /* Runs before any handler, so they see fresh display strings. */
+    ncu_display_invalidate(NWAMUI_NCU(object));
+
+    if (G_OBJECT_CLASS(nwamui_ncu_parent_class)->notify) {
+        G_OBJECT_CLASS(nwamui_ncu_parent_class)->notify(object, pspec);
+    }
+}
+
 static gint
 find_first_dhcp_address(gconstpointer a, gconstpointer b)
 {
@@ -101,6 +101,16 @@ extern struct _NwamuiNcp;
 
 extern NwamuiObject*        nwamui_ncu_new_with_handle( struct _NwamuiNcp* ncp, nwam_ncu_handle_t ncu );
 
+typedef struct _NwamuiNcuPrefetch NwamuiNcuPrefetch;
+
+extern NwamuiNcuPrefetch*   nwamui_ncu_prefetch_new( nwam_ncp_handle_t ncp, const gchar *device_name,
+                                                     NwamuiPropArena *arena );
+extern void                 nwamui_ncu_prefetch_free( NwamuiNcuPrefetch *prefetch );
+
+extern NwamuiObject*        nwamui_ncu_new_with_prefetch( struct _NwamuiNcp* ncp, NwamuiNcuPrefetch *prefetch );
+extern void                 nwamui_ncu_reload_with_prefetch( NwamuiNcu *self, NwamuiNcuPrefetch *prefetch );
+extern NwamuiPropArena*     nwamui_ncu_take_prop_arena( NwamuiNcu *self );
+
 extern gchar*               nwamui_ncu_get_device_name ( NwamuiNcu *self );
 extern void                 nwamui_ncu_set_device_name ( NwamuiNcu *self, const gchar* name );
 
@@ -214,6 +224,16 @@ extern gchar*               nwamui_ncu_get_connection_state_detail_string( Nwamu
 
 extern gchar*               nwamui_ncu_get_configuration_summary_string( NwamuiNcu* self );
 
+extern const gchar*         nwamui_ncu_get_cached_summary_string( NwamuiNcu* self );
+
+extern const gchar*         nwamui_ncu_get_cached_phy_address( NwamuiNcu* self );
+
+extern const gchar*         nwamui_ncu_get_cached_markup( NwamuiNcu* self );
+
+extern const gchar*         nwamui_ncu_get_cached_state_markup( NwamuiNcu* self );
+
+extern GdkPixbuf*           nwamui_ncu_get_cached_status_icon( NwamuiNcu* self, gint size );
+
 extern nwam_state_t         nwamui_ncu_get_interface_nwam_state(NwamuiObject *object, nwam_aux_state_t* aux_state_p, const gchar**aux_state_string_p);
 
 extern nwam_state_t         nwamui_ncu_get_link_nwam_state(NwamuiNcu *self, nwam_aux_state_t* aux_state, const gchar**aux_state_string);
@@ -39,6 +39,7 @@ enum {
     PROP_ACTIVE,
     PROP_ACTIVATION_MODE,
     PROP_CONDITIONS,
+    PROP_SWITCHING,
     LAST_PROP
 };
 
@@ -52,12 +53,36 @@ enum {
 
 static guint nwamui_object_signals[LAST_SIGNAL] = {0};
 
+/* Seconds to wait for the daemon to report the requested state. */
+static guint activation_timeout = 20;
+
+/* Activations run one at a time, in submission order. */
+static GThreadPool *activation_pool = NULL;
+G_LOCK_DEFINE_STATIC(activation_pool);
+
+typedef struct {
+    NwamuiObject             *object;
+    gchar                    *name;         /* For the worker */
+    gint                    (*activate)(const gchar *name, gboolean active);
+    gboolean                  active;
+    NwamuiObjectActivateFunc  func;
+    gpointer                  user_data;
+    gint                      nerr;         /* Set by the worker */
+    gboolean                  worker_done;
+    gboolean                  cancelled;
+    gulong                    notify_id;
+    guint                     timeout_id;
+} activation_t;
+
 struct _NwamuiObjectPrivate {
     /* Cache */
     const gchar      *name;
     gint              activation_mode;
     nwam_state_t      nwam_state;
     nwam_aux_state_t  nwam_aux_state;
+
+    /* Pending asynchronous activation */
+    activation_t     *activation;
 };
 
 static GObject* nwamui_object_constructor(GType type,
@@ -76,6 +101,10 @@ static void nwamui_object_get_property(GObject         *object,
 
 static void nwamui_object_finalize(NwamuiObject *self);
 
+static void nwamui_object_dispatch_properties_changed(GObject *object,
+    guint            n_pspecs,
+    GParamSpec     **pspecs);
+
 /* Callbacks */
 static void nwamui_object_notify_cb( GObject *gobject, GParamSpec *arg1, gpointer data);
 
@@ -289,6 +318,7 @@ nwamui_object_class_init(NwamuiObjectClass *klass)
 	gobject_class->finalize = (void (*)(GObject*)) nwamui_object_finalize;
 	gobject_class->set_property = nwamui_object_set_property;
 	gobject_class->get_property = nwamui_object_get_property;
+	gobject_class->dispatch_properties_changed = nwamui_object_dispatch_properties_changed;
 
     klass->get_name = default_nwamui_object_get_name;
     klass->can_rename = default_nwamui_object_can_rename;
@@ -299,6 +329,7 @@ nwamui_object_class_init(NwamuiObjectClass *klass)
     klass->set_activation_mode = default_nwamui_object_set_activation_mode;
     klass->get_active = default_nwamui_object_get_active;
     klass->set_active = default_nwamui_object_set_active;
+    klass->activate = NULL;
     klass->get_enabled = default_nwamui_object_get_enabled;
     klass->set_enabled = default_nwamui_object_set_enabled;
     klass->get_nwam_state = default_nwamui_object_get_nwam_state;
@@ -360,6 +391,14 @@ nwamui_object_class_init(NwamuiObjectClass *klass)
         _("conditions"),
         G_PARAM_READWRITE));
 
+    g_object_class_install_property (gobject_class,
+      PROP_SWITCHING,
+      g_param_spec_boolean ("switching",
+        _("switching"),
+        _("An activation is in progress"),
+        FALSE,
+        G_PARAM_READABLE));
+
     g_object_class_install_property (gobject_class,
       PROP_NWAM_STATE,
       g_param_spec_uint ("nwam_state",
@@ -490,6 +529,9 @@ nwamui_object_get_property(GObject         *object,
     case PROP_NWAM_STATE:
         g_value_set_uint( value, (guint)prv->nwam_state );
         break;
+    case PROP_SWITCHING:
+        g_value_set_boolean(value, prv->activation != NULL);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
         break;
@@ -510,15 +552,40 @@ nwamui_object_constructor(GType type,
 	    construct_properties);
 	self = NWAMUI_OBJECT(object);
 
+    nwamui_alloc_stats_object_new();
+
 	return object;
 }
 
 static void
 nwamui_object_finalize(NwamuiObject *self)
 {
+    nwamui_alloc_stats_object_finalized();
+
 	G_OBJECT_CLASS(nwamui_object_parent_class)->finalize(G_OBJECT (self));
 }
 
+/* Properties changed while notifications were frozen, e.g. by a multi
+ * property g_object_set(), arrive here together and are published to the
+ * dispatcher as a single change mask.
+ */
+static void
+nwamui_object_dispatch_properties_changed(GObject *object,
+  guint n_pspecs,
+  GParamSpec **pspecs)
+{
+    guint change_mask = 0;
+    guint i;
+
+    for (i = 0; i < n_pspecs; i++) {
+        change_mask |= nwamui_dispatch_mask_from_pspec(pspecs[i]);
+    }
+
+	G_OBJECT_CLASS(nwamui_object_parent_class)->dispatch_properties_changed(object, n_pspecs, pspecs);
+
+    nwamui_dispatch_publish(NWAMUI_OBJECT(object), change_mask);
+}
+
 extern gint
 nwamui_object_open(NwamuiObject *object, const gchar *name, gint flag)
 {
@@ -657,7 +724,212 @@ nwamui_object_set_active(NwamuiObject *object, gboolean active)
 {
     g_return_if_fail (NWAMUI_IS_OBJECT (object));
 
+    nwamui_alloc_stats_enter("nwamui_object_set_active");
     NWAMUI_OBJECT_GET_CLASS (object)->set_active(object, active);
+    nwamui_alloc_stats_leave("nwamui_object_set_active");
+}
+
+static void
+activation_free(activation_t *a)
+{
+    g_object_unref(a->object);
+    g_free(a->name);
+    g_free(a);
+}
+
+/* Detach the activation from its object and report the result. A failed
+ * or superseded activation re-notifies "active" so views drop their
+ * optimistic state.
+ */
+static void
+activation_complete(activation_t *a, nwamui_activation_result_t result)
+{
+    NwamuiObjectPrivate *prv = NWAMUI_OBJECT_GET_PRIVATE(a->object);
+
+    if (a->notify_id > 0) {
+        g_signal_handler_disconnect(a->object, a->notify_id);
+        a->notify_id = 0;
+    }
+    if (a->timeout_id > 0) {
+        g_source_remove(a->timeout_id);
+        a->timeout_id = 0;
+    }
+    if (prv->activation == a) {
+        prv->activation = NULL;
+    }
+
+    g_object_freeze_notify(G_OBJECT(a->object));
+    g_object_notify(G_OBJECT(a->object), "switching");
+    if (result != NWAMUI_ACTIVATION_DONE) {
+        g_object_notify(G_OBJECT(a->object), "active");
+    }
+    g_object_thaw_notify(G_OBJECT(a->object));
+
+    if (a->func) {
+        a->func(a->object, a->active, result, a->user_data);
+    }
+
+    /* Still referenced by the worker, freed when it reports back. */
+    if (a->worker_done) {
+        activation_free(a);
+    } else {
+        a->cancelled = TRUE;
+    }
+}
+
+static void
+activation_active_notify(GObject *gobject, GParamSpec *arg1, gpointer data)
+{
+    activation_t *a = (activation_t *)data;
+
+    if (nwamui_object_get_active(a->object) == a->active) {
+        activation_complete(a, NWAMUI_ACTIVATION_DONE);
+    }
+}
+
+static gboolean
+activation_timeout_cb(gpointer data)
+{
+    activation_t *a = (activation_t *)data;
+
+    g_warning("Timed out waiting for %s to become %s",
+      nwamui_object_get_name(a->object), a->active ? "active" : "inactive");
+
+    a->timeout_id = 0;
+    activation_complete(a, NWAMUI_ACTIVATION_FAILED);
+    return FALSE;
+}
+
+static gboolean
+activation_worker_done(gpointer data)
+{
+    activation_t *a = (activation_t *)data;
+
+    a->worker_done = TRUE;
+
+    if (a->cancelled) {
+        activation_free(a);
+    } else if (a->nerr != NWAM_SUCCESS) {
+        g_warning("Failed to %s %s due to error: %s",
+          a->active ? "enable" : "disable",
+          nwamui_object_get_name(a->object), nwam_strerror(a->nerr));
+        activation_complete(a, NWAMUI_ACTIVATION_FAILED);
+    } else if (nwamui_object_get_active(a->object) == a->active) {
+        /* The state event beat us here. */
+        activation_complete(a, NWAMUI_ACTIVATION_DONE);
+    } else {
+        /* Reconcile with the state events sent by the daemon. */
+        a->notify_id = g_signal_connect(a->object, "notify::active",
+          G_CALLBACK(activation_active_notify), (gpointer)a);
+        a->timeout_id = g_timeout_add_seconds(activation_timeout,
+          activation_timeout_cb, (gpointer)a);
+    }
+    return FALSE;
+}
+
+static void
+activation_worker(gpointer data, gpointer user_data)
+{
+    activation_t *a = (activation_t *)data;
+
+    /* Only the copies taken in the main loop, never the object. */
+    a->nerr = a->activate(a->name, a->active);
+
+    g_idle_add(activation_worker_done, (gpointer)a);
+}
+
+/* For classes without ->activate, set_active updates the object and its
+ * handles, which is only safe in the main loop.
+ */
+static gboolean
+activation_set_active_idle(gpointer data)
+{
+    activation_t *a = (activation_t *)data;
+
+    if (!a->cancelled) {
+        NWAMUI_OBJECT_GET_CLASS(a->object)->set_active(a->object, a->active);
+    }
+    return activation_worker_done(data);
+}
+
+/**
+ * nwamui_object_set_active_async:
+ * @func: called when the daemon has confirmed the new state, or on failure,
+ * may be NULL.
+ *
+ * Like nwamui_object_set_active() but returns immediately, the libnwam call
+ * runs on a worker thread, or from an idle for classes without ->activate.
+ * Until the daemon reports the requested state the object is "switching",
+ * views may show the target state optimistically. If the call fails or the
+ * state doesn't change within activation_timeout seconds, "active" is
+ * notified again so views roll back.
+ */
+extern void
+nwamui_object_set_active_async(NwamuiObject *object, gboolean active, NwamuiObjectActivateFunc func, gpointer user_data)
+{
+    NwamuiObjectPrivate *prv;
+    activation_t        *a;
+
+    g_return_if_fail (NWAMUI_IS_OBJECT (object));
+
+    prv = NWAMUI_OBJECT_GET_PRIVATE(object);
+
+    /* A newer request supersedes the pending one. */
+    if (prv->activation) {
+        activation_complete(prv->activation, NWAMUI_ACTIVATION_SUPERSEDED);
+    }
+
+    if (nwamui_object_get_active(object) == active) {
+        if (func) {
+            func(object, active, NWAMUI_ACTIVATION_DONE, user_data);
+        }
+        return;
+    }
+
+    a = g_new0(activation_t, 1);
+    a->object = g_object_ref(object);
+    a->active = active;
+    a->func = func;
+    a->user_data = user_data;
+    a->nerr = NWAM_SUCCESS;
+    a->activate = NWAMUI_OBJECT_GET_CLASS(object)->activate;
+
+    prv->activation = a;
+    g_object_notify(G_OBJECT(object), "switching");
+
+    if (a->activate == NULL) {
+        g_idle_add(activation_set_active_idle, (gpointer)a);
+        return;
+    }
+    a->name = g_strdup(nwamui_object_get_name(object));
+
+    G_LOCK(activation_pool);
+    if (activation_pool == NULL) {
+        activation_pool = g_thread_pool_new(activation_worker, NULL, 1, FALSE, NULL);
+    }
+    G_UNLOCK(activation_pool);
+
+    g_thread_pool_push(activation_pool, (gpointer)a, NULL);
+}
+
+/**
+ * nwamui_object_is_switching:
+ * @active: if not NULL, set to the requested state.
+ *
+ * Returns: TRUE if an asynchronous activation is pending.
+ */
+extern gboolean
+nwamui_object_is_switching(NwamuiObject *object, gboolean *active)
+{
+    NwamuiObjectPrivate *prv;
+
+    g_return_val_if_fail (NWAMUI_IS_OBJECT (object), FALSE);
+
+    prv = NWAMUI_OBJECT_GET_PRIVATE(object);
+    if (prv->activation && active) {
+        *active = prv->activation->active;
+    }
+    return prv->activation != NULL;
 }
 
 extern gboolean
@@ -697,11 +969,17 @@ nwamui_object_sort_by_name(NwamuiObject *object, NwamuiObject *other)
 extern gboolean
 nwamui_object_validate(NwamuiObject *object, gchar **prop_name_ret)
 {
+    gboolean rval;
+
     g_return_val_if_fail (NWAMUI_IS_OBJECT (object), FALSE);
 
     g_debug("Validate %s '%s(0x%p)'", g_type_name(G_TYPE_FROM_INSTANCE(object)), nwamui_object_get_name(object), object);
 
-    return NWAMUI_OBJECT_GET_CLASS (object)->validate(object, prop_name_ret);
+    nwamui_alloc_stats_enter("nwamui_object_validate");
+    rval = NWAMUI_OBJECT_GET_CLASS (object)->validate(object, prop_name_ret);
+    nwamui_alloc_stats_leave("nwamui_object_validate");
+
+    return rval;
 }
 
 /**
@@ -717,11 +995,17 @@ nwamui_object_validate(NwamuiObject *object, gchar **prop_name_ret)
 extern gboolean
 nwamui_object_commit(NwamuiObject *object)
 {
+    gboolean rval;
+
     g_return_val_if_fail (NWAMUI_IS_OBJECT (object), FALSE);
 
     g_debug("Commit %s '%s(0x%p)'", g_type_name(G_TYPE_FROM_INSTANCE(object)), nwamui_object_get_name(object), object);
 
-    return NWAMUI_OBJECT_GET_CLASS (object)->commit(object);
+    nwamui_alloc_stats_enter("nwamui_object_commit");
+    rval = NWAMUI_OBJECT_GET_CLASS (object)->commit(object);
+    nwamui_alloc_stats_leave("nwamui_object_commit");
+
+    return rval;
 }
 
 /**
@@ -737,9 +1021,15 @@ nwamui_object_commit(NwamuiObject *object)
 extern gboolean
 nwamui_object_destroy(NwamuiObject *object)
 {
+    gboolean rval;
+
     g_return_val_if_fail (NWAMUI_IS_OBJECT (object), FALSE);
 
-    return NWAMUI_OBJECT_GET_CLASS (object)->destroy(object);
+    nwamui_alloc_stats_enter("nwamui_object_destroy");
+    rval = NWAMUI_OBJECT_GET_CLASS (object)->destroy(object);
+    nwamui_alloc_stats_leave("nwamui_object_destroy");
+
+    return rval;
 }
 
 extern void
@@ -747,7 +1037,9 @@ nwamui_object_reload(NwamuiObject *object)
 {
     g_return_if_fail (NWAMUI_IS_OBJECT (object));
 
+    nwamui_alloc_stats_enter("nwamui_object_reload");
     NWAMUI_OBJECT_GET_CLASS (object)->reload(object);
+    nwamui_alloc_stats_leave("nwamui_object_reload");
 }
 
 extern nwam_state_t         
@@ -842,9 +1134,15 @@ nwamui_object_has_modifications(NwamuiObject *object)
 extern NwamuiObject*
 nwamui_object_clone(NwamuiObject *object, const gchar *name, NwamuiObject *parent)
 {
+    NwamuiObject *clone;
+
     g_return_val_if_fail (NWAMUI_IS_OBJECT(object), NULL);
 
-    return NWAMUI_OBJECT_GET_CLASS (object)->clone(object, name, parent);
+    nwamui_alloc_stats_enter("nwamui_object_clone");
+    clone = NWAMUI_OBJECT_GET_CLASS (object)->clone(object, name, parent);
+    nwamui_alloc_stats_leave("nwamui_object_clone");
+
+    return clone;
 }
 
 /* Signals */
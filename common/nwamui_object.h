@@ -72,6 +72,11 @@ struct _NwamuiObjectClass
     void (*set_activation_mode)(NwamuiObject *object, gint activation_mode);
     gboolean (*get_active)(NwamuiObject *object);
     void (*set_active)(NwamuiObject *object, gboolean active);
+    /* Blocking enable/disable of the object called @name, returns a
+     * nwam_error_t. Run on a worker thread by nwamui_object_set_active_async(),
+     * so it must only touch libnwam, through its own handle, and not the
+     * object. If NULL, set_active is called in the main loop. */
+    gint (*activate)(const gchar *name, gboolean active);
     gboolean (*get_enabled)(NwamuiObject *object);
     void (*set_enabled)(NwamuiObject *object, gboolean enabled);
     nwam_state_t (*get_nwam_state)(NwamuiObject *object, nwam_aux_state_t* aux_state, const gchar**aux_state_string);
@@ -104,6 +109,19 @@ enum {
     NWAMUI_OBJECT_SORT_BY_GROUP,
 };
 
+typedef enum {
+    NWAMUI_ACTIVATION_DONE = 0,     /* Confirmed by the daemon */
+    NWAMUI_ACTIVATION_FAILED,       /* Failed or timed out */
+    NWAMUI_ACTIVATION_SUPERSEDED    /* Replaced by a newer request */
+} nwamui_activation_result_t;
+
+/*
+ * Called in the main loop once an asynchronous activation is confirmed by
+ * the daemon, or failed, timed out or was superseded by another request for
+ * the same object.
+ */
+typedef void (*NwamuiObjectActivateFunc)(NwamuiObject *object, gboolean active, nwamui_activation_result_t result, gpointer user_data);
+
 extern GType               nwamui_object_get_type (void) G_GNUC_CONST;
 
 extern gint          nwamui_object_open(NwamuiObject *object, const gchar *name, gint flag);
@@ -116,6 +134,8 @@ extern gint          nwamui_object_get_activation_mode(NwamuiObject *object);
 extern void          nwamui_object_set_activation_mode(NwamuiObject *object, gint activation_mode);
 extern gboolean      nwamui_object_get_active(NwamuiObject *object);
 extern void          nwamui_object_set_active(NwamuiObject *object, gboolean active);
+extern void          nwamui_object_set_active_async(NwamuiObject *object, gboolean active, NwamuiObjectActivateFunc func, gpointer user_data);
+extern gboolean      nwamui_object_is_switching(NwamuiObject *object, gboolean *active);
 extern gboolean      nwamui_object_get_enabled(NwamuiObject *object);
 extern void          nwamui_object_set_enabled(NwamuiObject *object, gboolean enabled);
 extern nwam_state_t  nwamui_object_get_nwam_state(NwamuiObject *object, nwam_aux_state_t* aux_state, const gchar**aux_state_string);
@@ -0,0 +1,454 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_object_list_model.c
+ *
+ */
+
+#include <gtk/gtk.h>
+#include <glib/gi18n.h>
+
+#include "libnwamui.h"
+
+struct _NwamuiObjectListModelPrivate {
+    NwamuiObject   *container;
+    GType           child_type;
+    GSequence      *items;      /* Ref'd NwamuiObjects, sorted by name */
+    GHashTable     *index;      /* NwamuiObject -> GSequenceIter */
+    gint            stamp;
+    gulong          add_id;
+    gulong          remove_id;
+};
+
+#define NWAMUI_OBJECT_LIST_MODEL_GET_PRIVATE(o) (G_TYPE_INSTANCE_GET_PRIVATE((o), NWAMUI_TYPE_OBJECT_LIST_MODEL, NwamuiObjectListModelPrivate))
+
+#define ITER_IS_VALID(prv, iter)    ((iter) != NULL && (iter)->stamp == (prv)->stamp && \
+                                     (iter)->user_data != NULL && \
+                                     !g_sequence_iter_is_end((GSequenceIter*)(iter)->user_data))
+
+static void nwamui_object_list_model_tree_model_init (GtkTreeModelIface *iface);
+static void nwamui_object_list_model_finalize (NwamuiObjectListModel *self);
+
+static void container_add (NwamuiObject *container, NwamuiObject *child, gpointer user_data);
+static void container_remove (NwamuiObject *container, NwamuiObject *child, gpointer user_data);
+static void object_changed (NwamuiObject *object, guint change_mask, gpointer user_data);
+
+G_DEFINE_TYPE_WITH_CODE (NwamuiObjectListModel, nwamui_object_list_model, G_TYPE_OBJECT,
+  G_IMPLEMENT_INTERFACE (GTK_TYPE_TREE_MODEL, nwamui_object_list_model_tree_model_init))
+
+static void
+nwamui_object_list_model_class_init (NwamuiObjectListModelClass *klass)
+{
+    GObjectClass *gobject_class = (GObjectClass*) klass;
+
+    gobject_class->finalize = (void (*)(GObject*)) nwamui_object_list_model_finalize;
+
+	g_type_class_add_private(klass, sizeof(NwamuiObjectListModelPrivate));
+}
+
+static void
+nwamui_object_list_model_init (NwamuiObjectListModel *self)
+{
+    NwamuiObjectListModelPrivate *prv = NWAMUI_OBJECT_LIST_MODEL_GET_PRIVATE(self);
+
+    self->prv = prv;
+    prv->items = g_sequence_new(NULL);
+    prv->index = g_hash_table_new(g_direct_hash, g_direct_equal);
+    prv->stamp = g_random_int();
+}
+
+static void
+nwamui_object_list_model_finalize (NwamuiObjectListModel *self)
+{
+    NwamuiObjectListModelPrivate *prv = NWAMUI_OBJECT_LIST_MODEL_GET_PRIVATE(self);
+    GSequenceIter                *i;
+
+    if (prv->container) {
+        g_signal_handler_disconnect(prv->container, prv->add_id);
+        g_signal_handler_disconnect(prv->container, prv->remove_id);
+        g_object_unref(prv->container);
+    }
+
+    for (i = g_sequence_get_begin_iter(prv->items);
+         !g_sequence_iter_is_end(i);
+         i = g_sequence_iter_next(i)) {
+        NwamuiObject *object = g_sequence_get(i);
+
+        nwamui_dispatch_unsubscribe_by_data(object, self);
+        g_object_unref(object);
+    }
+    g_sequence_free(prv->items);
+    g_hash_table_destroy(prv->index);
+
+	G_OBJECT_CLASS(nwamui_object_list_model_parent_class)->finalize(G_OBJECT(self));
+}
+
+static gint
+compare_objects(gconstpointer a, gconstpointer b, gpointer user_data)
+{
+    return nwamui_object_sort_by_name(NWAMUI_OBJECT(a), NWAMUI_OBJECT(b));
+}
+
+static void
+model_fill_iter(NwamuiObjectListModel *self, GSequenceIter *i, GtkTreeIter *iter)
+{
+    iter->stamp = self->prv->stamp;
+    iter->user_data = i;
+    iter->user_data2 = NULL;
+    iter->user_data3 = NULL;
+}
+
+static void
+model_insert(NwamuiObjectListModel *self, NwamuiObject *object, gboolean emit)
+{
+    NwamuiObjectListModelPrivate *prv = self->prv;
+    GSequenceIter                *i;
+
+    if (!G_TYPE_CHECK_INSTANCE_TYPE(object, prv->child_type) ||
+      g_hash_table_lookup(prv->index, object) != NULL) {
+        return;
+    }
+
+    i = g_sequence_insert_sorted(prv->items, g_object_ref(object), compare_objects, NULL);
+    g_hash_table_insert(prv->index, object, i);
+    nwamui_dispatch_subscribe(object, NWAMUI_CHANGE_ALL, object_changed, self);
+
+    if (emit) {
+        GtkTreeIter  iter;
+        GtkTreePath *path;
+
+        model_fill_iter(self, i, &iter);
+        path = gtk_tree_path_new_from_indices(g_sequence_iter_get_position(i), -1);
+        gtk_tree_model_row_inserted(GTK_TREE_MODEL(self), path, &iter);
+        gtk_tree_path_free(path);
+    }
+}
+
+static void
+model_foreach_insert(gpointer data, gpointer user_data)
+{
+    model_insert(NWAMUI_OBJECT_LIST_MODEL(user_data), NWAMUI_OBJECT(data), FALSE);
+}
+
+/**
+ * nwamui_object_list_model_new:
+ * @container: a #NwamuiDaemon or #NwamuiNcp.
+ * @child_type: the type of children to show, e.g. NWAMUI_TYPE_ENV.
+ *
+ * Returns: a new #GtkTreeModel, unref when done.
+ **/
+extern GtkTreeModel*
+nwamui_object_list_model_new(NwamuiObject *container, GType child_type)
+{
+    NwamuiObjectListModel        *self;
+    NwamuiObjectListModelPrivate *prv;
+
+    g_return_val_if_fail(NWAMUI_IS_DAEMON(container) || NWAMUI_IS_NCP(container), NULL);
+
+    nwamui_alloc_stats_enter("nwamui_object_list_model_new");
+    self = NWAMUI_OBJECT_LIST_MODEL(g_object_new(NWAMUI_TYPE_OBJECT_LIST_MODEL, NULL));
+    prv = self->prv;
+    prv->container = g_object_ref(container);
+    prv->child_type = child_type;
+
+    if (NWAMUI_IS_NCP(container)) {
+        nwamui_ncp_foreach_ncu(NWAMUI_NCP(container), model_foreach_insert, self);
+    } else if (g_type_is_a(child_type, NWAMUI_TYPE_NCP)) {
+        nwamui_daemon_foreach_ncp(NWAMUI_DAEMON(container), model_foreach_insert, self);
+    } else if (g_type_is_a(child_type, NWAMUI_TYPE_ENV)) {
+        nwamui_daemon_foreach_loc(NWAMUI_DAEMON(container), model_foreach_insert, self);
+    } else if (g_type_is_a(child_type, NWAMUI_TYPE_ENM)) {
+        nwamui_daemon_foreach_enm(NWAMUI_DAEMON(container), model_foreach_insert, self);
+    } else if (g_type_is_a(child_type, NWAMUI_TYPE_KNOWN_WLAN)) {
+        nwamui_daemon_foreach_fav_wifi(NWAMUI_DAEMON(container), model_foreach_insert, self);
+    } else {
+        g_warning("Unsupported object list model type %s", g_type_name(child_type));
+    }
+
+    prv->add_id = g_signal_connect(container, "add", G_CALLBACK(container_add), self);
+    prv->remove_id = g_signal_connect(container, "remove", G_CALLBACK(container_remove), self);
+    nwamui_alloc_stats_leave("nwamui_object_list_model_new");
+
+    return GTK_TREE_MODEL(self);
+}
+
+/**
+ * nwamui_object_list_model_get_iter:
+ *
+ * Find the row of @object, without searching.
+ **/
+extern gboolean
+nwamui_object_list_model_get_iter(NwamuiObjectListModel *self, NwamuiObject *object, GtkTreeIter *iter)
+{
+    GSequenceIter *i;
+
+    g_return_val_if_fail(NWAMUI_IS_OBJECT_LIST_MODEL(self), FALSE);
+
+    if ((i = g_hash_table_lookup(self->prv->index, object)) == NULL) {
+        return FALSE;
+    }
+    if (iter) {
+        model_fill_iter(self, i, iter);
+    }
+    return TRUE;
+}
+
+/**
+ * nwamui_object_list_model_get_object:
+ *
+ * Returns: the object in row @iter, not ref'd.
+ **/
+extern NwamuiObject*
+nwamui_object_list_model_get_object(NwamuiObjectListModel *self, GtkTreeIter *iter)
+{
+    g_return_val_if_fail(NWAMUI_IS_OBJECT_LIST_MODEL(self), NULL);
+    g_return_val_if_fail(ITER_IS_VALID(self->prv, iter), NULL);
+
+    return NWAMUI_OBJECT(g_sequence_get((GSequenceIter*)iter->user_data));
+}
+
+/* The name of the object at @i changed, move it to its sorted position and
+ * tell views about the new order. Iters stay valid, only positions between
+ * the old and new place shift by one.
+ */
+static void
+model_resort(NwamuiObjectListModel *self, GSequenceIter *i)
+{
+    gint         old_pos = g_sequence_iter_get_position(i);
+    gint         new_pos;
+    gint         length;
+    gint         n;
+    gint        *new_order;
+    GtkTreePath *path;
+
+    g_sequence_sort_changed(i, compare_objects, NULL);
+
+    if ((new_pos = g_sequence_iter_get_position(i)) == old_pos) {
+        return;
+    }
+
+    /* new_order[new position] = old position */
+    length = g_sequence_get_length(self->prv->items);
+    new_order = g_new(gint, length);
+    for (n = 0; n < length; n++) {
+        if (n == new_pos) {
+            new_order[n] = old_pos;
+        } else if (old_pos < new_pos && n >= old_pos && n < new_pos) {
+            new_order[n] = n + 1;
+        } else if (new_pos < old_pos && n > new_pos && n <= old_pos) {
+            new_order[n] = n - 1;
+        } else {
+            new_order[n] = n;
+        }
+    }
+
+    path = gtk_tree_path_new();
+    gtk_tree_model_rows_reordered(GTK_TREE_MODEL(self), path, NULL, new_order);
+    gtk_tree_path_free(path);
+    g_free(new_order);
+}
+
+/* Callbacks */
+
+static void
+container_add(NwamuiObject *container, NwamuiObject *child, gpointer user_data)
+{
+    model_insert(NWAMUI_OBJECT_LIST_MODEL(user_data), child, TRUE);
+}
+
+static void
+container_remove(NwamuiObject *container, NwamuiObject *child, gpointer user_data)
+{
+    NwamuiObjectListModel        *self = NWAMUI_OBJECT_LIST_MODEL(user_data);
+    NwamuiObjectListModelPrivate *prv = self->prv;
+    GSequenceIter                *i;
+    GtkTreePath                  *path;
+
+    if ((i = g_hash_table_lookup(prv->index, child)) == NULL) {
+        return;
+    }
+
+    path = gtk_tree_path_new_from_indices(g_sequence_iter_get_position(i), -1);
+    g_hash_table_remove(prv->index, child);
+    g_sequence_remove(i);
+    nwamui_dispatch_unsubscribe_by_data(child, self);
+
+    gtk_tree_model_row_deleted(GTK_TREE_MODEL(self), path);
+    gtk_tree_path_free(path);
+
+    g_object_unref(child);
+}
+
+static void
+object_changed(NwamuiObject *object, guint change_mask, gpointer user_data)
+{
+    NwamuiObjectListModel *self = NWAMUI_OBJECT_LIST_MODEL(user_data);
+    GtkTreeIter            iter;
+
+    if (nwamui_object_list_model_get_iter(self, object, &iter)) {
+        GSequenceIter *i = (GSequenceIter*)iter.user_data;
+        GtkTreePath   *path;
+
+        if (change_mask & NWAMUI_CHANGE_NAME) {
+            model_resort(self, i);
+        }
+
+        path = gtk_tree_path_new_from_indices(g_sequence_iter_get_position(i), -1);
+        gtk_tree_model_row_changed(GTK_TREE_MODEL(self), path, &iter);
+        gtk_tree_path_free(path);
+    }
+}
+
+/* GtkTreeModel */
+
+static GtkTreeModelFlags
+tree_model_get_flags(GtkTreeModel *model)
+{
+    return GTK_TREE_MODEL_ITERS_PERSIST | GTK_TREE_MODEL_LIST_ONLY;
+}
+
+static gint
+tree_model_get_n_columns(GtkTreeModel *model)
+{
+    return 1;
+}
+
+static GType
+tree_model_get_column_type(GtkTreeModel *model, gint index)
+{
+    g_return_val_if_fail(index == 0, G_TYPE_INVALID);
+
+    return NWAMUI_OBJECT_LIST_MODEL(model)->prv->child_type;
+}
+
+static gboolean
+tree_model_iter_nth_child(GtkTreeModel *model, GtkTreeIter *iter, GtkTreeIter *parent, gint n)
+{
+    NwamuiObjectListModel *self = NWAMUI_OBJECT_LIST_MODEL(model);
+    GSequenceIter         *i;
+
+    if (parent != NULL || n < 0) {
+        return FALSE;
+    }
+    i = g_sequence_get_iter_at_pos(self->prv->items, n);
+    if (g_sequence_iter_is_end(i)) {
+        return FALSE;
+    }
+    model_fill_iter(self, i, iter);
+    return TRUE;
+}
+
+static gboolean
+tree_model_get_iter(GtkTreeModel *model, GtkTreeIter *iter, GtkTreePath *path)
+{
+    if (gtk_tree_path_get_depth(path) != 1) {
+        return FALSE;
+    }
+    return tree_model_iter_nth_child(model, iter, NULL, gtk_tree_path_get_indices(path)[0]);
+}
+
+static GtkTreePath*
+tree_model_get_path(GtkTreeModel *model, GtkTreeIter *iter)
+{
+    NwamuiObjectListModel *self = NWAMUI_OBJECT_LIST_MODEL(model);
+
+    g_return_val_if_fail(ITER_IS_VALID(self->prv, iter), NULL);
+
+    return gtk_tree_path_new_from_indices(
+      g_sequence_iter_get_position((GSequenceIter*)iter->user_data), -1);
+}
+
+static void
+tree_model_get_value(GtkTreeModel *model, GtkTreeIter *iter, gint column, GValue *value)
+{
+    NwamuiObjectListModel *self = NWAMUI_OBJECT_LIST_MODEL(model);
+
+    g_return_if_fail(column == 0);
+    g_return_if_fail(ITER_IS_VALID(self->prv, iter));
+
+    g_value_init(value, self->prv->child_type);
+    g_value_set_object(value, g_sequence_get((GSequenceIter*)iter->user_data));
+}
+
+static gboolean
+tree_model_iter_next(GtkTreeModel *model, GtkTreeIter *iter)
+{
+    NwamuiObjectListModel *self = NWAMUI_OBJECT_LIST_MODEL(model);
+    GSequenceIter         *i;
+
+    g_return_val_if_fail(ITER_IS_VALID(self->prv, iter), FALSE);
+
+    i = g_sequence_iter_next((GSequenceIter*)iter->user_data);
+    if (g_sequence_iter_is_end(i)) {
+        iter->stamp = 0;
+        return FALSE;
+    }
+    iter->user_data = i;
+    return TRUE;
+}
+
+static gboolean
+tree_model_iter_children(GtkTreeModel *model, GtkTreeIter *iter, GtkTreeIter *parent)
+{
+    return tree_model_iter_nth_child(model, iter, parent, 0);
+}
+
+static gboolean
+tree_model_iter_has_child(GtkTreeModel *model, GtkTreeIter *iter)
+{
+    return FALSE;
+}
+
+static gint
+tree_model_iter_n_children(GtkTreeModel *model, GtkTreeIter *iter)
+{
+    if (iter != NULL) {
+        return 0;
+    }
+    return g_sequence_get_length(NWAMUI_OBJECT_LIST_MODEL(model)->prv->items);
+}
+
+static gboolean
+tree_model_iter_parent(GtkTreeModel *model, GtkTreeIter *iter, GtkTreeIter *child)
+{
+    return FALSE;
+}
+
+static void
+nwamui_object_list_model_tree_model_init(GtkTreeModelIface *iface)
+{
+    iface->get_flags = tree_model_get_flags;
+    iface->get_n_columns = tree_model_get_n_columns;
+    iface->get_column_type = tree_model_get_column_type;
+    iface->get_iter = tree_model_get_iter;
+    iface->get_path = tree_model_get_path;
+    iface->get_value = tree_model_get_value;
+    iface->iter_next = tree_model_iter_next;
+    iface->iter_children = tree_model_iter_children;
+    iface->iter_has_child = tree_model_iter_has_child;
+    iface->iter_n_children = tree_model_iter_n_children;
+    iface->iter_nth_child = tree_model_iter_nth_child;
+    iface->iter_parent = tree_model_iter_parent;
+}
@@ -0,0 +1,81 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_object_list_model.h
+ *
+ */
+
+#ifndef _NWAMUI_OBJECT_LIST_MODEL_H
+#define	_NWAMUI_OBJECT_LIST_MODEL_H
+
+#ifndef _libnwamui_H
+#error "Please include libnwamui.h header instead."
+#endif
+
+G_BEGIN_DECLS
+
+/*
+ * A flat GtkTreeModel showing the children of a given type of an
+ * NwamuiDaemon (NCPs, locations, ENMs, favourite wlans) or NwamuiNcp (NCUs).
+ * It follows the container's "add" and "remove" signals and emits
+ * row-changed for objects that changed, so views need neither a copy of the
+ * objects nor a notify handler of their own. Column 0 holds the object, the
+ * same as the list stores used throughout the capplet.
+ */
+#define NWAMUI_TYPE_OBJECT_LIST_MODEL               (nwamui_object_list_model_get_type ())
+#define NWAMUI_OBJECT_LIST_MODEL(obj)               (G_TYPE_CHECK_INSTANCE_CAST ((obj), NWAMUI_TYPE_OBJECT_LIST_MODEL, NwamuiObjectListModel))
+#define NWAMUI_OBJECT_LIST_MODEL_CLASS(klass)       (G_TYPE_CHECK_CLASS_CAST ((klass), NWAMUI_TYPE_OBJECT_LIST_MODEL, NwamuiObjectListModelClass))
+#define NWAMUI_IS_OBJECT_LIST_MODEL(obj)            (G_TYPE_CHECK_INSTANCE_TYPE ((obj), NWAMUI_TYPE_OBJECT_LIST_MODEL))
+#define NWAMUI_IS_OBJECT_LIST_MODEL_CLASS(klass)    (G_TYPE_CHECK_CLASS_TYPE ((klass), NWAMUI_TYPE_OBJECT_LIST_MODEL))
+#define NWAMUI_OBJECT_LIST_MODEL_GET_CLASS(obj)     (G_TYPE_INSTANCE_GET_CLASS ((obj), NWAMUI_TYPE_OBJECT_LIST_MODEL, NwamuiObjectListModelClass))
+
+typedef struct _NwamuiObjectListModel           NwamuiObjectListModel;
+typedef struct _NwamuiObjectListModelClass      NwamuiObjectListModelClass;
+typedef struct _NwamuiObjectListModelPrivate    NwamuiObjectListModelPrivate;
+
+struct _NwamuiObjectListModel
+{
+	GObject                         object;
+
+	/*< private >*/
+	NwamuiObjectListModelPrivate   *prv;
+};
+
+struct _NwamuiObjectListModelClass
+{
+	GObjectClass                    parent_class;
+};
+
+extern  GType                   nwamui_object_list_model_get_type (void) G_GNUC_CONST;
+
+extern  GtkTreeModel*           nwamui_object_list_model_new (NwamuiObject *container, GType child_type);
+
+extern  gboolean                nwamui_object_list_model_get_iter (NwamuiObjectListModel *self, NwamuiObject *object, GtkTreeIter *iter);
+
+extern  NwamuiObject*           nwamui_object_list_model_get_object (NwamuiObjectListModel *self, GtkTreeIter *iter);
+
+G_END_DECLS
+
+#endif	/* _NWAMUI_OBJECT_LIST_MODEL_H */
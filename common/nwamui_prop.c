@@ -0,0 +1,777 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_prop.c
+ *
+ */
+
+#include <libnwam.h>
+#include <glib-object.h>
+#include <glib/gi18n.h>
+#include <string.h>
+#include <strings.h>
+
+#include "libnwamui.h"
+
+typedef struct {
+    nwam_value_type_t   type;
+    gboolean            read_only;
+} prop_info_t;
+
+typedef struct {
+    const gchar    *name;   /* Used in messages */
+    nwam_error_t  (*get_prop_type)(const char *, nwam_value_type_t *);
+    nwam_error_t  (*prop_read_only)(const char *, boolean_t *);
+    nwam_error_t  (*get_prop_value)(gpointer, const char *, nwam_value_t *);
+    nwam_error_t  (*set_prop_value)(gpointer, const char *, nwam_value_t);
+    nwam_error_t  (*delete_prop)(gpointer, const char *);
+    gboolean        delete_empty_string;
+    const gchar   **prop_names;
+} prop_class_t;
+
+static const gchar *ncu_prop_names[] = {
+    NWAM_NCU_PROP_ACTIVATION_MODE,
+    NWAM_NCU_PROP_ENABLED,
+    NWAM_NCU_PROP_PRIORITY_GROUP,
+    NWAM_NCU_PROP_PRIORITY_MODE,
+    NWAM_NCU_PROP_LINK_MAC_ADDR,
+    NWAM_NCU_PROP_LINK_AUTOPUSH,
+    NWAM_NCU_PROP_LINK_MTU,
+    NWAM_NCU_PROP_IP_VERSION,
+    NWAM_NCU_PROP_IPV4_ADDRSRC,
+    NWAM_NCU_PROP_IPV4_ADDR,
+    NWAM_NCU_PROP_IPV4_DEFAULT_ROUTE,
+    NWAM_NCU_PROP_IPV6_ADDRSRC,
+    NWAM_NCU_PROP_IPV6_ADDR,
+    NWAM_NCU_PROP_IPV6_DEFAULT_ROUTE,
+#ifdef TUNNEL_SUPPORT
+    NWAM_NCU_PROP_IPTUN_TYPE,
+    NWAM_NCU_PROP_IPTUN_TSRC,
+    NWAM_NCU_PROP_IPTUN_TDST,
+    NWAM_NCU_PROP_IPTUN_ENCR,
+    NWAM_NCU_PROP_IPTUN_ENCR_AUTH,
+    NWAM_NCU_PROP_IPTUN_AUTH,
+#endif /* TUNNEL_SUPPORT */
+    NULL
+};
+
+static const gchar *loc_prop_names[] = {
+    NWAM_LOC_PROP_ACTIVATION_MODE,
+    NWAM_LOC_PROP_CONDITIONS,
+    NWAM_LOC_PROP_ENABLED,
+    NWAM_LOC_PROP_NAMESERVICES,
+    NWAM_LOC_PROP_NAMESERVICES_CONFIG_FILE,
+    NWAM_LOC_PROP_DNS_NAMESERVICE_CONFIGSRC,
+    NWAM_LOC_PROP_DNS_NAMESERVICE_DOMAIN,
+    NWAM_LOC_PROP_DNS_NAMESERVICE_SERVERS,
+    NWAM_LOC_PROP_DNS_NAMESERVICE_SEARCH,
+    NWAM_LOC_PROP_NIS_NAMESERVICE_CONFIGSRC,
+    NWAM_LOC_PROP_NIS_NAMESERVICE_SERVERS,
+    NWAM_LOC_PROP_LDAP_NAMESERVICE_CONFIGSRC,
+    NWAM_LOC_PROP_LDAP_NAMESERVICE_SERVERS,
+    NWAM_LOC_PROP_DEFAULT_DOMAIN,
+    NWAM_LOC_PROP_NFSV4_DOMAIN,
+    NWAM_LOC_PROP_IPFILTER_CONFIG_FILE,
+    NWAM_LOC_PROP_IPFILTER_V6_CONFIG_FILE,
+    NWAM_LOC_PROP_IPNAT_CONFIG_FILE,
+    NWAM_LOC_PROP_IPPOOL_CONFIG_FILE,
+    NWAM_LOC_PROP_IKE_CONFIG_FILE,
+    NWAM_LOC_PROP_IPSECPOLICY_CONFIG_FILE,
+    NWAM_LOC_PROP_SVCS_ENABLE,
+    NWAM_LOC_PROP_SVCS_DISABLE,
+    NWAM_LOC_PROP_HOSTS_FILE,
+    NWAM_LOC_PROP_READ_ONLY,
+    NULL
+};
+
+static const gchar *enm_prop_names[] = {
+    NWAM_ENM_PROP_ACTIVATION_MODE,
+    NWAM_ENM_PROP_CONDITIONS,
+    NWAM_ENM_PROP_ENABLED,
+    NWAM_ENM_PROP_FMRI,
+    NWAM_ENM_PROP_START,
+    NWAM_ENM_PROP_STOP,
+    NULL
+};
+
+static const gchar *known_wlan_prop_names[] = {
+    NWAM_KNOWN_WLAN_PROP_BSSIDS,
+    NWAM_KNOWN_WLAN_PROP_PRIORITY,
+    NWAM_KNOWN_WLAN_PROP_KEYSLOT,
+    NWAM_KNOWN_WLAN_PROP_SECURITY_MODE,
+    NULL
+};
+
+static const prop_class_t prop_classes[NWAMUI_PROP_CLASS_LAST] = {
+    { "ncu",
+      nwam_ncu_get_prop_type,
+      nwam_ncu_prop_read_only,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t *))nwam_ncu_get_prop_value,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t))nwam_ncu_set_prop_value,
+      (nwam_error_t (*)(gpointer, const char *))nwam_ncu_delete_prop,
+      FALSE,
+      ncu_prop_names },
+    { "loc",
+      nwam_loc_get_prop_type,
+      NULL,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t *))nwam_loc_get_prop_value,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t))nwam_loc_set_prop_value,
+      (nwam_error_t (*)(gpointer, const char *))nwam_loc_delete_prop,
+      TRUE,
+      loc_prop_names },
+    { "enm",
+      nwam_enm_get_prop_type,
+      NULL,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t *))nwam_enm_get_prop_value,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t))nwam_enm_set_prop_value,
+      (nwam_error_t (*)(gpointer, const char *))nwam_enm_delete_prop,
+      FALSE,
+      enm_prop_names },
+    { "known_wlan",
+      nwam_known_wlan_get_prop_type,
+      NULL,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t *))nwam_known_wlan_get_prop_value,
+      (nwam_error_t (*)(gpointer, const char *, nwam_value_t))nwam_known_wlan_set_prop_value,
+      (nwam_error_t (*)(gpointer, const char *))nwam_known_wlan_delete_prop,
+      FALSE,
+      known_wlan_prop_names }
+};
+
+/* Property name -> prop_info_t, one table per class. Protected by the lock
+ * since NCUs may be read from worker threads.
+ */
+static GHashTable *prop_info_tables[NWAMUI_PROP_CLASS_LAST] = { NULL };
+G_LOCK_DEFINE_STATIC(prop_info_tables);
+
+static prop_info_t*
+prop_info_new(nwamui_prop_class_t klass, const char* prop_name)
+{
+    const prop_class_t *pc   = &prop_classes[klass];
+    prop_info_t        *info = g_new0(prop_info_t, 1);
+    nwam_error_t        nerr;
+    boolean_t           read_only = B_FALSE;
+
+    if ((nerr = pc->get_prop_type(prop_name, &info->type)) != NWAM_SUCCESS) {
+        g_warning("Unexpected error for %s property %s - %s\n", pc->name, prop_name, nwam_strerror(nerr));
+        g_free(info);
+        return NULL;
+    }
+
+    if (pc->prop_read_only) {
+        if ((nerr = pc->prop_read_only(prop_name, &read_only)) != NWAM_SUCCESS) {
+            g_warning("Unable to get read-only status for %s property %s: %s", pc->name, prop_name, nwam_strerror(nerr));
+        }
+        info->read_only = (read_only == B_TRUE);
+    }
+
+    return info;
+}
+
+static void
+prop_info_tables_init(void)
+{
+    nwamui_prop_class_t klass;
+    const gchar       **name;
+
+    for (klass = 0; klass < NWAMUI_PROP_CLASS_LAST; klass++) {
+        prop_info_tables[klass] = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+        for (name = prop_classes[klass].prop_names; *name != NULL; name++) {
+            prop_info_t *info = prop_info_new(klass, *name);
+
+            if (info) {
+                g_hash_table_insert(prop_info_tables[klass], g_strdup(*name), info);
+            }
+        }
+    }
+}
+
+static gboolean
+prop_info_lookup(nwamui_prop_class_t klass, const char* prop_name, prop_info_t *info_ret)
+{
+    prop_info_t *info;
+
+    G_LOCK(prop_info_tables);
+
+    if (prop_info_tables[0] == NULL) {
+        prop_info_tables_init();
+    }
+
+    /* Names not in the static tables are looked up and remembered. */
+    if ((info = g_hash_table_lookup(prop_info_tables[klass], prop_name)) == NULL) {
+        if ((info = prop_info_new(klass, prop_name)) != NULL) {
+            g_hash_table_insert(prop_info_tables[klass], g_strdup(prop_name), info);
+        }
+    }
+    if (info) {
+        *info_ret = *info;
+    }
+
+    G_UNLOCK(prop_info_tables);
+
+    return info != NULL;
+}
+
+/**
+ * nwamui_prop_get_type:
+ * @type: returns the value type of the property.
+ * @read_only: returns if the property is read-only, may be NULL.
+ * @returns: FALSE if the property isn't known to libnwam.
+ *
+ **/
+extern gboolean
+nwamui_prop_get_type(nwamui_prop_class_t klass, const char* prop_name, nwam_value_type_t *type, gboolean *read_only)
+{
+    prop_info_t info;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (!prop_info_lookup(klass, prop_name, &info)) {
+        return FALSE;
+    }
+    if (type) {
+        *type = info.type;
+    }
+    if (read_only) {
+        *read_only = info.read_only;
+    }
+    return TRUE;
+}
+
+static gboolean
+check_prop_type(nwamui_prop_class_t klass, const char* prop_name, nwam_value_type_t expected, gboolean for_write)
+{
+    prop_info_t info;
+
+    if (!prop_info_lookup(klass, prop_name, &info)) {
+        return FALSE;
+    }
+
+    if (info.type != expected) {
+        g_warning("Unexpected type for %s property %s - got %d\n", prop_classes[klass].name, prop_name, info.type);
+        return FALSE;
+    }
+
+    if (for_write && info.read_only) {
+        g_warning("Attempting to set a read-only %s property %s", prop_classes[klass].name, prop_name);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static gboolean
+get_prop_value(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, nwam_value_type_t expected, nwam_value_t *nwam_data)
+{
+    nwam_error_t nerr;
+
+    if (handle == NULL || !check_prop_type(klass, prop_name, expected, FALSE)) {
+        return FALSE;
+    }
+
+    if ((nerr = prop_classes[klass].get_prop_value(handle, prop_name, nwam_data)) != NWAM_SUCCESS) {
+        g_debug("No value for %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* Takes ownership of nwam_data. */
+static gboolean
+set_prop_value(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, nwam_value_t nwam_data)
+{
+    nwam_error_t nerr;
+    gboolean     retval = FALSE;
+
+    if ((nerr = prop_classes[klass].set_prop_value(handle, prop_name, nwam_data)) != NWAM_SUCCESS) {
+        g_debug("Unable to set value for %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+    } else {
+        retval = TRUE;
+    }
+
+    nwam_value_free(nwam_data);
+
+    return retval;
+}
+
+extern gboolean
+nwamui_prop_delete(nwamui_prop_class_t klass, gpointer handle, const char* prop_name)
+{
+    nwam_error_t nerr;
+    gboolean     read_only = FALSE;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (handle == NULL) {
+        return FALSE;
+    }
+
+    if (nwamui_prop_get_type(klass, prop_name, NULL, &read_only) && read_only) {
+        g_warning("Attempting to delete a read-only %s property %s", prop_classes[klass].name, prop_name);
+        return FALSE;
+    }
+
+    if ((nerr = prop_classes[klass].delete_prop(handle, prop_name)) != NWAM_SUCCESS) {
+        g_debug("Unable to delete %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+extern gboolean
+nwamui_prop_get_boolean(nwamui_prop_class_t klass, gpointer handle, const char* prop_name)
+{
+    nwam_value_t nwam_data;
+    boolean_t    value = B_FALSE;
+    nwam_error_t nerr;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (!get_prop_value(klass, handle, prop_name, NWAM_VALUE_TYPE_BOOLEAN, &nwam_data)) {
+        return FALSE;
+    }
+
+    if ((nerr = nwam_value_get_boolean(nwam_data, &value)) != NWAM_SUCCESS) {
+        g_debug("Unable to get boolean value for %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+    }
+
+    nwam_value_free(nwam_data);
+
+    return (gboolean)value;
+}
+
+extern gboolean
+nwamui_prop_set_boolean(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, gboolean bool_value)
+{
+    nwam_value_t nwam_data;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (handle == NULL || !check_prop_type(klass, prop_name, NWAM_VALUE_TYPE_BOOLEAN, TRUE)) {
+        return FALSE;
+    }
+
+    if (nwam_value_create_boolean((boolean_t)bool_value, &nwam_data) != NWAM_SUCCESS) {
+        g_debug("Error creating a boolean value");
+        return FALSE;
+    }
+
+    return set_prop_value(klass, handle, prop_name, nwam_data);
+}
+
+extern gchar*
+nwamui_prop_get_string(nwamui_prop_class_t klass, gpointer handle, const char* prop_name)
+{
+    nwam_value_t nwam_data;
+    char        *value  = NULL;
+    gchar       *retval = NULL;
+    nwam_error_t nerr;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, NULL);
+
+    if (!get_prop_value(klass, handle, prop_name, NWAM_VALUE_TYPE_STRING, &nwam_data)) {
+        return NULL;
+    }
+
+    if ((nerr = nwam_value_get_string(nwam_data, &value)) != NWAM_SUCCESS) {
+        g_debug("Unable to get string value for %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+    } else if (value != NULL) {
+        retval = g_strdup(value);
+    }
+
+    nwam_value_free(nwam_data);
+
+    return retval;
+}
+
+/**
+ * nwamui_prop_set_string:
+ *
+ * A NULL str deletes the property, so does an empty one for locations.
+ **/
+extern gboolean
+nwamui_prop_set_string(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, const gchar* str)
+{
+    nwam_value_t nwam_data;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (handle == NULL || !check_prop_type(klass, prop_name, NWAM_VALUE_TYPE_STRING, TRUE)) {
+        return FALSE;
+    }
+
+    if (str == NULL || (*str == '\0' && prop_classes[klass].delete_empty_string)) {
+        return nwamui_prop_delete(klass, handle, prop_name);
+    }
+
+    if (nwam_value_create_string((char*)str, &nwam_data) != NWAM_SUCCESS) {
+        g_debug("Error creating a string value for string %s", str);
+        return FALSE;
+    }
+
+    return set_prop_value(klass, handle, prop_name, nwam_data);
+}
+
+/**
+ * nwamui_prop_get_string_array:
+ * @len: returns the number of strings, may be NULL.
+ * @returns: a NULL terminated array, free with g_strfreev().
+ **/
+extern gchar**
+nwamui_prop_get_string_array(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, guint *len)
+{
+    nwam_value_t nwam_data;
+    char       **value  = NULL;
+    uint_t       num    = 0;
+    gchar      **retval = NULL;
+    nwam_error_t nerr;
+    int          i;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, NULL);
+
+    if (len != NULL) {
+        *len = 0;
+    }
+
+    if (!get_prop_value(klass, handle, prop_name, NWAM_VALUE_TYPE_STRING, &nwam_data)) {
+        return NULL;
+    }
+
+    if ((nerr = nwam_value_get_string_array(nwam_data, &value, &num)) != NWAM_SUCCESS) {
+        g_debug("Unable to get string value for %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+        num = 0;
+    } else if (value != NULL && num > 0) {
+        retval = g_new0(gchar*, num + 1);
+        for (i = 0; i < num; i++) {
+            retval[i] = g_strdup(value[i]);
+        }
+    }
+
+    if (len != NULL) {
+        *len = num;
+    }
+
+    nwam_value_free(nwam_data);
+
+    return retval;
+}
+
+/**
+ * nwamui_prop_set_string_array:
+ * @len: number of strings, or 0 if strs is NULL terminated.
+ *
+ * A NULL strs deletes the property.
+ **/
+extern gboolean
+nwamui_prop_set_string_array(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, char** strs, guint len)
+{
+    nwam_value_t nwam_data;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (handle == NULL || !check_prop_type(klass, prop_name, NWAM_VALUE_TYPE_STRING, TRUE)) {
+        return FALSE;
+    }
+
+    if (strs == NULL) {
+        return nwamui_prop_delete(klass, handle, prop_name);
+    }
+
+    if (len == 0) {
+        len = g_strv_length(strs);
+    }
+
+    if (nwam_value_create_string_array(strs, len, &nwam_data) != NWAM_SUCCESS) {
+        g_debug("Error creating a value for string array 0x%p", strs);
+        return FALSE;
+    }
+
+    return set_prop_value(klass, handle, prop_name, nwam_data);
+}
+
+extern guint64
+nwamui_prop_get_uint64(nwamui_prop_class_t klass, gpointer handle, const char* prop_name)
+{
+    nwam_value_t nwam_data;
+    uint64_t     value = 0;
+    nwam_error_t nerr;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, 0);
+
+    if (!get_prop_value(klass, handle, prop_name, NWAM_VALUE_TYPE_UINT64, &nwam_data)) {
+        return 0;
+    }
+
+    if ((nerr = nwam_value_get_uint64(nwam_data, &value)) != NWAM_SUCCESS) {
+        g_debug("Unable to get uint64 value for %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+        value = 0;
+    }
+
+    nwam_value_free(nwam_data);
+
+    return (guint64)value;
+}
+
+extern gboolean
+nwamui_prop_set_uint64(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, guint64 value)
+{
+    nwam_value_t nwam_data;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (handle == NULL || !check_prop_type(klass, prop_name, NWAM_VALUE_TYPE_UINT64, TRUE)) {
+        return FALSE;
+    }
+
+    if (nwam_value_create_uint64(value, &nwam_data) != NWAM_SUCCESS) {
+        g_debug("Error creating a uint64 value");
+        return FALSE;
+    }
+
+    return set_prop_value(klass, handle, prop_name, nwam_data);
+}
+
+/**
+ * nwamui_prop_get_uint64_array:
+ * @returns: an array of out_num elements, free with g_free().
+ **/
+extern guint64*
+nwamui_prop_get_uint64_array(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, guint *out_num)
+{
+    nwam_value_t nwam_data;
+    uint64_t    *value  = NULL;
+    uint_t       num    = 0;
+    guint64     *retval = NULL;
+    nwam_error_t nerr;
+    int          i;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL && out_num != NULL, NULL);
+
+    *out_num = 0;
+
+    if (!get_prop_value(klass, handle, prop_name, NWAM_VALUE_TYPE_UINT64, &nwam_data)) {
+        return NULL;
+    }
+
+    if ((nerr = nwam_value_get_uint64_array(nwam_data, &value, &num)) != NWAM_SUCCESS) {
+        g_debug("Unable to get uint64 value for %s property %s, error = %s", prop_classes[klass].name, prop_name, nwam_strerror(nerr));
+    } else if (num > 0) {
+        retval = g_new(guint64, num);
+        for (i = 0; i < num; i++) {
+            retval[i] = (guint64)value[i];
+        }
+        *out_num = num;
+    }
+
+    nwam_value_free(nwam_data);
+
+    return retval;
+}
+
+extern gboolean
+nwamui_prop_set_uint64_array(nwamui_prop_class_t klass, gpointer handle, const char* prop_name, const guint64 *value_array, guint len)
+{
+    nwam_value_t nwam_data;
+
+    g_return_val_if_fail(klass < NWAMUI_PROP_CLASS_LAST && prop_name != NULL, FALSE);
+
+    if (handle == NULL || !check_prop_type(klass, prop_name, NWAM_VALUE_TYPE_UINT64, TRUE)) {
+        return FALSE;
+    }
+
+    if (nwam_value_create_uint64_array((uint64_t*)value_array, len, &nwam_data) != NWAM_SUCCESS) {
+        g_debug("Error creating a uint64 array value");
+        return FALSE;
+    }
+
+    return set_prop_value(klass, handle, prop_name, nwam_data);
+}
+
+/*
+ * Arena: a list of fixed size blocks handed out by bumping an offset. Oversized
+ * requests get a block of their own. Reset keeps the first block around so a
+ * reused arena normally costs no allocation at all.
+ */
+#define PROP_ARENA_BLOCK_SIZE   (2048)
+#define PROP_ARENA_ALIGN(n)     (((n) + 7) & ~((gsize)7))
+
+typedef struct {
+    gsize   size;
+    gsize   used;
+    /* Data follows, 8 byte aligned */
+} prop_arena_block_t;
+
+#define PROP_ARENA_BLOCK_DATA(b)    ((gchar*)(b) + PROP_ARENA_ALIGN(sizeof(prop_arena_block_t)))
+
+struct _NwamuiPropArena {
+    GSList  *blocks;    /* Head is the block being filled */
+};
+
+extern NwamuiPropArena*
+nwamui_prop_arena_new(void)
+{
+    return g_new0(NwamuiPropArena, 1);
+}
+
+extern void
+nwamui_prop_arena_reset(NwamuiPropArena *arena)
+{
+    GSList *last;
+
+    g_return_if_fail(arena != NULL);
+
+    if (arena->blocks == NULL) {
+        return;
+    }
+
+    /* The last block is the first allocated, keep it. */
+    last = g_slist_last(arena->blocks);
+    while (arena->blocks != last) {
+        g_free(arena->blocks->data);
+        arena->blocks = g_slist_delete_link(arena->blocks, arena->blocks);
+    }
+    ((prop_arena_block_t*)last->data)->used = 0;
+}
+
+extern void
+nwamui_prop_arena_free(NwamuiPropArena *arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+
+    g_slist_foreach(arena->blocks, (GFunc)g_free, NULL);
+    g_slist_free(arena->blocks);
+    g_free(arena);
+}
+
+static gpointer
+prop_arena_alloc(NwamuiPropArena *arena, gsize size)
+{
+    prop_arena_block_t *block = arena->blocks ? arena->blocks->data : NULL;
+    gpointer            mem;
+
+    size = PROP_ARENA_ALIGN(size);
+
+    if (block == NULL || block->size - block->used < size) {
+        gsize block_size = MAX(size, PROP_ARENA_BLOCK_SIZE);
+
+        block = g_malloc(PROP_ARENA_ALIGN(sizeof(prop_arena_block_t)) + block_size);
+        block->size = block_size;
+        block->used = 0;
+        arena->blocks = g_slist_prepend(arena->blocks, block);
+    }
+
+    mem = PROP_ARENA_BLOCK_DATA(block) + block->used;
+    block->used += size;
+
+    return mem;
+}
+
+static gchar*
+prop_arena_strdup(NwamuiPropArena *arena, const gchar *str)
+{
+    gsize  len = strlen(str) + 1;
+    gchar *dup = prop_arena_alloc(arena, len);
+
+    memcpy(dup, str, len);
+    return dup;
+}
+
+extern const gchar*
+nwamui_prop_arena_decode_string(NwamuiPropArena *arena, nwam_value_t value)
+{
+    char *str = NULL;
+
+    g_return_val_if_fail(arena != NULL, NULL);
+
+    if (nwam_value_get_string(value, &str) != NWAM_SUCCESS || str == NULL) {
+        return NULL;
+    }
+    return prop_arena_strdup(arena, str);
+}
+
+/**
+ * nwamui_prop_arena_decode_string_array:
+ * @len: returns the number of strings, may be NULL.
+ * @returns: a NULL terminated array, or NULL if empty.
+ **/
+extern const gchar* const*
+nwamui_prop_arena_decode_string_array(NwamuiPropArena *arena, nwam_value_t value, guint *len)
+{
+    char   **array = NULL;
+    uint_t   num   = 0;
+    gchar  **retval;
+    int      i;
+
+    g_return_val_if_fail(arena != NULL, NULL);
+
+    if (len != NULL) {
+        *len = 0;
+    }
+
+    if (nwam_value_get_string_array(value, &array, &num) != NWAM_SUCCESS || num == 0) {
+        return NULL;
+    }
+
+    retval = prop_arena_alloc(arena, (num + 1) * sizeof(gchar*));
+    for (i = 0; i < num; i++) {
+        retval[i] = prop_arena_strdup(arena, array[i]);
+    }
+    retval[num] = NULL;
+
+    if (len != NULL) {
+        *len = num;
+    }
+
+    return (const gchar* const*)retval;
+}
+
+extern const guint64*
+nwamui_prop_arena_decode_uint64_array(NwamuiPropArena *arena, nwam_value_t value, guint *len)
+{
+    uint64_t *array = NULL;
+    uint_t    num   = 0;
+    guint64  *retval;
+    int       i;
+
+    g_return_val_if_fail(arena != NULL && len != NULL, NULL);
+
+    *len = 0;
+
+    if (nwam_value_get_uint64_array(value, &array, &num) != NWAM_SUCCESS || num == 0) {
+        return NULL;
+    }
+
+    retval = prop_arena_alloc(arena, num * sizeof(guint64));
+    for (i = 0; i < num; i++) {
+        retval[i] = (guint64)array[i];
+    }
+    *len = num;
+
+    return retval;
+}
@@ -0,0 +1,102 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_prop.h
+ *
+ */
+
+#ifndef _NWAMUI_PROP_H
+#define	_NWAMUI_PROP_H
+
+#ifndef _libnwamui_H
+#error "Please include libnwamui.h header instead."
+#endif
+
+#include <libnwam.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Typed access to the properties of libnwam object handles, shared by the
+ * NCU, location, ENM and known WLAN objects. Property value types are
+ * looked up once per name and cached.
+ */
+typedef enum {
+    NWAMUI_PROP_CLASS_NCU = 0,
+    NWAMUI_PROP_CLASS_LOC,
+    NWAMUI_PROP_CLASS_ENM,
+    NWAMUI_PROP_CLASS_KNOWN_WLAN,
+    NWAMUI_PROP_CLASS_LAST /* Not to be used directly */
+} nwamui_prop_class_t;
+
+extern gboolean     nwamui_prop_get_type( nwamui_prop_class_t klass, const char* prop_name,
+                                          nwam_value_type_t *type, gboolean *read_only );
+
+extern gboolean     nwamui_prop_delete( nwamui_prop_class_t klass, gpointer handle, const char* prop_name );
+
+extern gboolean     nwamui_prop_get_boolean( nwamui_prop_class_t klass, gpointer handle, const char* prop_name );
+extern gboolean     nwamui_prop_set_boolean( nwamui_prop_class_t klass, gpointer handle, const char* prop_name,
+                                             gboolean bool_value );
+
+extern gchar*       nwamui_prop_get_string( nwamui_prop_class_t klass, gpointer handle, const char* prop_name );
+extern gboolean     nwamui_prop_set_string( nwamui_prop_class_t klass, gpointer handle, const char* prop_name,
+                                            const gchar* str );
+
+extern gchar**      nwamui_prop_get_string_array( nwamui_prop_class_t klass, gpointer handle, const char* prop_name,
+                                                  guint *len );
+extern gboolean     nwamui_prop_set_string_array( nwamui_prop_class_t klass, gpointer handle, const char* prop_name,
+                                                  char** strs, guint len );
+
+extern guint64      nwamui_prop_get_uint64( nwamui_prop_class_t klass, gpointer handle, const char* prop_name );
+extern gboolean     nwamui_prop_set_uint64( nwamui_prop_class_t klass, gpointer handle, const char* prop_name,
+                                            guint64 value );
+
+extern guint64*     nwamui_prop_get_uint64_array( nwamui_prop_class_t klass, gpointer handle, const char* prop_name,
+                                                  guint *out_num );
+extern gboolean     nwamui_prop_set_uint64_array( nwamui_prop_class_t klass, gpointer handle, const char* prop_name,
+                                                  const guint64 *value_array, guint len );
+
+/*
+ * Arena backed decoding. Values are copied into a #NwamuiPropArena and
+ * returned borrowed, they stay valid until the arena is reset or freed.
+ * Used on reload paths where the decoded values only live until the next
+ * reload, to avoid one allocation per string.
+ */
+typedef struct _NwamuiPropArena NwamuiPropArena;
+
+extern NwamuiPropArena*     nwamui_prop_arena_new( void );
+extern void                 nwamui_prop_arena_reset( NwamuiPropArena *arena );
+extern void                 nwamui_prop_arena_free( NwamuiPropArena *arena );
+
+extern const gchar*         nwamui_prop_arena_decode_string( NwamuiPropArena *arena, nwam_value_t value );
+extern const gchar* const*  nwamui_prop_arena_decode_string_array( NwamuiPropArena *arena, nwam_value_t value,
+                                                                   guint *len );
+extern const guint64*       nwamui_prop_arena_decode_uint64_array( NwamuiPropArena *arena, nwam_value_t value,
+                                                                   guint *len );
+
+G_END_DECLS
+
+#endif	/* _NWAMUI_PROP_H */
+
@@ -0,0 +1,593 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_smf_cache.c
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <libscf.h>
+#include <glib-object.h>
+
+#include "libnwamui.h"
+
+/* Seconds after a walk before its data is considered stale. */
+#define SMF_CACHE_TTL           (120)
+
+typedef struct {
+    gboolean    valid;
+    gboolean    looked_up;  /* From smf_cache_decode(), not the walk */
+    gchar      *name;
+    gchar      *desc;
+} smf_cache_entry_t;
+
+/* FMRI completion index. Every FMRI is entered once per segment, i.e. from
+ * its start and from after each '/' or ':', sorted by that suffix. A prefix
+ * or segment match is then a binary search plus a scan of the hits, which
+ * is what a trie would give without a node per character.
+ */
+typedef struct {
+    const gchar    *suffix;     /* Points into fmris */
+    const gchar    *fmri;
+} smf_segment_t;
+
+typedef struct {
+    GPtrArray      *fmris;      /* Owns the strings */
+    smf_segment_t  *segments;
+    guint           n_segments;
+} smf_index_t;
+
+/* Owned by the worker thread until it is handed back through an idle. */
+typedef struct {
+    GHashTable     *table;
+    smf_index_t    *index;
+    GPtrArray      *recheck;    /* Looked up FMRIs to decode again, owned */
+} smf_cache_walk_t;
+
+static GHashTable  *cache = NULL;
+static smf_index_t *cache_index = NULL;
+static time_t       cache_time = 0;
+static gboolean     walk_running = FALSE;
+static gboolean     walk_done = FALSE;
+static GHookList   *hooks = NULL;
+
+static void
+smf_cache_entry_free(smf_cache_entry_t *entry)
+{
+    g_free(entry->name);
+    g_free(entry->desc);
+    g_free(entry);
+}
+
+static void
+smf_index_free(smf_index_t *index)
+{
+    g_ptr_array_foreach(index->fmris, (GFunc)g_free, NULL);
+    g_ptr_array_free(index->fmris, TRUE);
+    g_free(index->segments);
+    g_free(index);
+}
+
+static gint
+smf_segment_compare(gconstpointer a, gconstpointer b)
+{
+    return strcmp(((const smf_segment_t*)a)->suffix, ((const smf_segment_t*)b)->suffix);
+}
+
+static smf_index_t*
+smf_index_new(GHashTable *table)
+{
+    smf_index_t    *index = g_new0(smf_index_t, 1);
+    GHashTableIter  iter;
+    gchar          *fmri;
+    guint           n_alloc;
+    guint           i;
+
+    index->fmris = g_ptr_array_sized_new(g_hash_table_size(table));
+    g_hash_table_iter_init(&iter, table);
+    while (g_hash_table_iter_next(&iter, (gpointer*)&fmri, NULL)) {
+        g_ptr_array_add(index->fmris, g_strdup(fmri));
+    }
+
+    /* svc:/network/ssh:default has three or four segments, grow as needed. */
+    n_alloc = index->fmris->len * 4;
+    index->segments = g_new(smf_segment_t, n_alloc);
+
+    for (i = 0; i < index->fmris->len; i++) {
+        const gchar *f = g_ptr_array_index(index->fmris, i);
+        const gchar *p;
+
+        for (p = f; *p; p++) {
+            if (p != f && p[-1] != '/' && p[-1] != ':') {
+                continue;
+            }
+            if (index->n_segments == n_alloc) {
+                n_alloc *= 2;
+                index->segments = g_renew(smf_segment_t, index->segments, n_alloc);
+            }
+            index->segments[index->n_segments].suffix = p;
+            index->segments[index->n_segments].fmri = f;
+            index->n_segments++;
+        }
+    }
+
+    qsort(index->segments, index->n_segments, sizeof(smf_segment_t), smf_segment_compare);
+
+    return index;
+}
+
+static GHashTable*
+smf_cache_table_new(void)
+{
+    return g_hash_table_new_full(g_str_hash, g_str_equal,
+      g_free, (GDestroyNotify)smf_cache_entry_free);
+}
+
+/* Read the "C" locale value of a template property group, instance first
+ * and then service, like svcs(1) does. */
+static gchar*
+smf_get_template_value(scf_service_t *service, scf_instance_t *instance, const char *pg_name,
+  scf_propertygroup_t *pg, scf_property_t *prop, scf_value_t *value, char *buf, ssize_t buflen)
+{
+    if ((instance != NULL && scf_instance_get_pg(instance, pg_name, pg) != -1) ||
+      scf_service_get_pg(service, pg_name, pg) != -1) {
+        if (scf_pg_get_property(pg, "C", prop) != -1 &&
+          scf_property_get_value(prop, value) != -1 &&
+          scf_value_get_ustring(value, buf, buflen) != -1) {
+            return g_strdup(buf);
+        }
+    }
+    return NULL;
+}
+
+static smf_cache_entry_t* smf_cache_decode(scf_handle_t *handle, const gchar *fmri);
+
+/* Walk every instance in the repository, normally in a worker thread. */
+static void
+smf_cache_walk(smf_cache_walk_t *walk)
+{
+    scf_handle_t           *handle = scf_handle_create(SCF_VERSION);
+	ssize_t                 max_scf_name_length = scf_limit(SCF_LIMIT_MAX_NAME_LENGTH);
+    scf_scope_t            *scope = scf_scope_create(handle);
+    scf_service_t          *service = scf_service_create(handle);
+    scf_instance_t         *instance = scf_instance_create(handle);
+    scf_iter_t             *svc_iter = scf_iter_create(handle);
+    scf_iter_t             *inst_iter = scf_iter_create(handle);
+    scf_propertygroup_t    *pg = scf_pg_create(handle);
+    scf_property_t         *prop = scf_property_create(handle);
+    scf_value_t            *value = scf_value_create(handle);
+    char                   *sname = g_malloc(max_scf_name_length + 1);
+    char                   *iname = g_malloc(max_scf_name_length + 1);
+    char                   *buf = g_malloc(max_scf_name_length + 1);
+    int                     r;
+    guint                   i;
+
+    nwamui_trace_begin("smf_cache_walk");
+
+    if (!handle || !scope || !service || !instance || !svc_iter || !inst_iter ||
+      !pg || !prop || !value) {
+        g_warning("Couldn't allocate SMF handles");
+        goto L_exit;
+    }
+
+    if (scf_handle_bind(handle) == -1) {
+        g_warning("Couldn't bind to smf service: %s", scf_strerror(scf_error()));
+        goto L_exit;
+    }
+
+    if (scf_handle_get_scope(handle, SCF_SCOPE_LOCAL, scope) != 0 ||
+      scf_iter_scope_services(svc_iter, scope) != 0) {
+        g_warning("Couldn't walk smf services: %s", scf_strerror(scf_error()));
+        goto L_exit;
+    }
+
+    for (r = scf_iter_next_service(svc_iter, service);
+         r == 1;
+         r = scf_iter_next_service(svc_iter, service)) {
+        gchar  *svc_name;
+        gchar  *svc_desc;
+        int     rv;
+
+        if (scf_service_get_name(service, sname, max_scf_name_length + 1) == -1 ||
+          scf_iter_service_instances(inst_iter, service) != 0) {
+            continue;
+        }
+
+        svc_name = smf_get_template_value(service, NULL, SCF_PG_TM_COMMON_NAME,
+          pg, prop, value, buf, max_scf_name_length + 1);
+        svc_desc = smf_get_template_value(service, NULL, SCF_PG_TM_DESCRIPTION,
+          pg, prop, value, buf, max_scf_name_length + 1);
+
+        for (rv = scf_iter_next_instance(inst_iter, instance);
+             rv == 1;
+             rv = scf_iter_next_instance(inst_iter, instance)) {
+            smf_cache_entry_t *entry;
+
+            if (scf_instance_get_name(instance, iname, max_scf_name_length + 1) == -1) {
+                continue;
+            }
+
+            entry = g_new0(smf_cache_entry_t, 1);
+            entry->valid = TRUE;
+            /* Instance templates override the service ones. */
+            if (scf_instance_get_pg(instance, SCF_PG_TM_COMMON_NAME, pg) != -1) {
+                entry->name = smf_get_template_value(service, instance, SCF_PG_TM_COMMON_NAME,
+                  pg, prop, value, buf, max_scf_name_length + 1);
+            }
+            if (entry->name == NULL) {
+                entry->name = g_strdup(svc_name);
+            }
+            if (scf_instance_get_pg(instance, SCF_PG_TM_DESCRIPTION, pg) != -1) {
+                entry->desc = smf_get_template_value(service, instance, SCF_PG_TM_DESCRIPTION,
+                  pg, prop, value, buf, max_scf_name_length + 1);
+            }
+            if (entry->desc == NULL) {
+                entry->desc = g_strdup(svc_desc);
+            }
+
+            g_hash_table_replace(walk->table,
+              g_strdup_printf("svc:/%s:%s", sname, iname), entry);
+        }
+
+        g_free(svc_name);
+        g_free(svc_desc);
+    }
+
+    /* FMRIs looked up one by one, e.g. abbreviated ones, aren't found by
+     * the walk. Decode them again so that deleted services go invalid.
+     */
+    for (i = 0; i < walk->recheck->len; i++) {
+        const gchar *fmri = g_ptr_array_index(walk->recheck, i);
+
+        if (g_hash_table_lookup(walk->table, fmri) == NULL) {
+            g_hash_table_insert(walk->table, g_strdup(fmri), smf_cache_decode(handle, fmri));
+        }
+    }
+
+L_exit:
+    scf_value_destroy(value);
+    scf_property_destroy(prop);
+    scf_pg_destroy(pg);
+    scf_iter_destroy(inst_iter);
+    scf_iter_destroy(svc_iter);
+    scf_instance_destroy(instance);
+    scf_service_destroy(service);
+    scf_scope_destroy(scope);
+    scf_handle_destroy(handle);
+
+    g_free(sname);
+    g_free(iname);
+    g_free(buf);
+
+    walk->index = smf_index_new(walk->table);
+
+    nwamui_trace_end("smf_cache_walk");
+}
+
+static gboolean
+smf_cache_walk_done(gpointer data)
+{
+    smf_cache_walk_t *walk = (smf_cache_walk_t*)data;
+
+    g_debug("SMF cache filled with %d instances", g_hash_table_size(walk->table));
+
+    /* Everything else is dropped, FMRIs looked up while walking are
+     * decoded again on their next lookup.
+     */
+    if (cache != NULL) {
+        g_hash_table_destroy(cache);
+    }
+    cache = walk->table;
+    if (cache_index != NULL) {
+        smf_index_free(cache_index);
+    }
+    cache_index = walk->index;
+    cache_time = time(NULL);
+    walk_running = FALSE;
+    walk_done = TRUE;
+
+    g_ptr_array_foreach(walk->recheck, (GFunc)g_free, NULL);
+    g_ptr_array_free(walk->recheck, TRUE);
+    g_free(walk);
+
+    if (hooks != NULL) {
+        g_hook_list_invoke(hooks, FALSE);
+    }
+    return FALSE;
+}
+
+static gpointer
+smf_cache_walk_run(gpointer data)
+{
+    smf_cache_walk((smf_cache_walk_t*)data);
+    g_idle_add(smf_cache_walk_done, data);
+    return NULL;
+}
+
+static void
+smf_cache_start_walk(void)
+{
+    smf_cache_walk_t   *walk;
+    GError             *error = NULL;
+
+    if (walk_running) {
+        return;
+    }
+
+    walk = g_new0(smf_cache_walk_t, 1);
+    walk->table = smf_cache_table_new();
+    walk->recheck = g_ptr_array_new();
+    if (cache != NULL) {
+        GHashTableIter      iter;
+        gchar              *fmri;
+        smf_cache_entry_t  *entry;
+
+        g_hash_table_iter_init(&iter, cache);
+        while (g_hash_table_iter_next(&iter, (gpointer*)&fmri, (gpointer*)&entry)) {
+            if (entry->looked_up) {
+                g_ptr_array_add(walk->recheck, g_strdup(fmri));
+            }
+        }
+    }
+    walk_running = TRUE;
+
+    if (g_thread_create(smf_cache_walk_run, walk, FALSE, &error) == NULL) {
+        g_warning("Error creating smf cache thread: %s",
+          (error && error->message) ? error->message : "");
+        g_clear_error(&error);
+        /* Do it now then. */
+        smf_cache_walk(walk);
+        smf_cache_walk_done(walk);
+    }
+}
+
+/* Look up a single FMRI the slow way, for those not found by the walk.
+ * @handle is bound and only used by the calling thread.
+ */
+static smf_cache_entry_t*
+smf_cache_decode(scf_handle_t *handle, const gchar *fmri)
+{
+	ssize_t                 max_scf_name_length = scf_limit(SCF_LIMIT_MAX_NAME_LENGTH);
+    smf_cache_entry_t      *entry = g_new0(smf_cache_entry_t, 1);
+    scf_service_t          *service;
+    scf_instance_t         *instance;
+    scf_propertygroup_t    *pg;
+    scf_property_t         *prop;
+    scf_value_t            *value;
+    char                   *buf;
+
+    entry->looked_up = TRUE;
+
+    service = scf_service_create(handle);
+    instance = scf_instance_create(handle);
+
+    if (scf_handle_decode_fmri(handle, fmri, NULL, service, instance, NULL, NULL,
+        SCF_DECODE_FMRI_REQUIRE_INSTANCE) < 0) {
+        g_debug("Problem decoding the fmri '%s' : %s", fmri, scf_strerror(scf_error()));
+        goto L_exit;
+    }
+
+    /* Got this far, so FMRI is valid */
+    entry->valid = TRUE;
+
+    pg = scf_pg_create(handle);
+    prop = scf_property_create(handle);
+    value = scf_value_create(handle);
+    buf = g_malloc(max_scf_name_length + 1);
+
+    entry->name = smf_get_template_value(service, instance, SCF_PG_TM_COMMON_NAME,
+      pg, prop, value, buf, max_scf_name_length + 1);
+    entry->desc = smf_get_template_value(service, instance, SCF_PG_TM_DESCRIPTION,
+      pg, prop, value, buf, max_scf_name_length + 1);
+
+    scf_pg_destroy(pg);
+    scf_property_destroy(prop);
+    scf_value_destroy(value);
+    g_free(buf);
+
+L_exit:
+    scf_service_destroy(service);
+    scf_instance_destroy(instance);
+    return entry;
+}
+
+/* smf_cache_decode() from the main loop. */
+static smf_cache_entry_t*
+smf_cache_lookup_one(const gchar *fmri)
+{
+    static scf_handle_t    *handle = NULL;
+
+    if (handle == NULL) {
+        handle = scf_handle_create(SCF_VERSION);
+
+        if (scf_handle_bind(handle) == -1) {
+            g_warning("Couldn't bind to smf service: %s", scf_strerror(scf_error()));
+            scf_handle_destroy(handle);
+            handle = NULL;
+            return g_new0(smf_cache_entry_t, 1);
+        }
+    }
+    return smf_cache_decode(handle, fmri);
+}
+
+/**
+ * nwamui_smf_cache_lookup:
+ * @fmri: the service instance FMRI.
+ * @wait: if the FMRI isn't cached, look it up now rather than only after
+ * a pending walk has finished.
+ * @valid_fmri: (out) whether the FMRI names an existing instance, or NULL.
+ * @name: (out) newly allocated common name, NULL if unset, or NULL.
+ * @desc: (out) newly allocated description, NULL if unset, or NULL.
+ *
+ * Returns: TRUE if the outputs were set, FALSE if nothing is known yet,
+ * the hooks are then invoked once the data is available.
+ **/
+extern gboolean
+nwamui_smf_cache_lookup(const gchar *fmri, gboolean wait, gboolean *valid_fmri, gchar **name, gchar **desc)
+{
+    smf_cache_entry_t *entry = NULL;
+
+    g_return_val_if_fail(fmri != NULL, FALSE);
+
+    if (cache == NULL) {
+        cache = smf_cache_table_new();
+    }
+
+    if (!walk_done || time(NULL) - cache_time > SMF_CACHE_TTL) {
+        smf_cache_start_walk();
+    }
+
+    if ((entry = g_hash_table_lookup(cache, fmri)) == NULL) {
+        if (!walk_done && !wait) {
+            return FALSE;
+        }
+        entry = smf_cache_lookup_one(fmri);
+        g_hash_table_insert(cache, g_strdup(fmri), entry);
+    }
+
+    if (valid_fmri) {
+        *valid_fmri = entry->valid;
+    }
+    if (name) {
+        *name = g_strdup(entry->name);
+    }
+    if (desc) {
+        *desc = g_strdup(entry->desc);
+    }
+    return TRUE;
+}
+
+/**
+ * nwamui_smf_cache_complete:
+ * @key: start of the FMRI, or of any of its segments, e.g. "svc:/net",
+ * "network/ss" or "ssh".
+ * @max_results: stop after this many FMRIs, 0 only makes sure the index is
+ * being built.
+ *
+ * Returns: a list of newly allocated FMRIs, NULL if none match or the
+ * repository hasn't been walked yet, the hooks are then invoked once it is.
+ **/
+extern GList*
+nwamui_smf_cache_complete(const gchar *key, guint max_results)
+{
+    GList          *list = NULL;
+    GHashTable     *seen;
+    gsize           len;
+    guint           lo, hi;
+    guint           n = 0;
+
+    g_return_val_if_fail(key != NULL, NULL);
+
+    if (!walk_done || time(NULL) - cache_time > SMF_CACHE_TTL) {
+        smf_cache_start_walk();
+    }
+    if (cache_index == NULL || max_results == 0) {
+        return NULL;
+    }
+
+    /* Find the first segment not sorting before key. */
+    len = strlen(key);
+    lo = 0;
+    hi = cache_index->n_segments;
+    while (lo < hi) {
+        guint mid = lo + (hi - lo) / 2;
+
+        if (strcmp(cache_index->segments[mid].suffix, key) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    /* An FMRI may match through more than one segment. */
+    seen = g_hash_table_new(g_direct_hash, g_direct_equal);
+    for (; lo < cache_index->n_segments && n < max_results; lo++) {
+        smf_segment_t *seg = &cache_index->segments[lo];
+
+        if (strncmp(seg->suffix, key, len) != 0) {
+            break;
+        }
+        if (g_hash_table_lookup(seen, seg->fmri) == NULL) {
+            g_hash_table_insert(seen, (gpointer)seg->fmri, (gpointer)seg->fmri);
+            list = g_list_prepend(list, g_strdup(seg->fmri));
+            n++;
+        }
+    }
+    g_hash_table_destroy(seen);
+
+    return g_list_reverse(list);
+}
+
+/**
+ * nwamui_smf_cache_refresh:
+ *
+ * Drop what is known about services and walk the repository again.
+ **/
+extern void
+nwamui_smf_cache_refresh(void)
+{
+    if (cache != NULL) {
+        g_hash_table_remove_all(cache);
+    }
+    walk_done = FALSE;
+    smf_cache_start_walk();
+}
+
+/**
+ * nwamui_smf_cache_add_hook:
+ *
+ * Have @func called each time a walk of the repository has finished.
+ *
+ * Returns: the id for nwamui_smf_cache_remove_hook().
+ **/
+extern gulong
+nwamui_smf_cache_add_hook(nwamui_smf_cache_func_t func, gpointer user_data)
+{
+    GHook *hook;
+
+    g_return_val_if_fail(func != NULL, 0);
+
+    if (hooks == NULL) {
+        hooks = g_new0(GHookList, 1);
+        g_hook_list_init(hooks, sizeof(GHook));
+    }
+
+    hook = g_hook_alloc(hooks);
+    hook->func = (gpointer)func;
+    hook->data = user_data;
+    g_hook_append(hooks, hook);
+
+    return hook->hook_id;
+}
+
+extern void
+nwamui_smf_cache_remove_hook(gulong hook_id)
+{
+    if (hooks != NULL && hook_id > 0) {
+        g_hook_destroy(hooks, hook_id);
+    }
+}
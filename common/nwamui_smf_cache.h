@@ -0,0 +1,66 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_smf_cache.h
+ *
+ */
+
+#ifndef _NWAMUI_SMF_CACHE_H
+#define	_NWAMUI_SMF_CACHE_H
+
+#ifndef _libnwamui_H
+#error "Please include libnwamui.h header instead."
+#endif
+
+G_BEGIN_DECLS
+
+/*
+ * Cache of SMF service metadata, FMRI -> validity, common name and
+ * description. It is filled in bulk by one walk of the repository in a
+ * worker thread, and considered stale some time after that walk; a lookup
+ * of stale data returns it while a new walk runs. The walk also builds an
+ * index of the FMRIs for prefix and segment completion.
+ *
+ * Lookups and hooks are main loop only.
+ */
+typedef void (*nwamui_smf_cache_func_t)(gpointer user_data);
+
+extern gboolean     nwamui_smf_cache_lookup( const gchar *fmri,
+                                             gboolean wait,
+                                             gboolean *valid_fmri,
+                                             gchar **name,
+                                             gchar **desc );
+
+extern GList*       nwamui_smf_cache_complete( const gchar *key, guint max_results );
+
+extern void         nwamui_smf_cache_refresh( void );
+
+extern gulong       nwamui_smf_cache_add_hook( nwamui_smf_cache_func_t func, gpointer user_data );
+
+extern void         nwamui_smf_cache_remove_hook( gulong hook_id );
+
+G_END_DECLS
+
+#endif	/* _NWAMUI_SMF_CACHE_H */
@@ -0,0 +1,215 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_trace.c
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <glib-object.h>
+
+#include "libnwamui.h"
+
+/* A cold login records a few hundred events, stop well before the trace
+ * itself becomes what is being measured.
+ */
+#define TRACE_MAX_EVENTS        (8192)
+
+typedef struct {
+    const gchar    *name;
+    gchar           phase;      /* 'B', 'E' or 'i' */
+    gulong          tid;
+    hrtime_t        ts;
+} trace_event_t;
+
+static gboolean         enabled = FALSE;
+static gchar           *trace_filename = NULL;
+static hrtime_t         trace_start = 0;
+static trace_event_t   *events = NULL;
+static guint            num_events = 0;
+static guint            num_dropped = 0;
+
+G_LOCK_DEFINE_STATIC(trace);
+
+/**
+ * nwamui_trace_enable:
+ * @filename: where nwamui_trace_write() puts the trace, if NULL the
+ * NWAMUI_TRACE_ENV environment variable is used.
+ *
+ * Returns: TRUE if tracing is enabled.
+ **/
+extern gboolean
+nwamui_trace_enable(const gchar *filename)
+{
+    if (enabled) {
+        /* An explicit file name wins over the environment. */
+        if (filename != NULL && *filename != '\0') {
+            g_free(trace_filename);
+            trace_filename = g_strdup(filename);
+        }
+        return TRUE;
+    }
+
+    if (filename == NULL || *filename == '\0') {
+        filename = g_getenv(NWAMUI_TRACE_ENV);
+        if (filename == NULL || *filename == '\0') {
+            return FALSE;
+        }
+    }
+
+    trace_filename = g_strdup(filename);
+    events = g_new(trace_event_t, TRACE_MAX_EVENTS);
+    trace_start = gethrtime();
+    enabled = TRUE;
+
+    g_debug("Tracing startup to %s", trace_filename);
+    return TRUE;
+}
+
+extern gboolean
+nwamui_trace_is_enabled(void)
+{
+    return enabled;
+}
+
+static void
+trace_record(const gchar *name, gchar phase)
+{
+    hrtime_t ts = gethrtime();
+
+    G_LOCK(trace);
+    if (num_events < TRACE_MAX_EVENTS) {
+        trace_event_t *ev = &events[num_events++];
+
+        ev->name = name;
+        ev->phase = phase;
+        ev->tid = (gulong)pthread_self();
+        ev->ts = ts;
+    } else {
+        num_dropped++;
+    }
+    G_UNLOCK(trace);
+}
+
+extern void
+nwamui_trace_begin(const gchar *name)
+{
+    if (enabled) {
+        trace_record(name, 'B');
+    }
+}
+
+extern void
+nwamui_trace_end(const gchar *name)
+{
+    if (enabled) {
+        trace_record(name, 'E');
+    }
+}
+
+extern void
+nwamui_trace_instant(const gchar *name)
+{
+    if (enabled) {
+        trace_record(name, 'i');
+    }
+}
+
+static void
+trace_append_escaped(GString *str, const gchar *s)
+{
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            g_string_append_c(str, '\\');
+        }
+        g_string_append_c(str, *s);
+    }
+}
+
+/**
+ * nwamui_trace_write:
+ *
+ * Write the events recorded so far as Chrome trace-event JSON. Spans still
+ * open are left unterminated, the viewer closes them at the last event.
+ *
+ * Returns: TRUE if the trace was written.
+ **/
+extern gboolean
+nwamui_trace_write(void)
+{
+    GString    *str;
+    GError     *error = NULL;
+    gboolean    retval;
+    pid_t       pid = getpid();
+    guint       i;
+
+    if (!enabled) {
+        return FALSE;
+    }
+
+    str = g_string_sized_new(128 + num_events * 96);
+    g_string_append(str, "{\"traceEvents\":[\n");
+
+    G_LOCK(trace);
+    for (i = 0; i < num_events; i++) {
+        trace_event_t *ev = &events[i];
+        gint64         ns = (gint64)(ev->ts - trace_start);
+
+        g_string_append(str, "{\"name\":\"");
+        trace_append_escaped(str, ev->name);
+        /* Chrome wants microseconds, gethrtime() gives nanoseconds. Split
+         * them with integer math, %f would follow LC_NUMERIC and could
+         * write a decimal comma.
+         */
+        g_string_append_printf(str, "\",\"cat\":\"nwam\",\"ph\":\"%c\",\"ts\":%" G_GINT64_FORMAT ".%03d,\"pid\":%d,\"tid\":%lu%s}%s\n",
+          ev->phase,
+          ns / 1000, (gint)(ns % 1000),
+          (gint)pid,
+          ev->tid,
+          ev->phase == 'i' ? ",\"s\":\"t\"" : "",
+          i + 1 < num_events ? "," : "");
+    }
+    if (num_dropped > 0) {
+        g_warning("Trace buffer full, %u events dropped", num_dropped);
+    }
+    G_UNLOCK(trace);
+
+    g_string_append(str, "],\"displayTimeUnit\":\"ms\"}\n");
+
+    if ((retval = g_file_set_contents(trace_filename, str->str, str->len, &error))) {
+        g_debug("Wrote %u trace events to %s", num_events, trace_filename);
+    } else {
+        g_warning("Failed to write trace %s: %s", trace_filename,
+          (error && error->message) ? error->message : "");
+        g_clear_error(&error);
+    }
+
+    g_string_free(str, TRUE);
+    return retval;
+}
@@ -0,0 +1,65 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* vim:set expandtab ts=4 shiftwidth=4: */
+/* 
+ * Copyright 2007-2009 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ *
+ * CDDL HEADER START
+ * 
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ * 
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ * 
+ * CDDL HEADER END
+ * 
+ * File:   nwamui_trace.h
+ *
+ */
+
+#ifndef _NWAMUI_TRACE_H
+#define	_NWAMUI_TRACE_H
+
+#ifndef _libnwamui_H
+#error "Please include libnwamui.h header instead."
+#endif
+
+G_BEGIN_DECLS
+
+/*
+ * Startup timeline tracer. When enabled, named spans are recorded with a
+ * monotonic timestamp and the id of the calling thread, and written out as
+ * Chrome trace-event JSON (load it in chrome://tracing) by
+ * nwamui_trace_write().
+ *
+ * Enabled by setting NWAMUI_TRACE_ENV to the output file name, or by
+ * calling nwamui_trace_enable(). Disabled by default, recording is then a
+ * single test. Names must be static strings.
+ */
+#define NWAMUI_TRACE_ENV    "NWAM_MANAGER_TRACE"
+
+extern gboolean             nwamui_trace_enable( const gchar *filename );
+
+extern gboolean             nwamui_trace_is_enabled( void );
+
+extern void                 nwamui_trace_begin( const gchar *name );
+
+extern void                 nwamui_trace_end( const gchar *name );
+
+extern void                 nwamui_trace_instant( const gchar *name );
+
+extern gboolean             nwamui_trace_write( void );
+
+G_END_DECLS
+
+#endif	/* _NWAMUI_TRACE_H */
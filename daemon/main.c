@@ -46,12 +46,14 @@ static gboolean debug = FALSE;
 static gboolean notify_reuse = FALSE;
 static gboolean notify_create_always = FALSE;
 static gboolean notify_create_nostatus = FALSE;
+static gchar *trace_file = NULL;
 
 static GOptionEntry option_entries[] = {
     {"debug", 'D', G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_NONE, &debug, N_("Enable debugging messages"), NULL },
     {"notify-reuse", 'a', G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_NONE, &notify_reuse, N_("Always re-use notification message"), NULL },
     {"notify-create-always", 'a', G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_NONE, &notify_create_always, N_("Always create notification message, rather than re-use"), NULL },
     {"notify-create-always-nostatus", 'n', G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_NONE, &notify_create_nostatus, N_("Always create notification message, rather than re-use, and don't link to status icon"), NULL },
+    {"trace", 'T', G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_FILENAME, &trace_file, N_("Write a startup timeline in Chrome trace format to FILE"), N_("FILE") },
     {NULL}
 };
 
@@ -67,6 +69,7 @@ init_wait_for_embedding_idle(gpointer data)
     GtkStatusIcon* status_icon = GTK_STATUS_ICON(data);
 
     if (gtk_status_icon_is_embedded(status_icon)) {
+        nwamui_trace_instant("status icon embedded");
         nwam_status_icon_run(NWAM_STATUS_ICON(status_icon));
         return FALSE;
     }
@@ -97,6 +100,12 @@ main( int argc, char* argv[] )
     NwamuiProf* prof;
     GtkStatusIcon *status_icon = NULL;
 
+    /* Pick up NWAM_MANAGER_TRACE as early as possible, --trace can only be
+     * seen once GNOME has parsed the command line.
+     */
+    nwamui_trace_enable(NULL);
+    nwamui_trace_begin("startup");
+
     option_context = g_option_context_new (PACKAGE);
 
     bindtextdomain (GETTEXT_PACKAGE, NWAM_MANAGER_LOCALEDIR);
@@ -104,11 +113,21 @@ main( int argc, char* argv[] )
     textdomain (GETTEXT_PACKAGE);
     g_option_context_add_main_entries(option_context, option_entries, GETTEXT_PACKAGE);
 
+    nwamui_trace_begin("gnome_program_init");
     program = gnome_program_init (PACKAGE, VERSION, LIBGNOMEUI_MODULE,
                                   argc, argv,
                                   GNOME_PARAM_APP_DATADIR, NWAM_MANAGER_DATADIR,
                                   GNOME_PARAM_GOPTION_CONTEXT, option_context,
                                   GNOME_PARAM_NONE);
+    nwamui_trace_end("gnome_program_init");
+
+    if (trace_file && !nwamui_trace_is_enabled()) {
+        /* Enabled late, time is then counted from here. */
+        nwamui_trace_enable(trace_file);
+        nwamui_trace_begin("startup");
+    } else if (trace_file) {
+        nwamui_trace_enable(trace_file);
+    }
 
 
     gtk_icon_theme_append_search_path (gtk_icon_theme_get_default (),
@@ -181,7 +200,10 @@ main( int argc, char* argv[] )
      * this is to avoid confusion when calling gtk_main_iteration to get to
      * the point where the status icon's embedded flag is correctly set
      */
+    nwamui_trace_begin("nwam_status_icon_new");
     status_icon = nwam_status_icon_new();
+    nwamui_trace_end("nwam_status_icon_new");
+    nwamui_trace_end("startup");
     gtk_init_add(init_wait_for_embedding, (gpointer)status_icon);
     if ( nwamui_util_is_debug_mode() ) {
         g_message("Show status icon initially on debug mode.");
@@ -193,6 +215,9 @@ main( int argc, char* argv[] )
 
     g_object_unref(status_icon);
     g_object_unref (G_OBJECT (program));
+
+    nwamui_trace_write();
+    g_free(trace_file);
     
     return 0;
 }
@@ -24,6 +24,7 @@
  * CDDL HEADER END
  * 
  */
+#include <string.h>
 #include <gtk/gtk.h>
 #include <glib/gi18n.h>
 #include "notify.h"
@@ -41,7 +42,9 @@ static GtkStatusIcon*        parent_status_icon     = NULL;
 static GdkPixbuf            *default_icon           = NULL;
 static GQueue                msg_q                  = G_QUEUE_INIT;
 
-static guint adjust_source_id = 0;
+/* The only timer source, it drives showing, expiring and rate limiting. */
+static guint scheduler_source_id = 0;
+static GTimeVal last_show_time = { 0, 0 };
 static gint gconf_exp_time;
 #define DEFAULT_EXP_TIME	gconf_exp_time
 #define TIGHT_EXP_TIME	((gint) (0.5 * DEFAULT_EXP_TIME))
@@ -54,8 +57,18 @@ static gint gconf_exp_time;
 
 #define NOTIFY_DELAY_SECONDS_FOR_NCU_CONNECTION	(5)
 
+/* A queued message is superseded by a newer one about the same object if
+ * the newer one arrives within the window. Bubbles are shown at most once
+ * per interval, and at most NOTIFY_MAX_PENDING wait to be shown.
+ */
+#define NOTIFY_COALESCE_WINDOW	(3000)
+#define NOTIFY_MIN_INTERVAL	(1000)
+#define NOTIFY_MAX_PENDING	(4)
+
 typedef struct _msg
 {
+    notification_category_t category;
+    gpointer object;            /* Subject, only used as a key */
     NotifyNotification *n;
     gchar *summary;
     gchar *body;
@@ -66,10 +79,32 @@ typedef struct _msg
     gpointer user_data;
     GFreeFunc free_func;
     gint timeout;
+    GTimeVal queued;
     GTimeVal t;
 } msg;
 
-static msg *nwam_notification_msg_new(NotifyNotification *n,
+static const gchar *category_names[NOTIFICATION_CATEGORY_LAST] = {
+    "nwam_unavailable",
+    "ncu_connected",
+    "ncu_disconnected",
+    "ncu_wifi_connect_failed",
+    "ncu_dup_address",
+    "ncu_wifi_selection_needed",
+    "ncu_wifi_key_needed",
+    "no_wifi_networks",
+    "ncp_changed",
+    "location_changed"
+};
+
+/* Messages without a single subject object coalesce per category. */
+#define CATEGORY_KEY(category)  ((gpointer)&category_names[category])
+
+static guint shown_count[NOTIFICATION_CATEGORY_LAST];
+static guint suppressed_count[NOTIFICATION_CATEGORY_LAST];
+
+static msg *nwam_notification_msg_new(notification_category_t category,
+  gpointer object,
+  NotifyNotification *n,
   const gchar *summary,
   const gchar *body,
   const GdkPixbuf* icon,
@@ -82,13 +117,19 @@ static msg *nwam_notification_msg_new(NotifyNotification *n,
 
 static void nwam_notification_msg_free(msg *m);
 
-static gboolean nwam_notification_show_message_cb(GQueue *q);
+static void nwam_notification_msg_drop(msg *m);
+
+static void on_notification_closed(NotifyNotification *n, gpointer user_data);
+
+static void nwam_notification_enqueue(GQueue *q, msg *m);
 
 static void nwam_notification_show_nth_message(GQueue *q, guint nth);
 
 static gboolean nwam_notification_hide_cb(NotifyNotification *n);
 
-static gboolean notify_notification_adjust_first(GQueue *q);
+static void notification_schedule(GQueue *q, gint delay);
+
+static gboolean notification_scheduler_cb(GQueue *q);
 
 static void notify_notification_adjust_nth(GQueue *q, guint nth, gint new_timeout);
 
@@ -103,7 +144,9 @@ notify_notification_set_notification_style( notification_style_t style )
 }
 
 static msg *
-nwam_notification_msg_new(NotifyNotification *n,
+nwam_notification_msg_new(notification_category_t category,
+  gpointer object,
+  NotifyNotification *n,
   const gchar *summary,
   const gchar *body,
   const GdkPixbuf* icon,
@@ -116,6 +159,8 @@ nwam_notification_msg_new(NotifyNotification *n,
 {
     msg *m = g_new0(msg, 1);
 
+    m->category = category;
+    m->object = object;
     m->n = n;
     m->summary = g_strdup(summary);
     m->body = g_strdup(body);
@@ -127,6 +172,7 @@ nwam_notification_msg_new(NotifyNotification *n,
     m->user_data = user_data;
     m->free_func = free_func;
     m->timeout = (timeout == NOTIFY_EXPIRES_DEFAULT) ? NOTIFY_EXP_DEFAULT_FLAG : timeout;
+    g_get_current_time(&m->queued);
 
     nwamui_debug("NOTIFICATION_MESSAGE:\nSummary = '%s' ; Body = '%s' ; Action = '%s' ; Label = '%s'", 
                  summary?summary:"NULL",
@@ -154,6 +200,89 @@ nwam_notification_msg_free(msg *m)
     g_free(m);
 }
 
+/* Throw away a message that was never shown. Its action data has not been
+ * handed to libnotify yet, so release it here.
+ */
+static void
+nwam_notification_msg_drop(msg *m)
+{
+    g_assert(m->t.tv_sec == 0 && m->t.tv_usec == 0);
+
+    suppressed_count[m->category]++;
+    nwamui_debug("NOTIFICATION_SUPPRESSED: %s '%s'", category_names[m->category], m->summary);
+
+    if (m->cb && m->free_func && m->user_data) {
+        m->free_func(m->user_data);
+    }
+
+    if ( notification_style != NOTIFICATION_STYLE_REUSE ) {
+        /* Never shown, it mustn't pop the queue when closed. */
+        g_signal_handlers_disconnect_by_func(m->n,
+          (gpointer)on_notification_closed, (gpointer)&msg_q);
+    }
+
+    nwam_notification_msg_free(m);
+}
+
+static gint
+elapsed_ms(const GTimeVal *since, const GTimeVal *now)
+{
+    return (gint) ((now->tv_sec - since->tv_sec) * 1000 +
+      (now->tv_usec - since->tv_usec) / 1000);
+}
+
+/* Queue a message. A pending, not yet shown, message about the same object
+ * queued within NOTIFY_COALESCE_WINDOW is superseded by the new one, e.g.
+ * "e1000g0 connected" replaces "e1000g0 disconnected". If too many messages
+ * are waiting the oldest pending one is dropped.
+ */
+static void
+nwam_notification_enqueue(GQueue *q, msg *m)
+{
+    GList   *l;
+    GList   *next;
+    guint    npending = 0;
+
+    for (l = g_queue_peek_head_link(q); l != NULL; l = next) {
+        msg *old = (msg *)l->data;
+
+        next = g_list_next(l);
+
+        /* Showing */
+        if (old->t.tv_sec != 0 || old->t.tv_usec != 0) {
+            continue;
+        }
+
+        if (m->object != NULL && old->object == m->object &&
+          elapsed_ms(&old->queued, &m->queued) < NOTIFY_COALESCE_WINDOW) {
+            g_queue_delete_link(q, l);
+            nwam_notification_msg_drop(old);
+        } else {
+            npending++;
+        }
+    }
+
+    while (npending >= NOTIFY_MAX_PENDING) {
+        for (l = g_queue_peek_head_link(q); l != NULL; l = g_list_next(l)) {
+            msg *old = (msg *)l->data;
+
+            if (old->t.tv_sec == 0 && old->t.tv_usec == 0) {
+                g_queue_delete_link(q, l);
+                nwam_notification_msg_drop(old);
+                break;
+            }
+        }
+        npending--;
+    }
+
+    g_queue_push_tail(q, m);
+
+    /* adjust the original last show */
+    notify_notification_adjust_nth(q,
+      g_queue_get_length(q) - 2,
+      TIGHT_EXP_TIME);
+}
+
 static void
 on_prof_notification_default_timeout(GObject *gobject, GParamSpec *arg1, gpointer data)
 {
@@ -168,12 +297,7 @@ on_prof_notification_default_timeout(GObject *gobject, GParamSpec *arg1, gpointe
 
     g_debug("#### Notification default timeout %d ####", DEFAULT_EXP_TIME);
 
-    /* restart the timer */
-    if (adjust_source_id > 0) {
-        g_source_remove(adjust_source_id);
-        adjust_source_id = 0;
-    }
-    /* modify the first show */
+    /* modify the first show, this restarts the timer */
     notify_notification_adjust_nth(&msg_q, 0, timeout);
 }
 
@@ -195,11 +319,7 @@ on_notification_closed(NotifyNotification *n,
 
     /* Prepare the next show */
     if ((m = g_queue_peek_head(q)) != NULL) {
-        g_timeout_add_full(G_PRIORITY_DEFAULT,
-          0,
-          (GSourceFunc)nwam_notification_show_message_cb,
-          (gpointer) q,
-          NULL);
+        notification_schedule(q, 0);
     }
 }
 
@@ -274,43 +394,66 @@ notify_notification_adjust_nth(GQueue *q, guint nth, gint new_timeout)
         }
     }
 
-    if (adjust_source_id == 0) {
-        adjust_source_id = g_timeout_add_full(G_PRIORITY_DEFAULT,
-          0,
-          (GSourceFunc)notify_notification_adjust_first,
-          (gpointer) q,
-          NULL);
+    notification_schedule(q, 0);
+}
+
+/* (Re)arm the scheduler to run in delay ms, replacing any pending run. */
+static void
+notification_schedule(GQueue *q, gint delay)
+{
+    if (scheduler_source_id > 0) {
+        g_source_remove(scheduler_source_id);
+    }
+    scheduler_source_id = g_timeout_add_full(G_PRIORITY_DEFAULT,
+      delay > 0 ? delay : 0,
+      (GSourceFunc)notification_scheduler_cb,
+      (gpointer) q,
+      NULL);
+}
+
+/* Returns the time left before another bubble may be shown. */
+static gint
+notification_rate_limit_delay(void)
+{
+    GTimeVal ct;
+    gint     elapsed;
+
+    if (last_show_time.tv_sec == 0 && last_show_time.tv_usec == 0) {
+        return 0;
     }
+
+    g_get_current_time(&ct);
+    elapsed = elapsed_ms(&last_show_time, &ct);
+
+    return (elapsed < NOTIFY_MIN_INTERVAL) ? NOTIFY_MIN_INTERVAL - elapsed : 0;
 }
 
 static gboolean
-notify_notification_adjust_first(GQueue *q)
+notification_scheduler_cb(GQueue *q)
 {
     msg *m;
+    gint delay;
 
-    g_assert(adjust_source_id > 0);
+    /* The source is removed by returning FALSE */
+    scheduler_source_id = 0;
 
     /* Do not show notifications if status icon is invisible. */
     if (!gtk_status_icon_is_embedded(parent_status_icon) ||
       !gtk_status_icon_get_visible(parent_status_icon)) {
-        adjust_source_id = g_timeout_add_full(G_PRIORITY_DEFAULT,
-          NOTIFY_POLL_STATUS_ICON_INVISIBLE,
-          (GSourceFunc)notify_notification_adjust_first,
-          (gpointer) q,
-          NULL);
-
+        notification_schedule(q, NOTIFY_POLL_STATUS_ICON_INVISIBLE);
         return FALSE;
     }
 
-    /* reset source id since the timer should always be deleted/updated */
-    adjust_source_id = 0;
-
     if ((m = g_queue_peek_head(q)) == NULL) {
         return FALSE;
     }
 
     if (m->t.tv_sec == 0 && m->t.tv_usec == 0) {
-        nwam_notification_show_nth_message(q, 0);
+        if ((delay = notification_rate_limit_delay()) > 0) {
+            notification_schedule(q, delay);
+        } else {
+            nwam_notification_show_nth_message(q, 0);
+        }
         return FALSE;
     }
 
@@ -340,14 +483,12 @@ notify_notification_adjust_first(GQueue *q)
 /*         g_debug("#### %s adjust %d ####", __func__, timeout > 0 ? timeout : 0); */
 
         if (timeout > 0) {
-            adjust_source_id = g_timeout_add_full(G_PRIORITY_DEFAULT,
-              timeout,
-              (GSourceFunc)notify_notification_adjust_first,
-              (gpointer) q,
-              NULL);
-        } else {
+            notification_schedule(q, timeout);
+        } else if (g_queue_get_length(q) > 1) {
             /* terminate the current show if there are pending msgs */
-            if (g_queue_get_length(q) > 1) {
+            if ((delay = notification_rate_limit_delay()) > 0) {
+                notification_schedule(q, delay);
+            } else {
 /*                 notify_notification_close(m->n, NULL); */
                 nwam_notification_show_nth_message(q, 1);
             }
@@ -359,6 +500,20 @@ notify_notification_adjust_first(GQueue *q)
 static void
 notification_cleanup( void )
 {
+    gint i;
+
+    if (scheduler_source_id > 0) {
+        g_source_remove(scheduler_source_id);
+        scheduler_source_id = 0;
+    }
+
+    for (i = 0; i < NOTIFICATION_CATEGORY_LAST; i++) {
+        if (shown_count[i] > 0 || suppressed_count[i] > 0) {
+            g_debug("Notifications %-26s shown %4u suppressed %4u",
+              category_names[i], shown_count[i], suppressed_count[i]);
+        }
+    }
+
     if ( notification != NULL ) {
         g_object_unref( parent_status_icon );
         notify_notification_close(notification, NULL); /* Close notification now! */
@@ -432,33 +587,22 @@ nwam_notification_show_nth_message(GQueue *q, guint nth)
         if (!notify_notification_show(m->n, &err)) {
             g_warning(err->message);
             g_error_free( err );
+        } else {
+            shown_count[m->category]++;
         }
 
         /* show time */
         g_get_current_time(&m->t);
+        last_show_time = m->t;
 
-        if (adjust_source_id == 0) {
-            adjust_source_id = g_timeout_add_full(G_PRIORITY_DEFAULT,
-              timeout,
-              (GSourceFunc)notify_notification_adjust_first,
-              (gpointer) q,
-              NULL);
-        }
+        notification_schedule(q, timeout);
     }
 }
 
-static gboolean
-nwam_notification_show_message_cb(GQueue *q)
-{
-    msg *m;
-
-    nwam_notification_show_nth_message(q, 0);
-
-    return FALSE;
-}
-
 static void
-nwam_notification_show_message(const gchar* summary,
+nwam_notification_show_message(notification_category_t category,
+  gpointer object,
+  const gchar* summary,
   const gchar* body,
   const GdkPixbuf* icon,
   gint timeout)
@@ -468,18 +612,15 @@ nwam_notification_show_message(const gchar* summary,
     
     g_assert (summary != NULL && *summary != '\0'); /* Must have a value! */
     
-    m = nwam_notification_msg_new(n, summary, body, icon, NULL, NULL, NULL, NULL, NULL, timeout);
-
-    g_queue_push_tail(&msg_q, m);
+    m = nwam_notification_msg_new(category, object, n, summary, body, icon, NULL, NULL, NULL, NULL, NULL, timeout);
 
-    /* adjust the original last show */
-    notify_notification_adjust_nth(&msg_q,
-      g_queue_get_length(&msg_q) - 2,
-      TIGHT_EXP_TIME);
+    nwam_notification_enqueue(&msg_q, m);
 }
 
 static void
-nwam_notification_show_message_with_action (const gchar* summary,
+nwam_notification_show_message_with_action (notification_category_t category,
+  gpointer object,
+  const gchar* summary,
   const gchar* body,
   const GdkPixbuf* icon,
   const gchar* action,
@@ -494,14 +635,9 @@ nwam_notification_show_message_with_action (const gchar* summary,
 
     g_assert (summary != NULL && *summary != '\0'); /* Must have a value! */
     
-    m = nwam_notification_msg_new(n, summary, body, icon, action, label, callback, user_data, free_func, timeout);
+    m = nwam_notification_msg_new(category, object, n, summary, body, icon, action, label, callback, user_data, free_func, timeout);
 
-    g_queue_push_tail(&msg_q, m);
-
-    /* adjust the original last show */
-    notify_notification_adjust_nth(&msg_q,
-      g_queue_get_length(&msg_q) - 2,
-      TIGHT_EXP_TIME);
+    nwam_notification_enqueue(&msg_q, m);
 }
 
 /* 
@@ -523,7 +659,8 @@ nwam_notification_show_nwam_unavailable( void )
     if ( daemon ) {
         icon = nwamui_util_get_env_status_icon( NULL, nwamui_daemon_get_status_icon_type(daemon), NOTIFY_ICON_SIZE );
     }
-    nwam_notification_show_message(_("Automatic network configuration daemon is unavailable."),
+    nwam_notification_show_message(NOTIFICATION_CATEGORY_NWAM_UNAVAILABLE, CATEGORY_KEY(NOTIFICATION_CATEGORY_NWAM_UNAVAILABLE),
+            _("Automatic network configuration daemon is unavailable."),
             _("For further information please run\n\"svcs -xv nwam\" in a terminal."),
             icon,
             NOTIFY_EXPIRES_DEFAULT);
@@ -621,7 +758,8 @@ nwam_notification_show_ncu_connected( NwamuiNcu* ncu )
             break;
     }
 
-    nwam_notification_show_message( summary_str, body_str,
+    nwam_notification_show_message(NOTIFICATION_CATEGORY_NCU_CONNECTED, ncu,
+                                    summary_str, body_str,
                                     icon, NOTIFY_EXPIRES_DEFAULT);
 
     g_free(display_name);
@@ -699,7 +837,8 @@ nwam_notification_show_ncu_disconnected( NwamuiNcu*           ncu,
     }
 
     if ( callback != NULL ) {
-        nwam_notification_show_message_with_action(summary_str, body_str,
+        nwam_notification_show_message_with_action(NOTIFICATION_CATEGORY_NCU_DISCONNECTED, ncu,
+          summary_str, body_str,
           NULL,
           NULL,	/* action */
           NULL,	/* label */
@@ -709,7 +848,8 @@ nwam_notification_show_ncu_disconnected( NwamuiNcu*           ncu,
           NOTIFY_EXPIRES_DEFAULT);
     }
     else {
-        nwam_notification_show_message( summary_str, body_str,
+        nwam_notification_show_message(NOTIFICATION_CATEGORY_NCU_DISCONNECTED, ncu,
+                                        summary_str, body_str,
                                         icon, NOTIFY_EXPIRES_DEFAULT);
     }
 
@@ -777,7 +917,8 @@ nwam_notification_show_ncu_wifi_connect_failed( NwamuiNcu* ncu )
     }
 
     if ( summary_str != NULL ) {
-        nwam_notification_show_message( summary_str, body_str,
+        nwam_notification_show_message(NOTIFICATION_CATEGORY_NCU_WIFI_CONNECT_FAILED, ncu,
+                                        summary_str, body_str,
                                         icon, NOTIFY_EXPIRES_DEFAULT);
     }
 
@@ -806,7 +947,8 @@ nwam_notification_show_ncu_dup_address(NwamuiNcu* ncu)
     summary_str = g_strdup_printf(_("%s disconnected"), display_name );
     body_str = nwamui_ncu_get_connection_state_string(ncu);
 
-    nwam_notification_show_message(summary_str, body_str,
+    nwam_notification_show_message(NOTIFICATION_CATEGORY_NCU_DUP_ADDRESS, ncu,
+      summary_str, body_str,
       icon, NOTIFY_EXPIRES_DEFAULT);
 
     g_free(display_name);
@@ -845,6 +987,7 @@ nwam_notification_show_ncu_wifi_selection_needed(   NwamuiNcu           *ncu,
 
     /* XXXX - Need to also use dialog? */
     nwam_notification_show_message_with_action(
+                NOTIFICATION_CATEGORY_NCU_WIFI_SELECTION_NEEDED, ncu,
                 summary, 
                 body,
                 icon,
@@ -895,6 +1038,7 @@ nwam_notification_show_ncu_wifi_key_needed( NwamuiWifiNet       *wifi_net,
     /* XXXX - Need to also use dialog? */
 
     nwam_notification_show_message_with_action(
+                NOTIFICATION_CATEGORY_NCU_WIFI_KEY_NEEDED, wifi_net,
                 summary, 
                 body,
                 icon,
@@ -931,7 +1075,8 @@ nwam_notification_show_no_wifi_networks( NotifyActionCallback callback, GObject
     if ( daemon ) {
         icon = nwamui_util_get_env_status_icon( NULL, nwamui_daemon_get_status_icon_type(daemon), NOTIFY_ICON_SIZE );
     }
-    nwam_notification_show_message_with_action(_("No wireless networks found"),
+    nwam_notification_show_message_with_action(NOTIFICATION_CATEGORY_NO_WIFI_NETWORKS, CATEGORY_KEY(NOTIFICATION_CATEGORY_NO_WIFI_NETWORKS),
+      _("No wireless networks found"),
       _("Click this message to join an unlisted network"),
       icon,
       NULL,	/* action */
@@ -970,7 +1115,8 @@ nwam_notification_show_ncp_changed( NwamuiNcp* ncp )
     summary_str = g_strdup_printf(_("Switched to network profile '%s'"),
       nwamui_object_get_name(NWAMUI_OBJECT(ncp)));
 
-    nwam_notification_show_message(summary_str,
+    nwam_notification_show_message(NOTIFICATION_CATEGORY_NCP_CHANGED, CATEGORY_KEY(NOTIFICATION_CATEGORY_NCP_CHANGED),
+            summary_str,
             "",
             icon,
             NOTIFY_EXPIRES_DEFAULT);
@@ -1005,7 +1151,8 @@ nwam_notification_show_location_changed( NwamuiEnv* env )
 
     summary_str = g_strdup_printf(_("Switched to location '%s'"), nwamui_object_get_name(NWAMUI_OBJECT(env)));
 
-    nwam_notification_show_message(summary_str,
+    nwam_notification_show_message(NOTIFICATION_CATEGORY_LOCATION_CHANGED, CATEGORY_KEY(NOTIFICATION_CATEGORY_LOCATION_CHANGED),
+            summary_str,
             "",
             icon,
             NOTIFY_EXPIRES_DEFAULT);
@@ -1044,3 +1191,20 @@ nwam_notification_set_default_icon(GdkPixbuf *pixbuf)
         g_object_ref(default_icon);
 }
 
+void
+nwam_notification_get_stats( notification_category_t category, guint *shown, guint *suppressed )
+{
+    g_return_if_fail(category < NOTIFICATION_CATEGORY_LAST);
+
+    if (shown)
+        *shown = shown_count[category];
+    if (suppressed)
+        *suppressed = suppressed_count[category];
+}
+
+void
+nwam_notification_reset_stats( void )
+{
+    memset(shown_count, 0, sizeof (shown_count));
+    memset(suppressed_count, 0, sizeof (suppressed_count));
+}
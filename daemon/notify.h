@@ -40,6 +40,23 @@ typedef enum {
     NOTIFICATION_STYLE_CREATE_ALWAYS_NO_STATUS_ICON
 } notification_style_t;    
 
+/*
+ * Categories for the per-category shown/suppressed counters.
+ */
+typedef enum {
+    NOTIFICATION_CATEGORY_NWAM_UNAVAILABLE,
+    NOTIFICATION_CATEGORY_NCU_CONNECTED,
+    NOTIFICATION_CATEGORY_NCU_DISCONNECTED,
+    NOTIFICATION_CATEGORY_NCU_WIFI_CONNECT_FAILED,
+    NOTIFICATION_CATEGORY_NCU_DUP_ADDRESS,
+    NOTIFICATION_CATEGORY_NCU_WIFI_SELECTION_NEEDED,
+    NOTIFICATION_CATEGORY_NCU_WIFI_KEY_NEEDED,
+    NOTIFICATION_CATEGORY_NO_WIFI_NETWORKS,
+    NOTIFICATION_CATEGORY_NCP_CHANGED,
+    NOTIFICATION_CATEGORY_LOCATION_CHANGED,
+    NOTIFICATION_CATEGORY_LAST
+} notification_category_t;
+
 /* 
  * Should be called before trying to display any messages.
  *
@@ -115,6 +132,14 @@ void nwam_notification_cleanup( void );
 
 void nwam_notification_set_default_icon(GdkPixbuf *pixbuf);
 
+/*
+ * Number of messages shown, and of messages superseded by a newer one or
+ * dropped by the rate limit before being shown, for a category.
+ */
+void nwam_notification_get_stats( notification_category_t category, guint *shown, guint *suppressed );
+
+void nwam_notification_reset_stats( void );
+
 G_END_DECLS
 
 #endif	/* _notify_H */
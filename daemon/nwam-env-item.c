@@ -176,6 +176,8 @@ connect_env_signals(NwamEnvItem *self, NwamuiEnv *env)
       G_CALLBACK(on_nwam_env_notify), (gpointer)self);
     g_signal_connect (G_OBJECT(env), "notify::activation-mode",
       G_CALLBACK(on_nwam_env_notify), (gpointer)self);
+    g_signal_connect (G_OBJECT(env), "notify::switching",
+      G_CALLBACK(on_nwam_env_notify), (gpointer)self);
 }
 
 static void
@@ -216,7 +218,9 @@ on_nwam_env_toggled (GtkCheckMenuItem *item, gpointer data)
     g_signal_handlers_unblock_by_func(item, (gpointer)on_nwam_env_toggled, (gpointer)data);
 
 	if (!active) {
-		nwamui_object_set_active(NWAMUI_OBJECT(env), TRUE);
+        /* Returns at once, the item shows the location as switching until
+         * nwamd reports it online. */
+		nwamui_object_set_active_async(NWAMUI_OBJECT(env), TRUE, NULL, NULL);
 	}
 }
 
@@ -230,10 +234,14 @@ on_nwam_env_notify( GObject *gobject, GParamSpec *arg1, gpointer data)
     g_assert(NWAMUI_IS_ENV(object));
 
     /* arg1 could be NULL to force a refrest of all values */
-    if ( !arg1 || g_ascii_strcasecmp(arg1->name, "active") == 0) {
+    if ( !arg1 || g_ascii_strcasecmp(arg1->name, "active") == 0 ||
+      g_ascii_strcasecmp(arg1->name, "switching") == 0) {
         gboolean active;
 
-        active = nwamui_object_get_active(object);
+        /* Optimistically show the requested state while switching. */
+        if (!nwamui_object_is_switching(object, &active)) {
+            active = nwamui_object_get_active(object);
+        }
         g_signal_handlers_block_by_func(self, (gpointer)on_nwam_env_toggled, NULL);
         gtk_check_menu_item_set_active(GTK_CHECK_MENU_ITEM(self), active);
         g_signal_handlers_unblock_by_func(self, (gpointer)on_nwam_env_toggled, NULL);
@@ -247,10 +255,15 @@ on_nwam_env_notify( GObject *gobject, GParamSpec *arg1, gpointer data)
         gtk_image_set_from_icon_name( image, icon_name, GTK_ICON_SIZE_MENU );
     }
 
-    if (!arg1 || g_ascii_strcasecmp(arg1->name, "name") == 0) {
+    if (!arg1 || g_ascii_strcasecmp(arg1->name, "name") == 0 ||
+      g_ascii_strcasecmp(arg1->name, "switching") == 0) {
 
         gchar *menu_text = NULL;
-        menu_text = strdup(nwamui_object_get_name(object));
+        if (nwamui_object_is_switching(object, NULL)) {
+            menu_text = g_strdup_printf(_("%s (switching...)"), nwamui_object_get_name(object));
+        } else {
+            menu_text = strdup(nwamui_object_get_name(object));
+        }
         /* If there is any underscores we need to replace them with two since
          * otherwise it's interpreted as a mnemonic
          */
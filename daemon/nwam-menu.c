@@ -63,6 +63,10 @@ struct _MenuSection {
 	GtkWidget *lw;
 	GtkWidget *rw;
     gint children_number;
+    /* Children in menu order, which is menu_item_compare order, so inserts
+     * can binary search their position instead of re-sorting the section.
+     */
+    GPtrArray *items;
 };
 
 /* Each section is began with GtkSeparatorMenuItem, NULL means 0. We'd
@@ -76,6 +80,7 @@ struct _NwamMenuPrivate {
     gpointer place_holder;
 };
 
+static void nwam_menu_dispose (NwamMenu *self);
 static void nwam_menu_finalize (NwamMenu *self);
 static void nwam_menu_set_property(GObject         *object,
   guint            prop_id,
@@ -116,6 +121,10 @@ static void menu_section_get_positions(MenuSection *sec, gint *ret_start_pos, gi
 static void menu_section_children_changed(MenuSection *sec);
 static void menu_section_increase_children(MenuSection *sec);
 static void menu_section_decrease_children(MenuSection *sec);
+static gint menu_section_get_start_pos(MenuSection *sec);
+static gint menu_section_find_insert_index(MenuSection *sec, GtkWidget *child);
+static void menu_section_index_insert(MenuSection *sec, GtkWidget *child, gint idx);
+static void menu_section_index_remove(MenuSection *sec, GtkWidget *child);
 
 /* NwamMenu section utils */
 static void nwam_menu_get_section_positions(NwamMenu *self, gint sec_id,
@@ -132,6 +141,7 @@ nwam_menu_class_init (NwamMenuClass *klass)
     GtkMenuShellClass *menu_shell_class;
 
 	gobject_class = G_OBJECT_CLASS (klass);
+	gobject_class->dispose = (void (*)(GObject*)) nwam_menu_dispose;
 	gobject_class->finalize = (void (*)(GObject*)) nwam_menu_finalize;
 	gobject_class->set_property = nwam_menu_set_property;
 	gobject_class->get_property = nwam_menu_get_property;
@@ -176,6 +186,26 @@ nwam_menu_init (NwamMenu *self)
 /*     NwamMenuPrivate *prv = NWAM_MENU_GET_PRIVATE(self); */
 }
 
+/* Drop the index of our sections while their separators are still around
+ * to tell which ones are ours, removing the children afterwards copes with
+ * a NULL index.
+ */
+static void
+nwam_menu_dispose (NwamMenu *self)
+{
+    gint i;
+
+    for (i = 0; i < section_number; i++) {
+        if (prvsection[i].items && prvsection[i].lw &&
+          menu_section_get_menu_widget(&prvsection[i]) == GTK_WIDGET(self)) {
+            g_ptr_array_free(prvsection[i].items, TRUE);
+            prvsection[i].items = NULL;
+        }
+    }
+
+	G_OBJECT_CLASS(nwam_menu_parent_class)->dispose(G_OBJECT(self));
+}
+
 static void
 nwam_menu_finalize (NwamMenu *self)
 {
@@ -205,7 +235,7 @@ nwam_menu_set_property(GObject         *object,
 
         prvsection = g_realloc(prvsection, new_num * sizeof(MenuSection));
         /* Zero up to initilize. */
-        memset(prvsection + section_number*sizeof(MenuSection), 0, (new_num-section_number)*sizeof(MenuSection));
+        memset(prvsection + section_number, 0, (new_num-section_number)*sizeof(MenuSection));
         section_number = new_num;
     }
         break;
@@ -265,6 +295,7 @@ nwam_menu_real_remove(GtkContainer *container, GtkWidget *widget)
         g_assert(NWAM_IS_MENU(menu));
 
         GTK_CONTAINER_CLASS(nwam_menu_parent_class)->remove(GTK_CONTAINER(menu), widget);
+        menu_section_index_remove(&prvsection[index], widget);
         menu_section_decrease_children(&prvsection[index]);
     } else {
         GTK_CONTAINER_CLASS(nwam_menu_parent_class)->remove(container, widget);
@@ -295,36 +326,17 @@ nwam_menu_real_insert(GtkMenuShell *menu_shell,
 
     if (index >= 0) {
         GtkWidget *menu = menu_section_get_menu_widget(&prvsection[index]);
-        GList *sorted, *i;
-        gint start_pos = 0;
+        gint idx;
 
         /* Section related */
         g_assert(NWAM_IS_MENU(menu));
         g_assert(GTK_IS_MENU_ITEM(child) && !GTK_IS_SEPARATOR_MENU_ITEM(child));
 
-        /* Sorting */
-        menu_section_get_children(&prvsection[index], &sorted, &start_pos);
-
-        if (sorted) {
-            gboolean insert_child = TRUE;
-
-            sorted = g_list_sort(sorted, (GCompareFunc)menu_item_compare);
-
-            for (i = sorted; i; i = g_list_next(i)) {
-                if (insert_child && child && menu_item_compare(child, GTK_WIDGET(i->data)) < 0) {
-                    GTK_MENU_SHELL_CLASS(nwam_menu_parent_class)->insert(GTK_MENU_SHELL(menu), child, start_pos++);
-                    insert_child = FALSE;
-                }
-                gtk_menu_reorder_child(GTK_MENU(menu), GTK_WIDGET(i->data), start_pos++);
-            }
-            g_list_free(sorted);
-
-            if (insert_child)
-                GTK_MENU_SHELL_CLASS(nwam_menu_parent_class)->insert(GTK_MENU_SHELL(menu), child, start_pos++);
-
-        } else {
-            GTK_MENU_SHELL_CLASS(nwam_menu_parent_class)->insert(GTK_MENU_SHELL(menu), child, start_pos);
-        }
+        /* Sorted insert, the section is kept in order. */
+        idx = menu_section_find_insert_index(&prvsection[index], child);
+        GTK_MENU_SHELL_CLASS(nwam_menu_parent_class)->insert(GTK_MENU_SHELL(menu),
+          child, menu_section_get_start_pos(&prvsection[index]) + idx);
+        menu_section_index_insert(&prvsection[index], child, idx);
 
         menu_section_increase_children(&prvsection[index]);
     } else {
@@ -554,6 +566,67 @@ menu_section_get_positions(MenuSection *sec, gint *ret_start_pos, gint *ret_end_
     g_list_free(children);
 }
 
+/**
+ * menu_section_get_start_pos:
+ *
+ * Return the menu position of the first child of the section.
+ */
+static gint
+menu_section_get_start_pos(MenuSection *sec)
+{
+    GtkWidget *menu = menu_section_get_menu_widget(sec);
+    GtkWidget *start_sep = menu_section_get_left_widget(sec);
+
+    if (start_sep)
+        return g_list_index(GTK_MENU_SHELL(menu)->children, start_sep) + 1;
+    else
+        return 0;
+}
+
+/**
+ * menu_section_find_insert_index:
+ *
+ * Binary search the index in the section where child goes, after any child
+ * comparing equal to it.
+ */
+static gint
+menu_section_find_insert_index(MenuSection *sec, GtkWidget *child)
+{
+    gint lo = 0;
+    gint hi = sec->items ? sec->items->len : 0;
+
+    while (lo < hi) {
+        gint mid = (lo + hi) / 2;
+
+        if (menu_item_compare(child, GTK_WIDGET(g_ptr_array_index(sec->items, mid))) < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+static void
+menu_section_index_insert(MenuSection *sec, GtkWidget *child, gint idx)
+{
+    if (sec->items == NULL)
+        sec->items = g_ptr_array_new();
+
+    g_assert(idx >= 0 && idx <= sec->items->len);
+
+    g_ptr_array_add(sec->items, NULL);
+    g_memmove(&sec->items->pdata[idx + 1], &sec->items->pdata[idx],
+      (sec->items->len - idx - 1) * sizeof(gpointer));
+    sec->items->pdata[idx] = child;
+}
+
+static void
+menu_section_index_remove(MenuSection *sec, GtkWidget *child)
+{
+    if (sec->items)
+        g_ptr_array_remove(sec->items, child);
+}
+
 static void
 menu_section_children_changed(MenuSection *sec)
 {
@@ -630,25 +703,94 @@ nwam_menu_section_set_sensitive(NwamMenu *self, gint sec_id, gboolean sensitive)
     nwam_menu_section_foreach(self, sec_id, (GFunc)gtk_widget_set_sensitive, (gpointer)sensitive);
 }
 
+/**
+ * nwam_menu_resort_child:
+ *
+ * The sort key of @child changed, e.g. its signal strength or priority
+ * group, move it to its place so the section stays in menu_item_compare
+ * order for menu_section_find_insert_index().
+ */
 void
-nwam_menu_section_sort(NwamMenu *self, gint sec_id)
+nwam_menu_resort_child(NwamMenu *self, GtkWidget *child)
 {
-    NwamMenuPrivate *prv = NWAM_MENU_GET_PRIVATE(self);
-    GtkWidget *menu = menu_section_get_menu_widget(&prvsection[sec_id]);
+    MenuSection *sec;
+    gint index = -1;
+    gint old_idx;
+    gint idx;
+
+    g_signal_emit(self, nwam_menu_signals[GET_SECTION_INDEX], 0,
+      child, (gpointer)&index);
+
+    if (index < 0 || prvsection[index].items == NULL)
+        return;
+
+    sec = &prvsection[index];
+    for (old_idx = 0; old_idx < sec->items->len; old_idx++) {
+        if (g_ptr_array_index(sec->items, old_idx) == child)
+            break;
+    }
+    if (old_idx == sec->items->len)
+        return;
+
+    /* Still in order with its neighbours, nothing to move. */
+    if ((old_idx == 0 ||
+        menu_item_compare(GTK_WIDGET(g_ptr_array_index(sec->items, old_idx - 1)), child) <= 0) &&
+      (old_idx + 1 == sec->items->len ||
+        menu_item_compare(child, GTK_WIDGET(g_ptr_array_index(sec->items, old_idx + 1))) <= 0))
+        return;
+
+    g_ptr_array_remove_index(sec->items, old_idx);
+    idx = menu_section_find_insert_index(sec, child);
+    menu_section_index_insert(sec, child, idx);
+
+    gtk_menu_reorder_child(GTK_MENU(menu_section_get_menu_widget(sec)), child,
+      menu_section_get_start_pos(sec) + idx);
+}
+
+/**
+ * nwam_menu_section_replace:
+ * @items: menu items to put in the section, must not have a parent.
+ *
+ * Replace the content of the section in one pass, items are sorted once and
+ * appended in order instead of being inserted one by one.
+ *
+ * Returns the previous menu items of the section, each one is ref'ed.
+ */
+extern GList*
+nwam_menu_section_replace(NwamMenu *self, gint sec_id, GList *items)
+{
+    MenuSection *sec = &prvsection[sec_id];
+    GtkWidget *menu;
+    GList *old_children;
     GList *sorted, *i;
-    gint start_pos;
+    gint pos;
 
-    /* Sorting */
-    menu_section_get_children(&prvsection[sec_id], &sorted, &start_pos);
+    old_children = nwam_menu_section_delete(self, sec_id, TRUE);
 
-    if (sorted) {
-        sorted = g_list_sort(sorted, (GCompareFunc)menu_item_compare);
+    if (items == NULL)
+        return old_children;
 
-        for (i = sorted; i; i = g_list_next(i)) {
-            gtk_menu_reorder_child(GTK_MENU(menu), GTK_WIDGET(i->data), start_pos++);
-        }
-        g_list_free(sorted);
+    menu = menu_section_get_menu_widget(sec);
+    g_assert(NWAM_IS_MENU(menu));
+
+    sorted = g_list_sort(g_list_copy(items), (GCompareFunc)menu_item_compare);
+    pos = menu_section_get_start_pos(sec);
+
+    for (i = sorted; i; i = g_list_next(i)) {
+        GtkWidget *child = GTK_WIDGET(i->data);
+
+        g_assert(GTK_IS_MENU_ITEM(child) && !GTK_IS_SEPARATOR_MENU_ITEM(child));
+
+        GTK_MENU_SHELL_CLASS(nwam_menu_parent_class)->insert(GTK_MENU_SHELL(menu), child, pos++);
+        menu_section_index_insert(sec, child, sec->items ? sec->items->len : 0);
+        gtk_widget_show(child);
+        sec->children_number++;
     }
+    g_list_free(sorted);
+
+    menu_section_children_changed(sec);
+
+    return old_children;
 }
 
 static void
@@ -729,20 +871,15 @@ GtkWidget*
 nwam_menu_section_get_item_by_proxy(NwamMenu *self, gint sec_id, GObject* proxy)
 {
     NwamMenuPrivate *prv = NWAM_MENU_GET_PRIVATE(self);
-    GtkWidget *menu = menu_section_get_menu_widget(&prvsection[sec_id]);
-    GList *children;
-    GtkWidget *item = NULL;
+    GPtrArray *items = prvsection[sec_id].items;
+    gint i;
 
-    /* Sorting */
-    menu_section_get_children(&prvsection[sec_id], &children, NULL);
-
-    while (children) {
-        if (nwam_obj_proxy_get_proxy(NWAM_OBJ_PROXY_IFACE(children->data)) == (gpointer)proxy) {
-            item = GTK_WIDGET(children->data);
+    for (i = 0; items && i < items->len; i++) {
+        if (nwam_obj_proxy_get_proxy(NWAM_OBJ_PROXY_IFACE(g_ptr_array_index(items, i))) == (gpointer)proxy) {
+            return GTK_WIDGET(g_ptr_array_index(items, i));
         }
-        children = g_list_delete_link(children, children);
     }
-    return item;
+    return NULL;
 }
 
 static void
@@ -153,8 +153,9 @@ extern void nwam_menu_section_set_left(NwamMenu *self, gint sec_id, GtkWidget *w
 extern void nwam_menu_section_set_right(NwamMenu *self, gint sec_id, GtkWidget *w);
 extern void nwam_menu_section_set_visible(NwamMenu *self, gint sec_id, gboolean visible);
 extern void nwam_menu_section_set_sensitive(NwamMenu *self, gint sec_id, gboolean sensitive);
-extern void nwam_menu_section_sort(NwamMenu *self, gint sec_id);
+extern void nwam_menu_resort_child(NwamMenu *self, GtkWidget *child);
 extern GList* nwam_menu_section_delete(NwamMenu *self, gint sec_id, gboolean cached);
+extern GList* nwam_menu_section_replace(NwamMenu *self, gint sec_id, GList *items);
 extern GList* nwam_menu_section_get_list(NwamMenu *self, gint sec_id);
 extern void nwam_menu_section_foreach(NwamMenu *self, gint sec_id, GFunc func, gpointer user_data);
 
@@ -34,6 +34,7 @@
 
 #include "libnwamui.h"
 #include "nwam-menuitem.h"
+#include "nwam-menu.h"
 
 static void nwam_obj_proxy_init(NwamObjProxyInterface *iface);
 static GObject* nwam_menu_item_get_proxy(NwamObjProxyIFace *iface);
@@ -885,6 +886,22 @@ nwam_menu_item_compare(NwamMenuItem *self, NwamMenuItem *other)
     return NWAM_MENU_ITEM_GET_CLASS(self)->compare(NWAM_MENU_ITEM(self), NWAM_MENU_ITEM(other));
 }
 
+/**
+ * nwam_menu_item_sort_key_changed:
+ *
+ * Called by subclasses when what their compare function looks at changed,
+ * so the containing #NwamMenu can move the item.
+ */
+extern void
+nwam_menu_item_sort_key_changed(NwamMenuItem *self)
+{
+    GtkWidget *parent = gtk_widget_get_parent(GTK_WIDGET(self));
+
+    if (parent && NWAM_IS_MENU(parent)) {
+        nwam_menu_resort_child(NWAM_MENU(parent), GTK_WIDGET(self));
+    }
+}
+
 extern guint
 nwam_menu_item_get_required_auth(NwamMenuItem *self)
 {
@@ -190,6 +190,11 @@ connect_ncu_signals(NwamNcuItem *self, NwamuiNcu *ncu)
 /*       G_CALLBACK(on_nwam_ncu_notify), (gpointer)self); */
     g_signal_connect (G_OBJECT(ncu), "notify::activation-mode",
       G_CALLBACK(on_nwam_ncu_notify), (gpointer)self);
+    /* The rest of the sort key, see menu_ncu_item_compare(). */
+    g_signal_connect (G_OBJECT(ncu), "notify::priority-group",
+      G_CALLBACK(on_nwam_ncu_notify), (gpointer)self);
+    g_signal_connect (G_OBJECT(ncu), "notify::enabled",
+      G_CALLBACK(on_nwam_ncu_notify), (gpointer)self);
 
     /* Now according to activation mode to set sensitive */
 /*     prv->sensitive = nwamui_ncu_is_modifiable(NWAMUI_NCU(nwam_obj_proxy_get_proxy(NWAM_OBJ_PROXY_IFACE(self)))); */
@@ -259,6 +264,13 @@ on_nwam_ncu_notify( GObject *gobject, GParamSpec *arg1, gpointer data)
 /*         g_assert_not_reached (); */
 /*     } */
 
+    if (arg1 && (g_ascii_strcasecmp(arg1->name, "priority-group") == 0 ||
+        g_ascii_strcasecmp(arg1->name, "enabled") == 0 ||
+        g_ascii_strcasecmp(arg1->name, "activation-mode") == 0 ||
+        g_ascii_strcasecmp(arg1->name, "name") == 0)) {
+        nwam_menu_item_sort_key_changed(NWAM_MENU_ITEM(self));
+    }
+
     if (!arg1 || g_ascii_strcasecmp(arg1->name, "active") == 0) {
 
         g_signal_handlers_block_by_func(G_OBJECT(self), (gpointer)on_nwam_ncu_toggled, NULL);
@@ -41,7 +41,15 @@ typedef struct _NwamObjectTooltipWidgetPrivate NwamObjectTooltipWidgetPrivate;
         NWAM_TYPE_OBJECT_TOOLTIP_WIDGET, NwamObjectTooltipWidgetPrivate))
 
 struct _NwamObjectTooltipWidgetPrivate {
-    gulong place_holder;
+    /* What the current NCU markup was built from, the markup is only
+     * rebuilt when one of these changes.
+     */
+    gboolean                      ncu_info_valid;
+    nwamui_connection_state_t     state;
+    nwamui_wifi_signal_strength_t strength;
+    gboolean                      active;
+    gpointer                      wifi_info; /* Compared only, not ref'ed. */
+    GdkPixbuf                    *icon;
 };
 
 enum {
@@ -63,8 +71,9 @@ static void connect_object(NwamObjectTooltipWidget *self, NwamuiObject *object);
 static void disconnect_object(NwamObjectTooltipWidget *self, NwamuiObject *object);
 static void sync_object(NwamObjectTooltipWidget *self, NwamuiObject *object, gpointer user_data);
 static void nwam_menu_item_real_reset(NwamMenuItem *menu_item);
-static void nwam_object_notify(GObject *gobject, GParamSpec *arg1, gpointer user_data);
+static void nwam_object_changed(NwamuiObject *object, guint change_mask, gpointer user_data);
 static void nwam_object_activation_mode_notify(GObject *gobject, GParamSpec *arg1, gpointer user_data);
+static gboolean ncu_info_changed(NwamObjectTooltipWidget *self, NwamuiNcu *ncu);
 
 G_DEFINE_TYPE(NwamObjectTooltipWidget, nwam_object_tooltip_widget, NWAM_TYPE_MENU_ITEM)
 
@@ -111,6 +120,10 @@ nwam_object_tooltip_widget_finalize (NwamObjectTooltipWidget *self)
 {
     NwamObjectTooltipWidgetPrivate *prv = GET_PRIVATE(self);
 
+    if (prv->icon) {
+        g_object_unref(prv->icon);
+    }
+
 	G_OBJECT_CLASS(nwam_object_tooltip_widget_parent_class)->finalize(G_OBJECT (self));
 }
 
@@ -150,32 +163,32 @@ static void
 connect_object(NwamObjectTooltipWidget *self, NwamuiObject *object)
 {
     GType type = G_OBJECT_TYPE(object);
-
-    g_signal_connect (G_OBJECT(object), "notify::name",
-      G_CALLBACK(nwam_object_notify), (gpointer)self);
-    g_signal_connect (G_OBJECT(object), "notify::active",
-      G_CALLBACK(nwam_object_notify), (gpointer)self);
+    guint change_mask = NWAMUI_CHANGE_NAME | NWAMUI_CHANGE_STATE | NWAMUI_CHANGE_ACTIVE;
 
 	if (type == NWAMUI_TYPE_NCU) {
-        g_signal_connect (G_OBJECT(object), "notify::wifi-info",
-          G_CALLBACK(nwam_object_notify), (gpointer)self);
+        /* wifi-info */
+        change_mask |= NWAMUI_CHANGE_SIGNAL;
 
-    } else if (type == NWAMUI_TYPE_ENM) {
-        g_signal_connect (G_OBJECT(object), "notify::activation-mode",
-          G_CALLBACK(nwam_object_activation_mode_notify), (gpointer)self);
+        /* Force the first update for a new proxy. */
+        GET_PRIVATE(self)->ncu_info_valid = FALSE;
 
-        /* Call once on initial connection */
-        nwam_object_activation_mode_notify(G_OBJECT(object), NULL, (gpointer)self);
+    } else if (type == NWAMUI_TYPE_ENM) {
+        /* activation-mode */
+        change_mask |= NWAMUI_CHANGE_ENABLED;
     } else {
     }
 
+    nwamui_dispatch_subscribe(object, change_mask, nwam_object_changed, (gpointer)self);
+
     /* Call once on initial connection */
-    nwam_object_notify(G_OBJECT(object), NULL, (gpointer)self);
+    nwam_object_changed(object, NWAMUI_CHANGE_ALL, (gpointer)self);
 }
 
 static void
 disconnect_object(NwamObjectTooltipWidget *self, NwamuiObject *object)
 {
+    nwamui_dispatch_unsubscribe_by_data(object, (gpointer)self);
+
     g_signal_handlers_disconnect_matched(object,
       G_SIGNAL_MATCH_DATA,
       0,
@@ -188,7 +201,7 @@ disconnect_object(NwamObjectTooltipWidget *self, NwamuiObject *object)
 static void
 sync_object(NwamObjectTooltipWidget *self, NwamuiObject *object, gpointer user_data)
 {
-    nwam_object_notify(G_OBJECT(object), NULL, (gpointer)self);
+    nwam_object_changed(object, NWAMUI_CHANGE_ALL, (gpointer)self);
 }
 
 static void
@@ -198,20 +211,79 @@ nwam_menu_item_real_reset(NwamMenuItem *menu_item)
     /* gtk_widget_set_sensitive(GTK_WIDGET(menu_item), FALSE); */
 }
 
+/**
+ * ncu_info_changed:
+ *
+ * Return TRUE if the state, signal or wlan of the NCU changed since the
+ * markup was last built, and remember the new values.
+ */
+static gboolean
+ncu_info_changed(NwamObjectTooltipWidget *self, NwamuiNcu *ncu)
+{
+    NwamObjectTooltipWidgetPrivate *prv = GET_PRIVATE(self);
+    nwamui_connection_state_t       state;
+    nwamui_wifi_signal_strength_t   strength;
+    gboolean                        active;
+    gpointer                        wifi_info = NULL;
+    gboolean                        changed;
+
+    state = nwamui_ncu_get_connection_state(ncu);
+    strength = nwamui_ncu_get_wifi_signal_strength(ncu);
+    active = nwamui_object_get_active(NWAMUI_OBJECT(ncu));
+
+    if (nwamui_ncu_get_ncu_type(ncu) == NWAMUI_NCU_TYPE_WIRELESS) {
+        NwamuiWifiNet *wifi = nwamui_ncu_get_wifi_info(ncu);
+
+        if (wifi) {
+            wifi_info = (gpointer)wifi;
+            g_object_unref(wifi);
+        }
+    }
+
+    changed = !prv->ncu_info_valid ||
+      state != prv->state ||
+      strength != prv->strength ||
+      active != prv->active ||
+      wifi_info != prv->wifi_info;
+
+    prv->ncu_info_valid = TRUE;
+    prv->state = state;
+    prv->strength = strength;
+    prv->active = active;
+    prv->wifi_info = wifi_info;
+
+    return changed;
+}
+
 static void
-nwam_object_notify(GObject *gobject, GParamSpec *arg1, gpointer user_data)
+nwam_object_changed(NwamuiObject *object, guint change_mask, gpointer user_data)
 {
 	NwamObjectTooltipWidget *self = NWAM_OBJECT_TOOLTIP_WIDGET (user_data);
     NwamObjectTooltipWidgetPrivate *prv = GET_PRIVATE(self);
-    NwamuiObject *object = NWAMUI_OBJECT(gobject);
     GType         type;
     GtkWidget    *item;
 	GString      *gstr;
     const gchar        *name;
 
-    gstr = g_string_new("");
     type = G_OBJECT_TYPE(object);
 
+    if (type == NWAMUI_TYPE_ENM && (change_mask & NWAMUI_CHANGE_ENABLED)) {
+        nwam_object_activation_mode_notify(G_OBJECT(object), NULL, user_data);
+    }
+
+    /* Wlan notifies are chained to the NCU for every property, don't
+     * rebuild the markup unless something shown has changed.
+     */
+    if (type == NWAMUI_TYPE_NCU) {
+        gboolean renamed = (change_mask & NWAMUI_CHANGE_NAME) != 0;
+
+        if (!ncu_info_changed(self, NWAMUI_NCU(object)) && !renamed) {
+            return;
+        }
+    }
+
+    gstr = g_string_new("");
+
     name = nwamui_object_get_name(object);
 
 	if (type == NWAMUI_TYPE_NCU) {
@@ -236,11 +308,24 @@ nwam_object_notify(GObject *gobject, GParamSpec *arg1, gpointer user_data)
         }
         g_free(state);
 
-        /* Updated ncu status. Low frequency. */
+        /* Updated ncu status. Icons are cached, so a new pixbuf means a
+         * different icon.
+         */
         {
-            GtkWidget *img = gtk_image_new_from_pixbuf(nwamui_util_get_ncu_status_icon(NWAMUI_NCU(gobject), 24));
+            GdkPixbuf *icon = nwamui_util_get_ncu_status_icon(NWAMUI_NCU(object), 24);
+            GtkWidget *img  = nwam_menu_item_get_widget(NWAM_MENU_ITEM(user_data), 0);
+
+            if (img == NULL || !GTK_IS_IMAGE(img)) {
+                img = gtk_image_new_from_pixbuf(icon);
+                nwam_menu_item_set_widget(NWAM_MENU_ITEM(user_data), 0, img);
+            } else if (icon != prv->icon) {
+                gtk_image_set_from_pixbuf(GTK_IMAGE(img), icon);
+            }
 
-            nwam_menu_item_set_widget(NWAM_MENU_ITEM(user_data), 0, img);
+            if (prv->icon) {
+                g_object_unref(prv->icon);
+            }
+            prv->icon = icon;
         }
 
 	} else if (type == NWAMUI_TYPE_ENV) {
@@ -68,7 +68,7 @@ static void sync_wifi_net(NwamWifiItem *self, NwamuiWifiNet *wifi_net, gpointer
 static void nwam_menu_item_real_reset(NwamMenuItem *menu_item);
 
 static void on_nwam_wifi_toggled (GtkCheckMenuItem *item, gpointer data);
-static void wifi_net_notify( GObject *gobject, GParamSpec *arg1, gpointer user_data);
+static void wifi_net_changed( NwamuiObject *object, guint change_mask, gpointer user_data);
 
 G_DEFINE_TYPE(NwamWifiItem, nwam_wifi_item, NWAM_TYPE_MENU_ITEM)
 
@@ -223,7 +223,7 @@ on_nwam_wifi_toggled (GtkCheckMenuItem *item, gpointer data)
     gboolean             prof_ask_add_to_fav;
 
     /* Should we temporary set active to false for self, and wait for
-     * wifi_net_notify to update self? */
+     * wifi_net_changed to update self? */
     g_signal_handlers_block_by_func(item, (gpointer)on_nwam_wifi_toggled, (gpointer)data);
     gtk_check_menu_item_set_active(GTK_CHECK_MENU_ITEM(item), is_wifi_active(wifi));
     g_signal_handlers_unblock_by_func(item, (gpointer)on_nwam_wifi_toggled, (gpointer)data);
@@ -294,27 +294,21 @@ menu_wifi_item_compare(NwamMenuItem *self, NwamMenuItem *other)
 static void 
 connect_wifi_net_signals(NwamWifiItem *self, NwamuiWifiNet *wifi)
 {
-    g_signal_connect (wifi, "notify",
-      G_CALLBACK(wifi_net_notify), (gpointer)self);
+    nwamui_dispatch_subscribe(NWAMUI_OBJECT(wifi),
+      NWAMUI_CHANGE_ALL, wifi_net_changed, (gpointer)self);
 }
 
 static void 
 disconnect_wifi_net_signals(NwamWifiItem *self, NwamuiWifiNet *wifi)
 {
-    g_signal_handlers_disconnect_matched(wifi,
-      G_SIGNAL_MATCH_FUNC,
-      0,
-      NULL,
-      NULL,
-      (gpointer)wifi_net_notify,
-      NULL);
+    nwamui_dispatch_unsubscribe_by_data(NWAMUI_OBJECT(wifi), (gpointer)self);
 }
 
 static void
 sync_wifi_net(NwamWifiItem *self, NwamuiWifiNet *wifi, gpointer user_data)
 {
     gtk_widget_set_sensitive(GTK_WIDGET(self), TRUE);
-    wifi_net_notify(G_OBJECT(wifi), NULL, (gpointer)self);
+    wifi_net_changed(NWAMUI_OBJECT(wifi), NWAMUI_CHANGE_ALL, (gpointer)self);
 }
 
 static void
@@ -325,11 +319,11 @@ nwam_menu_item_real_reset(NwamMenuItem *menu_item)
 }
 
 static void 
-wifi_net_notify( GObject *gobject, GParamSpec *arg1, gpointer user_data)
+wifi_net_changed( NwamuiObject *object, guint change_mask, gpointer user_data)
 {
 	NwamWifiItem *self = NWAM_WIFI_ITEM (user_data);
     NwamWifiItemPrivate *prv = GET_PRIVATE(self);
-    NwamuiWifiNet *wifi = NWAMUI_WIFI_NET(gobject);
+    NwamuiWifiNet *wifi = NWAMUI_WIFI_NET(object);
     GtkWidget *img = NULL;
 
     g_assert(self);
@@ -349,7 +343,7 @@ wifi_net_notify( GObject *gobject, GParamSpec *arg1, gpointer user_data)
         g_object_unref(ncp);
     }
 
-    if (!arg1 || g_ascii_strcasecmp(arg1->name, "signal-strength") == 0) {
+    if (change_mask & NWAMUI_CHANGE_SIGNAL) {
 
           img = gtk_image_new_from_pixbuf
               (nwamui_util_get_wireless_strength_icon_with_size(nwamui_wifi_net_get_signal_strength(wifi),
@@ -359,7 +353,12 @@ wifi_net_notify( GObject *gobject, GParamSpec *arg1, gpointer user_data)
 
     }
 
-    if (!arg1 || g_ascii_strcasecmp(arg1->name, "status") == 0) {
+    /* Sorted by signal strength, then name. */
+    if (change_mask & (NWAMUI_CHANGE_SIGNAL | NWAMUI_CHANGE_NAME)) {
+        nwam_menu_item_sort_key_changed(NWAM_MENU_ITEM(self));
+    }
+
+    if (change_mask & (NWAMUI_CHANGE_STATE | NWAMUI_CHANGE_ACTIVE)) {
         gboolean active = is_wifi_active(wifi);
 
         g_signal_handlers_block_by_func(G_OBJECT(self), (gpointer)on_nwam_wifi_toggled, NULL);
@@ -367,7 +366,7 @@ wifi_net_notify( GObject *gobject, GParamSpec *arg1, gpointer user_data)
         g_signal_handlers_unblock_by_func(G_OBJECT(self), (gpointer)on_nwam_wifi_toggled, NULL);
     }
 
-    if (!arg1 || g_ascii_strcasecmp(arg1->name, "security") == 0) {
+    if (change_mask & NWAMUI_CHANGE_OTHER) {
           nwamui_wifi_security_t security = nwamui_wifi_net_get_security (wifi);
           const gchar           *secure_str;
 
@@ -60,6 +60,15 @@ static void add_any_new_wifi_to_fav(GObject *gobject, GParamSpec *arg1, gpointer
 static void action_on_no_fav_networks(GObject *gobject, GParamSpec *arg1, gpointer data);
 
 static glong                              update_wifi_timer_interval     = 5*1000;
+/* The rest of the scanned wlans are reachable through "More Networks...". */
+static guint                              wifi_menu_max_items            = 8;
+/* Detached menu items kept per item type. A pool growing past the high
+ * water mark is trimmed back to the low water mark.
+ */
+static guint                              menu_item_pool_low_water       = 4;
+static guint                              menu_item_pool_high_water      = 32;
+static guint                              animation_frame_interval       = 333;
+static glong                              animation_max_duration         = 30*1000;
 static nwamui_action_on_no_fav_networks_t prof_action_if_no_fav_networks = NWAMUI_NO_FAV_ACTION_NONE;
 static gboolean                           prof_ask_join_open_network     = FALSE;
 static gboolean                           prof_ask_join_fav_network      = FALSE;
@@ -80,6 +89,7 @@ enum {
     MENUITEM_SWITCH_LOC_AUTO,
     MENUITEM_ENV_PREF,
     MENUITEM_CONN_PROF,
+    MENUITEM_MORE_WLAN,
     MENUITEM_REFRESH_WLAN,
     MENUITEM_JOIN_WLAN,
     MENUITEM_VPN_PREF,
@@ -91,6 +101,9 @@ enum {
     N_STATIC_MENUITEMS
 };
 
+/* One frame for each of ALL_OK, NEEDS_ATTENTION and ERROR. */
+#define N_ANIMATION_FRAMES  (NWAMUI_DAEMON_STATUS_LAST - NWAMUI_DAEMON_STATUS_ALL_OK)
+
 struct _NwamStatusIconPrivate {
     GtkWidget    *menu;
 	gboolean      enable_pop_up_menu;
@@ -106,6 +119,14 @@ struct _NwamStatusIconPrivate {
     gint icon_stock_index;
     guint animation_icon_update_timeout_id;
 
+    /* Panel icon animation, frames are loaded for animation_frame_size. */
+    GdkPixbuf *animation_frames[N_ANIMATION_FRAMES];
+    gint       animation_frame_size;
+    GdkPixbuf *animation_last_frame;
+    GTimer    *animation_timer;
+    guint      animation_frames_rendered;
+    guint      animation_frames_skipped;
+
     guint    update_wifi_timer_id;
     guint    enable_sync_wifi_signals_timer_id;
     gulong   activate_handler_id;
@@ -116,17 +137,44 @@ struct _NwamStatusIconPrivate {
 	gboolean has_wifi;
 	gboolean is_scanning;
 
-    /* menu-item widget cache */
-    GList *cached_menuitem_list[N_SECTION];
+    /* Wifi section is only built when the menu is shown. */
+    gboolean wifi_section_stale;
+    gboolean wifi_section_truncated;
+    guint    wifi_section_idle_id;
+
+    /* menu-item widget pools, item GType -> MenuItemPool */
+    GHashTable *menu_item_pools;
 };
 
+typedef struct {
+    NwamStatusIcon *self;
+    GList          *items;
+} CollectMenuItemData;
+
+typedef struct {
+    GType   type;
+    GQueue  items;          /* Detached, each one is ref'ed */
+    guint   low_water;
+    guint   hits;
+    guint   misses;
+    guint   trimmed;
+} MenuItemPool;
+
 static void nwam_status_icon_finalize (NwamStatusIcon *self);
 
 static void nwam_menu_create_static_menuitems(NwamStatusIcon *self);
 static void nwam_menu_create_fake_menuitems(NwamStatusIcon *self, gint fake_item_id);
 
 static void nwam_status_icon_move_menu_items_to_cache(NwamStatusIcon *self, gint sec_id);
+static GtkWidget* menu_item_pool_take(NwamStatusIcon *self, GType type);
+static void menu_item_pool_return(NwamStatusIcon *self, GtkWidget *item);
+static void menu_item_pool_return_list(NwamStatusIcon *self, GList *items);
+static void menu_item_pool_prewarm(NwamStatusIcon *self, GType type, guint n, guint required_auth);
+static void menu_item_pool_free(MenuItemPool *pool);
+static void menu_item_pool_dump_stats(NwamStatusIcon *self);
+static GtkWidget* nwam_status_icon_get_menu_item(NwamStatusIcon *self, NwamuiObject *object);
 static GtkWidget* nwam_status_icon_create_menu_item(NwamStatusIcon *self, NwamuiObject *object);
+static void nwam_status_icon_replace_menu_items(NwamStatusIcon *self, gint sec_id, GList *items);
 static void nwam_status_icon_delete_menu_item(NwamStatusIcon *self, NwamuiObject *object);
 static void nwam_menu_get_section_index(NwamMenu *self, GtkWidget *child, gint *index, gpointer user_data);
 
@@ -134,11 +182,15 @@ static void nwam_menu_start_update_wifi_timer(NwamStatusIcon *self);
 static void nwam_menu_stop_update_wifi_timer(NwamStatusIcon *self);
 
 static void nwam_menu_recreate_wifi_menuitems (NwamStatusIcon *self, gboolean force_scan );
+static void nwam_menu_invalidate_wifi_section(NwamStatusIcon *self);
+static void nwam_menu_materialize_wifi_section(NwamStatusIcon *self);
+static void nwam_menu_update_more_wifi_menuitem(NwamStatusIcon *self);
 static void nwam_menu_recreate_ncu_menuitems (NwamStatusIcon *self);
 static void nwam_menu_recreate_env_menuitems (NwamStatusIcon *self);
 static void nwam_menu_recreate_enm_menuitems (NwamStatusIcon *self);
 
 static gboolean animation_panel_icon_timeout (gpointer user_data);
+static void animation_free_frames(NwamStatusIcon *self);
 static void trigger_animation_panel_icon (GConfClient *client,
   guint cnxn_id,
   GConfEntry *entry,
@@ -158,7 +210,7 @@ static void set_wireless_chooser_urgency( NwamStatusIcon *self, gboolean urgent
 static void join_wireless(NwamStatusIcon* self, NwamuiWifiNet *wifi, gboolean do_connect );
 static void set_join_wireless_urgency( NwamStatusIcon *self, gboolean urgent );
 static gboolean daemon_status_is_good(NwamuiDaemon *daemon);
-static void foreach_nwam_object_create_menuitem(gpointer data, gpointer user_data);
+static void foreach_nwam_object_collect_menuitem(gpointer data, gpointer user_data);
 
 /* call back */
 static void location_model_menuitems(GtkMenuItem *menuitem, gpointer user_data);
@@ -187,6 +239,7 @@ static void on_ncp_notify_many_wireless( GObject *gobject, GParamSpec *arg1, gpo
 
 /* nwamui ncu signals */
 static void ncu_notify_nwam_state(GObject *gobject, GParamSpec *arg1, gpointer data);
+static void ncu_changed(NwamuiObject *object, guint change_mask, gpointer data);
 static void ncu_notify_enabld(GObject *gobject, GParamSpec *arg1, gpointer data);
 
 /* GtkStatusIcon callbacks */
@@ -240,6 +293,7 @@ nwam_menuitem_notify_sensitive(GObject *gobject, GParamSpec *arg1, gpointer data
     case MENUITEM_NET_PREF:
         required_auth = UI_AUTH_ALL;
         break;
+    case MENUITEM_MORE_WLAN:
     case MENUITEM_REFRESH_WLAN:
     case MENUITEM_JOIN_WLAN:
         required_auth = UI_AUTH_WIRELESS_DIALOG;
@@ -286,8 +340,12 @@ daemon_add_object(NwamuiDaemon *daemon, NwamuiObject* object, gpointer user_data
 {
     NwamStatusIcon *self = NWAM_STATUS_ICON(user_data);
 
-    if (!NWAMUI_IS_WIFI_NET(object) ||
-      !NWAMUI_IS_KNOWN_WLAN(NWAMUI_WIFI_NET(object))) {
+    if (NWAMUI_IS_WIFI_NET(object)) {
+        /* Scan results only mark the wifi section, it is built on popup. */
+        if (!NWAMUI_IS_KNOWN_WLAN(NWAMUI_WIFI_NET(object))) {
+            nwam_menu_invalidate_wifi_section(self);
+        }
+    } else {
         nwam_status_icon_create_menu_item(self, object);
     }
 }
@@ -300,6 +358,10 @@ daemon_remove_object(NwamuiDaemon *daemon, NwamuiObject* object, gpointer user_d
     if (!NWAMUI_IS_WIFI_NET(object) ||
       !NWAMUI_IS_KNOWN_WLAN(NWAMUI_WIFI_NET(object))) {
         nwam_status_icon_delete_menu_item(self, object);
+
+        if (NWAMUI_IS_WIFI_NET(object)) {
+            nwam_menu_invalidate_wifi_section(self);
+        }
     }
 }
 
@@ -314,6 +376,12 @@ daemon_status_changed(NwamuiDaemon *daemon, GParamSpec *arg1, gpointer user_data
 
 	/* should repopulate data here */
 
+    /* The daemon status has settled, show the real one. */
+    if (prv->animation_icon_update_timeout_id > 0 &&
+      nwamui_daemon_get_status(daemon) != NWAMUI_DAEMON_STATUS_UNINITIALIZED) {
+        nwam_status_icon_stop_animation(self);
+    }
+
     switch(nwamui_daemon_get_status(daemon)) {
     case NWAMUI_DAEMON_STATUS_NEEDS_ATTENTION:
     case NWAMUI_DAEMON_STATUS_ALL_OK: {
@@ -576,6 +644,18 @@ ncu_notify_enabled(GObject *gobject, GParamSpec *arg1, gpointer data)
     nwam_menu_update_wifi_section(NWAM_STATUS_ICON(data));
 }
 
+static void
+ncu_changed(NwamuiObject *object, guint change_mask, gpointer data)
+{
+    if (change_mask & NWAMUI_CHANGE_STATE) {
+        ncu_notify_nwam_state(G_OBJECT(object), NULL, data);
+    }
+
+    if (change_mask & NWAMUI_CHANGE_ENABLED) {
+        ncu_notify_enabled(G_OBJECT(object), NULL, data);
+    }
+}
+
 static void
 ncp_add_ncu(NwamuiNcp *ncp, NwamuiNcu* ncu, gpointer data)
 {
@@ -830,11 +910,11 @@ connect_nwam_object_signals(GObject *obj, GObject *self)
 	} else if (type == NWAMUI_TYPE_NCU) {
         NwamuiNcu* ncu = NWAMUI_NCU(obj);
 
-        g_signal_connect(ncu, "notify::nwam-state",
-          G_CALLBACK(ncu_notify_nwam_state), (gpointer)self);
-
-        g_signal_connect(ncu, "notify::enabled",
-          G_CALLBACK(ncu_notify_enabled), (gpointer)self);
+        /* State and enabled changes come through the dispatcher, merged
+         * per main loop iteration. */
+        nwamui_dispatch_subscribe(NWAMUI_OBJECT(ncu),
+          NWAMUI_CHANGE_STATE | NWAMUI_CHANGE_ENABLED,
+          ncu_changed, (gpointer)self);
 
 /* 	} else if (type == NWAMUI_TYPE_ENV) { */
 /* 	} else if (type == NWAMUI_TYPE_ENM) { */
@@ -851,6 +931,7 @@ disconnect_nwam_object_signals(GObject *obj, GObject *self)
 	if (type == NWAMUI_TYPE_DAEMON) {
     } else if (type == NWAMUI_TYPE_NCP) {
 	} else if (type == NWAMUI_TYPE_NCU) {
+        nwamui_dispatch_unsubscribe_by_data(NWAMUI_OBJECT(obj), (gpointer)self);
 /* 	} else if (type == NWAMUI_TYPE_ENV) { */
 /* 	} else if (type == NWAMUI_TYPE_ENM) { */
 	} else {
@@ -901,17 +982,32 @@ ncp_find_enabled_wireless_ncu(gconstpointer a, gconstpointer b)
 }
 
 static void
-foreach_wifi_in_ncu_add_to_menuitem(gpointer key, gpointer value, gpointer user_data)
+foreach_wifi_in_ncu_collect_wifi(gpointer key, gpointer value, gpointer user_data)
 {
-    NwamStatusIcon *self = NWAM_STATUS_ICON(user_data);
+    GList **wifi_list = (GList **)user_data;
 
     g_return_if_fail(NWAMUI_WIFI_NET(value));
 
     if (nwamui_wifi_net_get_life_state(NWAMUI_WIFI_NET(value)) != NWAMUI_WIFI_LIFE_DEAD) {
-        nwam_status_icon_create_menu_item(self, NWAMUI_OBJECT(value));
+        *wifi_list = g_list_prepend(*wifi_list, value);
     }
 }
 
+/* Same order as NwamWifiItem, strongest signal first then by name. */
+static gint
+wifi_net_compare_by_signal(gconstpointer a, gconstpointer b)
+{
+    gint ret;
+
+    ret = (gint)nwamui_wifi_net_get_signal_strength(NWAMUI_WIFI_NET(b)) -
+      (gint)nwamui_wifi_net_get_signal_strength(NWAMUI_WIFI_NET(a));
+
+    if (ret == 0) {
+        ret = nwamui_object_sort_by_name(NWAMUI_OBJECT(a), NWAMUI_OBJECT(b));
+    }
+    return ret;
+}
+
 /**
  * nwam_menu_update_wifi_section:
  * Set visible of the wifi section according to if there is a wireless link
@@ -939,6 +1035,7 @@ nwam_menu_update_wifi_section(NwamStatusIcon *self)
         nwam_menu_section_set_sensitive(NWAM_MENU(prv->menu), SECTION_WIFI_CONTROL, FALSE);
         nwam_menu_section_set_visible(NWAM_MENU(prv->menu), SECTION_WIFI_CONTROL, FALSE);
     }
+    nwam_menu_update_more_wifi_menuitem(self);
 }
 
 static void
@@ -1094,19 +1191,154 @@ daemon_status_is_good(NwamuiDaemon *daemon)
     return FALSE;
 }
 
+static void
+animation_free_frames(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    gint                   i;
+
+    for (i = 0; i < N_ANIMATION_FRAMES; i++) {
+        if (prv->animation_frames[i]) {
+            g_object_unref(prv->animation_frames[i]);
+            prv->animation_frames[i] = NULL;
+        }
+    }
+    prv->animation_frame_size = 0;
+    prv->animation_last_frame = NULL;
+}
+
+/**
+ * animation_load_frames:
+ *
+ * Make sure the frames match the current size of the status icon, they are
+ * only rebuilt when the size changes. Return FALSE if the icon isn't embedded.
+ */
+static gboolean
+animation_load_frames(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    gint                   size;
+    gint                   i;
+
+    if (!gtk_status_icon_is_embedded(GTK_STATUS_ICON(self))) {
+        return FALSE;
+    }
+
+    size = gtk_status_icon_get_size(GTK_STATUS_ICON(self));
+
+    if (size != prv->animation_frame_size) {
+        animation_free_frames(self);
+
+        for (i = 0; i < N_ANIMATION_FRAMES; i++) {
+            prv->animation_frames[i] = nwamui_util_get_env_status_icon(GTK_STATUS_ICON(self),
+              (nwamui_daemon_status_t)(NWAMUI_DAEMON_STATUS_ALL_OK + i), size);
+        }
+        prv->animation_frame_size = size;
+    }
+    return TRUE;
+}
+
 static gboolean
 animation_panel_icon_timeout (gpointer user_data)
 {
     NwamStatusIcon *self = NWAM_STATUS_ICON(user_data);
     NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    GdkPixbuf *frame;
+
+    if (g_timer_elapsed(prv->animation_timer, NULL) * 1000 >= animation_max_duration) {
+        g_debug("%s: animation timed out", __func__);
+        /* Returning FALSE removes the source. */
+        prv->animation_icon_update_timeout_id = 0;
+        nwam_status_icon_stop_animation(self);
+        return FALSE;
+    }
+
+    prv->icon_stock_index = (prv->icon_stock_index + 1) % N_ANIMATION_FRAMES;
+
+    /* Nobody can see it, keep the timer but don't render. */
+    if (!gtk_status_icon_get_visible(GTK_STATUS_ICON(self)) ||
+      !animation_load_frames(self)) {
+        prv->animation_frames_skipped++;
+        return TRUE;
+    }
+
+    frame = prv->animation_frames[prv->icon_stock_index];
+
+    if (frame == NULL || frame == prv->animation_last_frame) {
+        prv->animation_frames_skipped++;
+        return TRUE;
+    }
+
+	gtk_status_icon_set_from_pixbuf(GTK_STATUS_ICON(self), frame);
+    prv->animation_last_frame = frame;
+    prv->animation_frames_rendered++;
 
-	gtk_status_icon_set_from_pixbuf(GTK_STATUS_ICON(self),
-      nwamui_util_get_env_status_icon(GTK_STATUS_ICON(self),
-		(nwamui_daemon_status_t)(++prv->icon_stock_index)%NWAMUI_DAEMON_STATUS_LAST,
-        0));
 	return TRUE;
 }
 
+/**
+ * nwam_status_icon_start_animation:
+ *
+ * Cycle the panel icon through the daemon states. The animation stops by
+ * itself after animation_max_duration, or when the daemon status changes.
+ */
+void
+nwam_status_icon_start_animation(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+
+    if (prv->animation_icon_update_timeout_id > 0) {
+        return;
+    }
+
+    if (prv->animation_timer == NULL) {
+        prv->animation_timer = g_timer_new();
+    } else {
+        g_timer_start(prv->animation_timer);
+    }
+    prv->icon_stock_index = 0;
+    prv->animation_last_frame = NULL;
+
+    prv->animation_icon_update_timeout_id = 
+      g_timeout_add (animation_frame_interval, animation_panel_icon_timeout, (gpointer)self);
+}
+
+void
+nwam_status_icon_stop_animation(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+
+    if (prv->animation_icon_update_timeout_id > 0) {
+		g_source_remove (prv->animation_icon_update_timeout_id);
+		prv->animation_icon_update_timeout_id = 0;
+    }
+
+    if (prv->animation_frame_size > 0) {
+        g_debug("%s: %u frames rendered, %u skipped so far", __func__,
+          prv->animation_frames_rendered, prv->animation_frames_skipped);
+
+        animation_free_frames(self);
+    }
+
+    /* reset everything of animation_panel_icon here */
+    prv->icon_stock_index = 0;
+    nwam_status_icon_set_status(self, NULL);
+}
+
+/**
+ * nwam_status_icon_get_animation_frames_rendered:
+ *
+ * Return how many animation frames were actually pushed to the panel, for
+ * power profiling.
+ */
+guint
+nwam_status_icon_get_animation_frames_rendered(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+
+    return prv->animation_frames_rendered;
+}
+
 static void
 trigger_animation_panel_icon (GConfClient *client,
   guint cnxn_id,
@@ -1116,25 +1348,15 @@ trigger_animation_panel_icon (GConfClient *client,
     NwamStatusIcon *self = NWAM_STATUS_ICON(user_data);
     NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
 
-	prv->animation_icon_update_timeout_id = 0;
 	GConfValue *value = NULL;
 	
 	g_assert (entry);
 	value = gconf_entry_get_value (entry);
 	g_assert (value);
 	if (gconf_value_get_bool (value)) {
-		g_assert (prv->animation_icon_update_timeout_id == 0);
-		prv->animation_icon_update_timeout_id = 
-          g_timeout_add (333, animation_panel_icon_timeout, (gpointer)self);
-		g_assert (prv->animation_icon_update_timeout_id > 0);
+        nwam_status_icon_start_animation(self);
 	} else {
-		g_assert (prv->animation_icon_update_timeout_id > 0);
-		g_source_remove (prv->animation_icon_update_timeout_id);
-		prv->animation_icon_update_timeout_id = 0;
-		/* reset everything of animation_panel_icon here */
-		gtk_status_icon_set_from_pixbuf(GTK_STATUS_ICON(self), 
-          nwamui_util_get_env_status_icon(GTK_STATUS_ICON(self), nwamui_daemon_get_status_icon_type(prv->daemon), 0));
-		prv->icon_stock_index = 0;
+        nwam_status_icon_stop_animation(self);
 	}
 }
 
@@ -1158,6 +1380,8 @@ nwam_status_icon_run(NwamStatusIcon *self)
 
     g_assert(prv->menu == NULL);
 
+    nwamui_trace_begin("nwam_status_icon_run");
+
     g_debug("%s: Hide self firstly!", __func__);
     gtk_status_icon_set_visible(GTK_STATUS_ICON(self), FALSE);
 
@@ -1170,8 +1394,18 @@ nwam_status_icon_run(NwamStatusIcon *self)
     g_signal_connect(G_OBJECT(prv->menu), "get_section_index",
       G_CALLBACK(nwam_menu_get_section_index), (gpointer)self);
 
+    prv->menu_item_pools = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+      NULL, (GDestroyNotify)menu_item_pool_free);
+
+    /* Have the top wlans' items ready for the first popup. */
+    nwamui_trace_begin("menu_item_pool_prewarm");
+    menu_item_pool_prewarm(self, NWAM_TYPE_WIFI_ITEM, wifi_menu_max_items, UI_AUTH_WIRELESS_DIALOG);
+    nwamui_trace_end("menu_item_pool_prewarm");
+
     /* Must create static menus before connect to any signals. */
+    nwamui_trace_begin("nwam_menu_create_static_menuitems");
     nwam_menu_create_static_menuitems(self);
+    nwamui_trace_end("nwam_menu_create_static_menuitems");
 
     g_object_notify(G_OBJECT(prv->prof), "ui_auth");
 
@@ -1202,6 +1436,8 @@ nwam_status_icon_run(NwamStatusIcon *self)
     if (prv->active_ncp) {
         nwamui_ncp_foreach_ncu(prv->active_ncp, (GFunc)initial_notify_nwam_object, (gpointer)self);
     }
+
+    nwamui_trace_end("nwam_status_icon_run");
 }
 
 void
@@ -1227,6 +1463,8 @@ nwam_status_icon_set_status(NwamStatusIcon *self, NwamuiNcu* wireless_ncu )
     gint                   env_status = nwamui_daemon_get_status_icon_type( prv->daemon );
 
     prv->current_status = env_status;
+    /* The panel no longer shows an animation frame. */
+    prv->animation_last_frame = NULL;
 
     /* nwam_notification_set_default_icon(nwamui_util_get_env_status_icon(GTK_STATUS_ICON(self), env_status, 48)); */
 
@@ -1264,6 +1502,10 @@ status_icon_popup(GtkStatusIcon *status_icon,
 
 	if (prv->enable_pop_up_menu && prv->menu != NULL) {
 
+        if (prv->wifi_section_stale) {
+            nwam_menu_materialize_wifi_section(NWAM_STATUS_ICON(status_icon));
+        }
+
 		gtk_menu_popup(GTK_MENU(prv->menu),
           NULL,
           NULL,
@@ -1331,7 +1573,7 @@ location_model_menuitems(GtkMenuItem *menuitem, gpointer user_data)
         case MENUITEM_SWITCH_LOC_AUTO:
             nwam_menu_section_set_sensitive(NWAM_MENU(prv->menu), SECTION_LOC, FALSE);
             /* Set enabled = false means manually selected. */
-            nwamui_object_set_active(NWAMUI_OBJECT(env), FALSE);
+            nwamui_object_set_active_async(NWAMUI_OBJECT(env), FALSE, NULL, NULL);
             break;
         default:
             g_assert_not_reached();
@@ -1355,6 +1597,9 @@ on_activate_static_menuitems (GtkMenuItem *menuitem, gpointer user_data)
     case MENUITEM_CONN_PROF:
 		argv[0] = NWAMUI_CAPPLET_OPT_NET_PREF_CONFIG_STR;
         break;
+    case MENUITEM_MORE_WLAN:
+        show_wireless_chooser(self);
+        break;
     case MENUITEM_REFRESH_WLAN:
         nwam_menu_recreate_wifi_menuitems(self, TRUE);
         break;
@@ -1482,8 +1727,12 @@ nwam_status_icon_init (NwamStatusIcon *self)
     prv->tooltip_widget = nwam_tooltip_widget_new();
     prv->needs_wifi_selection_seen = FALSE;
     prv->needs_wifi_key = NULL;
+    nwamui_trace_begin("nwamui_prof_get_instance");
     prv->prof = nwamui_prof_get_instance ();
+    nwamui_trace_end("nwamui_prof_get_instance");
+    nwamui_trace_begin("nwamui_daemon_get_instance");
 	prv->daemon = nwamui_daemon_get_instance ();
+    nwamui_trace_end("nwamui_daemon_get_instance");
 
     /* nwamui preference signals */
     g_signal_connect(prv->prof, "notify::ui-auth",
@@ -1512,6 +1761,11 @@ nwam_status_icon_finalize (NwamStatusIcon *self)
 
     nwam_menu_stop_update_wifi_timer(self);
 
+    if (prv->wifi_section_idle_id > 0) {
+        g_source_remove(prv->wifi_section_idle_id);
+        prv->wifi_section_idle_id = 0;
+    }
+
     disconnect_nwam_object_signals(G_OBJECT(prv->daemon), G_OBJECT(self));
 
     nwam_notification_cleanup();
@@ -1519,8 +1773,10 @@ nwam_status_icon_finalize (NwamStatusIcon *self)
     if (prv->animation_icon_update_timeout_id > 0) {
 		g_source_remove (prv->animation_icon_update_timeout_id);
 		prv->animation_icon_update_timeout_id = 0;
-/* 		/\* reset everything of animation_panel_icon here *\/ */
-/* 		prv->icon_stock_index = 0; */
+    }
+    animation_free_frames(self);
+    if (prv->animation_timer) {
+        g_timer_destroy(prv->animation_timer);
     }
 
     if (prv->wifi_dialog) {
@@ -1530,6 +1786,9 @@ nwam_status_icon_finalize (NwamStatusIcon *self)
         g_object_unref(prv->chooser_dialog);
     }
     g_object_unref(prv->menu);
+    /* Once, for the whole session. */
+    menu_item_pool_dump_stats(self);
+    g_hash_table_destroy(prv->menu_item_pools);
     g_object_unref(prv->tooltip_widget);
 	g_object_unref(prv->daemon);
     g_object_unref(prv->prof);
@@ -1554,13 +1813,17 @@ static void
 nwam_menu_recreate_ncu_menuitems (NwamStatusIcon *self)
 {
     NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    CollectMenuItemData    data;
 
     g_return_if_fail(prv->active_ncp);
 
     nwam_status_icon_move_menu_items_to_cache(self, SECTION_NCU);
 
     if (nwamui_ncp_get_ncu_num(prv->active_ncp) > 0) {
-        nwamui_ncp_foreach_ncu(prv->active_ncp, foreach_nwam_object_create_menuitem, (gpointer)self);
+        data.self = self;
+        data.items = NULL;
+        nwamui_ncp_foreach_ncu(prv->active_ncp, foreach_nwam_object_collect_menuitem, (gpointer)&data);
+        nwam_status_icon_replace_menu_items(self, SECTION_NCU, data.items);
 	} else {
         /* Make sure ref'ed, since menu is a container. */
         nwam_menu_create_fake_menuitems(self, MENUITEM_NONCU);
@@ -1572,12 +1835,99 @@ nwam_menu_recreate_ncu_menuitems (NwamStatusIcon *self)
     nwam_status_icon_move_menu_items_to_cache(self, SECTION_WIFI);
 
     nwam_menu_section_set_visible(NWAM_MENU(prv->menu), SECTION_WIFI, TRUE);
-    /* Sync all wlan menuitems */
-    g_debug("----------- menu item creation is started for NCP %s -------------",
-      nwamui_object_get_name(NWAMUI_OBJECT(prv->active_ncp)));
-    nwamui_ncp_foreach_ncu_foreach_wifi_info(prv->active_ncp, foreach_wifi_in_ncu_add_to_menuitem, (gpointer)self);
-    g_debug("----------- menu item creation is over for NCP %s    -------------",
-      nwamui_object_get_name(NWAMUI_OBJECT(prv->active_ncp)));
+    /* Wlan menuitems are synced when the menu is shown. */
+    nwam_menu_invalidate_wifi_section(self);
+}
+
+static gboolean
+wifi_section_idle_func(gpointer user_data)
+{
+    NwamStatusIcon        *self = NWAM_STATUS_ICON(user_data);
+    NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
+
+    prv->wifi_section_idle_id = 0;
+
+    if (prv->wifi_section_stale) {
+        nwam_menu_materialize_wifi_section(self);
+    }
+    return FALSE;
+}
+
+/**
+ * nwam_menu_invalidate_wifi_section:
+ *
+ * Mark the wifi section out of date. It is rebuilt before the menu pops up,
+ * or in an idle if the menu is already shown, so scan results don't create
+ * menu items nobody looks at.
+ */
+static void
+nwam_menu_invalidate_wifi_section(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
+
+    prv->wifi_section_stale = TRUE;
+
+    if (prv->menu && GTK_WIDGET_VISIBLE(prv->menu) && prv->wifi_section_idle_id == 0) {
+        prv->wifi_section_idle_id = g_idle_add(wifi_section_idle_func, (gpointer)self);
+    }
+}
+
+/**
+ * nwam_menu_materialize_wifi_section:
+ *
+ * Create menu items for the wifi_menu_max_items strongest wlans of the active
+ * ncp, the others are left to the wireless chooser.
+ */
+static void
+nwam_menu_materialize_wifi_section(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv       = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    CollectMenuItemData    data      = { self, NULL };
+    GList                 *wifi_list = NULL;
+    GList                 *i;
+    guint                  n;
+
+    prv->wifi_section_stale = FALSE;
+    prv->wifi_section_truncated = FALSE;
+
+    if (prv->active_ncp) {
+        g_debug("----------- menu item creation is started for NCP %s -------------",
+          nwamui_object_get_name(NWAMUI_OBJECT(prv->active_ncp)));
+
+        nwamui_ncp_foreach_ncu_foreach_wifi_info(prv->active_ncp, foreach_wifi_in_ncu_collect_wifi, (gpointer)&wifi_list);
+        wifi_list = g_list_sort(wifi_list, wifi_net_compare_by_signal);
+
+        for (i = wifi_list, n = 0; i && n < wifi_menu_max_items; i = g_list_next(i), n++) {
+            foreach_nwam_object_collect_menuitem(i->data, (gpointer)&data);
+        }
+        prv->wifi_section_truncated = (i != NULL);
+        g_list_free(wifi_list);
+
+        g_debug("----------- menu item creation is over for NCP %s    -------------",
+          nwamui_object_get_name(NWAMUI_OBJECT(prv->active_ncp)));
+    }
+
+    /* Previous items go to the cache even if there is nothing new. */
+    nwam_status_icon_replace_menu_items(self, SECTION_WIFI, data.items);
+    nwam_menu_update_more_wifi_menuitem(self);
+}
+
+static void
+nwam_menu_update_more_wifi_menuitem(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    GtkWidget             *item = prv->static_menuitems[MENUITEM_MORE_WLAN];
+
+    if (item == NULL)
+        return;
+
+    /* Section visibility shows every item, so fix it up afterwards. */
+    if (prv->wifi_section_truncated && prv->active_ncp &&
+      nwamui_ncp_get_wireless_link_num(prv->active_ncp) > 0) {
+        gtk_widget_show(item);
+    } else {
+        gtk_widget_hide(item);
+    }
 }
 
 static void
@@ -1585,9 +1935,12 @@ nwam_menu_recreate_env_menuitems (NwamStatusIcon *self)
 {
     NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
 
+    CollectMenuItemData    data = { self, NULL };
+
     nwam_status_icon_move_menu_items_to_cache(self, SECTION_LOC);
 
-    nwamui_daemon_foreach_loc(prv->daemon, foreach_nwam_object_create_menuitem, (gpointer)self);
+    nwamui_daemon_foreach_loc(prv->daemon, foreach_nwam_object_collect_menuitem, (gpointer)&data);
+    nwam_status_icon_replace_menu_items(self, SECTION_LOC, data.items);
 }
 
 static void
@@ -1595,9 +1948,12 @@ nwam_menu_recreate_enm_menuitems (NwamStatusIcon *self)
 {
     NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
 
+    CollectMenuItemData    data = { self, NULL };
+
     nwam_status_icon_move_menu_items_to_cache(self, SECTION_ENM);
 
-    nwamui_daemon_foreach_enm(prv->daemon, foreach_nwam_object_create_menuitem, (gpointer)self);
+    nwamui_daemon_foreach_enm(prv->daemon, foreach_nwam_object_collect_menuitem, (gpointer)&data);
+    nwam_status_icon_replace_menu_items(self, SECTION_ENM, data.items);
 }
 
 static void
@@ -1697,6 +2053,12 @@ nwam_menu_create_static_menuitems (NwamStatusIcon *self)
 /*     END_MENU_SECTION_SEPARATOR(root_menu, SECTION_WIFI, TRUE); */
 
     START_MENU_SECTION_SEPARATOR(root_menu, SECTION_WIFI_CONTROL, TRUE);
+    menu_append_item_with_code(root_menu,
+      GTK_TYPE_MENU_ITEM, _("_More Wireless Networks..."),
+      on_activate_static_menuitems, self,
+      CACHE_STATIC_MENUITEMS(self, MENUITEM_MORE_WLAN));
+    gtk_widget_hide(prv->static_menuitems[MENUITEM_MORE_WLAN]);
+
     menu_append_item_with_code(root_menu,
       GTK_TYPE_MENU_ITEM, _("_Refresh Wireless Networks"),
       on_activate_static_menuitems, self,
@@ -1743,17 +2105,14 @@ static void
 nwam_menu_create_fake_menuitems(NwamStatusIcon *self, gint fake_item_id)
 {
     NwamStatusIconPrivate *prv = NWAM_STATUS_ICON_GET_PRIVATE(self);
-    gint                   sec_id;
     GType                  type;
     GtkWidget             *item = NULL;
 
     switch (fake_item_id) {
     case MENUITEM_NONCU:
-        sec_id = SECTION_NCU;
         type = NWAM_TYPE_NCU_ITEM;
         break;
     case MENUITEM_NO_ENABLED_WIRELESS:
-        sec_id = SECTION_WIFI;
         type = NWAM_TYPE_WIFI_ITEM;
         break;
     default:
@@ -1761,19 +2120,14 @@ nwam_menu_create_fake_menuitems(NwamStatusIcon *self, gint fake_item_id)
         return;
     }
 
-    if (prv->cached_menuitem_list[sec_id]) {
-        /* Reuse cached widget. */
-        item = GTK_WIDGET(prv->cached_menuitem_list[sec_id]->data);
-        prv->cached_menuitem_list[sec_id] = g_list_delete_link(prv->cached_menuitem_list[sec_id], prv->cached_menuitem_list[sec_id]);
-        nwam_menu_item_set_proxy(NWAM_MENU_ITEM(item), NULL);
-    } else if (sec_id >= SECTION_WIFI && sec_id < SECTION_WIFI_CONTROL) {
-        item = g_object_new(type, NULL);
+    /* Pooled items are already detached. */
+    if ((item = menu_item_pool_take(self, type)) == NULL) {
+        item = g_object_ref_sink(g_object_new(type, NULL));
         /* nwam_menu_item_set_required_auth(NWAM_MENU_ITEM(item), required_auth); */
-    } else {
-        g_error("%s unknown nwamui object", __func__);
     }
 
     ADD_MENU_ITEM(NWAM_MENU(prv->menu), item);
+    g_object_unref(item);
 }
 
 static void
@@ -1782,17 +2136,146 @@ nwam_status_icon_move_menu_items_to_cache(NwamStatusIcon *self, gint sec_id)
     NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
     GList *menu_item_list = nwam_menu_section_delete(NWAM_MENU(prv->menu), sec_id, TRUE);
     
-    prv->cached_menuitem_list[sec_id] = g_list_concat(menu_item_list,
-      prv->cached_menuitem_list[sec_id]);
+    menu_item_pool_return_list(self, menu_item_list);
 }
 
+static MenuItemPool*
+menu_item_pool_lookup(NwamStatusIcon *self, GType type)
+{
+    NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    MenuItemPool          *pool;
+
+    if ((pool = g_hash_table_lookup(prv->menu_item_pools, GSIZE_TO_POINTER(type))) == NULL) {
+        pool = g_new0(MenuItemPool, 1);
+        pool->type = type;
+        g_queue_init(&pool->items);
+        pool->low_water = menu_item_pool_low_water;
+        if (type == NWAM_TYPE_WIFI_ITEM && pool->low_water < wifi_menu_max_items) {
+            pool->low_water = wifi_menu_max_items;
+        }
+        g_hash_table_insert(prv->menu_item_pools, GSIZE_TO_POINTER(type), pool);
+    }
+    return pool;
+}
+
+/**
+ * menu_item_pool_take:
+ *
+ * Return a detached menu item of the type from the pool, the caller owns
+ * the reference. NULL if the pool is empty.
+ */
 static GtkWidget*
-nwam_status_icon_create_menu_item(NwamStatusIcon *self, NwamuiObject *object)
+menu_item_pool_take(NwamStatusIcon *self, GType type)
+{
+    MenuItemPool *pool = menu_item_pool_lookup(self, type);
+    GtkWidget    *item;
+
+    if ((item = g_queue_pop_head(&pool->items)) != NULL) {
+        pool->hits++;
+    } else {
+        pool->misses++;
+    }
+    return item;
+}
+
+/**
+ * menu_item_pool_return:
+ * @item: a menu item without parent, the reference is taken over.
+ *
+ * Detach the item from its proxy object, so vanished objects are released
+ * now rather than when the item is reused, and put it back in its pool.
+ */
+static void
+menu_item_pool_return(NwamStatusIcon *self, GtkWidget *item)
+{
+    MenuItemPool *pool = menu_item_pool_lookup(self, G_OBJECT_TYPE(item));
+
+    g_assert(gtk_widget_get_parent(item) == NULL);
+
+    nwam_menu_item_set_proxy(NWAM_MENU_ITEM(item), NULL);
+    g_queue_push_head(&pool->items, item);
+
+    if (g_queue_get_length(&pool->items) > menu_item_pool_high_water) {
+        while (g_queue_get_length(&pool->items) > pool->low_water) {
+            item = g_queue_pop_tail(&pool->items);
+            gtk_widget_destroy(item);
+            g_object_unref(item);
+            pool->trimmed++;
+        }
+        if (nwamui_util_is_debug_mode()) {
+            g_debug("%s: trimmed %s pool to %d", __func__,
+              g_type_name(pool->type), pool->low_water);
+        }
+    }
+}
+
+static void
+menu_item_pool_return_list(NwamStatusIcon *self, GList *items)
+{
+    while (items) {
+        menu_item_pool_return(self, GTK_WIDGET(items->data));
+        items = g_list_delete_link(items, items);
+    }
+}
+
+static void
+menu_item_pool_prewarm(NwamStatusIcon *self, GType type, guint n, guint required_auth)
+{
+    MenuItemPool *pool = menu_item_pool_lookup(self, type);
+
+    while (g_queue_get_length(&pool->items) < n) {
+        GtkWidget *item = g_object_ref_sink(g_object_new(type, NULL));
+
+        nwam_menu_item_set_required_auth(NWAM_MENU_ITEM(item), required_auth);
+        g_queue_push_tail(&pool->items, item);
+    }
+}
+
+static void
+menu_item_pool_free(MenuItemPool *pool)
+{
+    GtkWidget *item;
+
+    while ((item = g_queue_pop_head(&pool->items)) != NULL) {
+        gtk_widget_destroy(item);
+        g_object_unref(item);
+    }
+    g_free(pool);
+}
+
+static void
+menu_item_pool_dump_stats_foreach(gpointer key, gpointer value, gpointer user_data)
+{
+    MenuItemPool *pool = (MenuItemPool *)value;
+
+    g_debug("Menu item pool %-16s size %3d hits %5d misses %5d trimmed %5d",
+      g_type_name(pool->type), g_queue_get_length(&pool->items),
+      pool->hits, pool->misses, pool->trimmed);
+}
+
+static void
+menu_item_pool_dump_stats(NwamStatusIcon *self)
+{
+    NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
+
+    if (nwamui_util_is_debug_mode()) {
+        g_hash_table_foreach(prv->menu_item_pools, menu_item_pool_dump_stats_foreach, NULL);
+    }
+}
+
+/**
+ * nwam_status_icon_get_menu_item:
+ *
+ * Return a menu item for object, reusing a pooled one if possible. The item
+ * isn't added to the menu, the caller owns the reference.
+ */
+static GtkWidget*
+nwam_status_icon_get_menu_item(NwamStatusIcon *self, NwamuiObject *object)
 {
     NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
     GType                  type = G_OBJECT_TYPE(object);
     GtkWidget             *item = NULL;
-    gint                   sec_id;
+    GType                  item_type;
     guint                  required_auth;
     GtkWidget *(*nwam_menu_item_new_func)(NwamuiObject *);
 
@@ -1804,19 +2287,19 @@ nwam_status_icon_create_menu_item(NwamStatusIcon *self, NwamuiObject *object)
 /*     } */
 
     if (type == NWAMUI_TYPE_NCU) {
-        sec_id = SECTION_NCU;
+        item_type = NWAM_TYPE_NCU_ITEM;
         nwam_menu_item_new_func = nwam_ncu_item_new;
         required_auth = UI_AUTH_ENABLE_OBJECT;
     } else if (type == NWAMUI_TYPE_WIFI_NET) {
-        sec_id = SECTION_WIFI;
+        item_type = NWAM_TYPE_WIFI_ITEM;
         nwam_menu_item_new_func = nwam_wifi_item_new;
         required_auth = UI_AUTH_WIRELESS_DIALOG;
 	} else if (type == NWAMUI_TYPE_ENV) {
-        sec_id = SECTION_LOC;
+        item_type = NWAM_TYPE_ENV_ITEM;
         nwam_menu_item_new_func = nwam_env_item_new;
         required_auth = UI_AUTH_ENABLE_OBJECT;
 	} else if (type == NWAMUI_TYPE_ENM) {
-        sec_id = SECTION_ENM;
+        item_type = NWAM_TYPE_ENM_ITEM;
         nwam_menu_item_new_func = nwam_enm_item_new;
         required_auth = UI_AUTH_ENABLE_OBJECT;
 	} else if (type == NWAMUI_TYPE_NCP) {
@@ -1826,22 +2309,47 @@ nwam_status_icon_create_menu_item(NwamStatusIcon *self, NwamuiObject *object)
         return NULL;
 	}
 
-    if (prv->cached_menuitem_list[sec_id]) {
-        /* Reuse cached widget. */
-        item = GTK_WIDGET(prv->cached_menuitem_list[sec_id]->data);
-        prv->cached_menuitem_list[sec_id] = g_list_delete_link(prv->cached_menuitem_list[sec_id], prv->cached_menuitem_list[sec_id]);
+    if ((item = menu_item_pool_take(self, item_type)) != NULL) {
+        /* Reuse pooled widget. */
         nwam_menu_item_set_proxy(NWAM_MENU_ITEM(item), G_OBJECT(object));
-    } else if (sec_id >= SECTION_WIFI && sec_id < SECTION_WIFI_CONTROL) {
-        item = nwam_menu_item_new_func(NWAMUI_OBJECT(object));
-        nwam_menu_item_set_required_auth(NWAM_MENU_ITEM(item), required_auth);
     } else {
-        g_error("%s unknown nwamui object", __func__);
+        item = g_object_ref_sink(nwam_menu_item_new_func(NWAMUI_OBJECT(object)));
+        nwam_menu_item_set_required_auth(NWAM_MENU_ITEM(item), required_auth);
     }
 
-    ADD_MENU_ITEM(NWAM_MENU(prv->menu), item);
     return item;
 }
 
+static GtkWidget*
+nwam_status_icon_create_menu_item(NwamStatusIcon *self, NwamuiObject *object)
+{
+    NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    GtkWidget             *item;
+
+    if ((item = nwam_status_icon_get_menu_item(self, object)) != NULL) {
+        ADD_MENU_ITEM(NWAM_MENU(prv->menu), item);
+        g_object_unref(item);
+    }
+    return item;
+}
+
+/**
+ * nwam_status_icon_replace_menu_items:
+ * @items: list of ref'ed menu items, freed.
+ *
+ * Fill a section in one pass, previous items go back to their pools.
+ */
+static void
+nwam_status_icon_replace_menu_items(NwamStatusIcon *self, gint sec_id, GList *items)
+{
+    NwamStatusIconPrivate *prv  = NWAM_STATUS_ICON_GET_PRIVATE(self);
+    GList *menu_item_list = nwam_menu_section_replace(NWAM_MENU(prv->menu), sec_id, items);
+
+    menu_item_pool_return_list(self, menu_item_list);
+    g_list_foreach(items, (GFunc)g_object_unref, NULL);
+    g_list_free(items);
+}
+
 static void
 nwam_status_icon_delete_menu_item(NwamStatusIcon *self, NwamuiObject *object)
 {
@@ -1875,7 +2383,7 @@ nwam_status_icon_delete_menu_item(NwamStatusIcon *self, NwamuiObject *object)
     if (item) {
         g_object_ref(item);
         REMOVE_MENU_ITEM(NWAM_MENU(prv->menu), item);
-        prv->cached_menuitem_list[sec_id] = g_list_prepend(prv->cached_menuitem_list[sec_id], item);
+        menu_item_pool_return(self, item);
     }
 }
 
@@ -1893,7 +2401,8 @@ nwam_menu_get_section_index(NwamMenu *self, GtkWidget *child, gint *index, gpoin
         *index = SECTION_LOC;
 	} else if (type == NWAM_TYPE_ENM_ITEM) {
         *index = SECTION_ENM;
-    } else if (child == (gpointer)prv->static_menuitems[MENUITEM_REFRESH_WLAN] ||
+    } else if (child == (gpointer)prv->static_menuitems[MENUITEM_MORE_WLAN] ||
+      child == (gpointer)prv->static_menuitems[MENUITEM_REFRESH_WLAN] ||
       child == (gpointer)prv->static_menuitems[MENUITEM_JOIN_WLAN]) {
         *index = SECTION_WIFI_CONTROL;
 	} else {
@@ -1997,12 +2506,13 @@ action_on_no_fav_networks(GObject *gobject, GParamSpec *arg1, gpointer data)
 }
 
 static void
-foreach_nwam_object_create_menuitem(gpointer data, gpointer user_data)
+foreach_nwam_object_collect_menuitem(gpointer data, gpointer user_data)
 {
-    NwamStatusIcon        *self = NWAM_STATUS_ICON(user_data);
-	GtkWidget* item = NULL;
+    CollectMenuItemData   *collect = (CollectMenuItemData *)user_data;
+	GtkWidget* item;
 
-    //nwam_menuitem_proxy_new(action, env_group);
-    item = nwam_status_icon_create_menu_item(self, NWAMUI_OBJECT(data));
+    if ((item = nwam_status_icon_get_menu_item(collect->self, NWAMUI_OBJECT(data))) != NULL) {
+        collect->items = g_list_prepend(collect->items, item);
+    }
 }
 
@@ -61,6 +61,12 @@ void nwam_status_icon_set_status(NwamStatusIcon *self, NwamuiNcu* wireless_ncu )
 
 void nwam_status_icon_show_menu(NwamStatusIcon *self);
 
+void nwam_status_icon_start_animation(NwamStatusIcon *self);
+
+void nwam_status_icon_stop_animation(NwamStatusIcon *self);
+
+guint nwam_status_icon_get_animation_frames_rendered(NwamStatusIcon *self);
+
 /* Others */
 extern void nwam_exec (const gchar **nwam_arg);
 
@@ -56,6 +56,10 @@ struct _NwamTooltipWidgetPrivate {
     GtkWidget *vpn_widget;
     GtkWidget *ncu_vbox;
 
+    /* One row per NCU of ncp, kept up to date by NCU notifies. */
+    NwamuiObject *ncp;
+    GHashTable *ncu_rows;
+
     /* Other */
     GList *w_list;
 #endif
@@ -135,6 +139,8 @@ nwam_tooltip_widget_init (NwamTooltipWidget *self)
     prv->ncu_vbox = gtk_vbox_new(TRUE, 0);
     gtk_widget_show(prv->ncu_vbox);
     gtk_box_pack_start(GTK_BOX(self), prv->ncu_vbox, TRUE, TRUE, 1);
+
+    prv->ncu_rows = g_hash_table_new(g_direct_hash, g_direct_equal);
 #endif
 }
 
@@ -143,6 +149,13 @@ nwam_tooltip_widget_finalize (NwamTooltipWidget *self)
 {
 	NwamTooltipWidgetPrivate *prv = NWAM_TOOLTIP_WIDGET_GET_PRIVATE(self);
 
+#if !DEF_CUSTOM_TREEVIEW_TOOLTIP
+    g_hash_table_destroy(prv->ncu_rows);
+    if (prv->ncp) {
+        g_object_unref(prv->ncp);
+    }
+#endif
+
 	G_OBJECT_CLASS(nwam_tooltip_widget_parent_class)->finalize(G_OBJECT(self));
 }
 
@@ -296,6 +309,7 @@ foreach_ncu_update_tooltip(gpointer obj, gpointer self)
 
     if (prv->w_list) {
         g_object_set(prv->w_list->data, "proxy-object", obj, NULL);
+        g_hash_table_insert(prv->ncu_rows, obj, prv->w_list->data);
         prv->w_list = g_list_delete_link(prv->w_list, prv->w_list);
     } else {
         nwam_tooltip_widget_add_ncu(NWAM_TOOLTIP_WIDGET(self), obj);
@@ -311,6 +325,18 @@ nwam_tooltip_widget_update_ncp(NwamTooltipWidget *self, NwamuiObject *ncp)
 
     g_object_set(prv->ncp_widget, "proxy-object", ncp, NULL);
 
+    /* Rows of the same NCP are already maintained by add/remove and NCU
+     * notifies.
+     */
+    if (prv->ncp == ncp) {
+        return;
+    }
+    if (prv->ncp) {
+        g_object_unref(prv->ncp);
+    }
+    prv->ncp = g_object_ref(ncp);
+    g_hash_table_remove_all(prv->ncu_rows);
+
     /* Get list of children, remove non-NCU children and then process.  */
     g_assert(prv->w_list == NULL);
     prv->w_list = gtk_container_get_children(GTK_CONTAINER(prv->ncu_vbox));
@@ -342,9 +368,16 @@ nwam_tooltip_widget_add_ncu(NwamTooltipWidget *self, NwamuiObject *object)
     gtk_list_store_append(GTK_LIST_STORE(model), &iter);
     gtk_list_store_set(GTK_LIST_STORE(model), &iter, 0, object, -1);
 #else
-    GtkWidget *label = nwam_object_tooltip_widget_new(NWAMUI_OBJECT(object));
+    GtkWidget *label;
+
+    if (g_hash_table_lookup(prv->ncu_rows, object)) {
+        return;
+    }
+
+    label = nwam_object_tooltip_widget_new(NWAMUI_OBJECT(object));
     gtk_widget_show(label);
     gtk_box_pack_start(GTK_BOX(prv->ncu_vbox), label, TRUE, TRUE, 1);
+    g_hash_table_insert(prv->ncu_rows, object, label);
 #endif
 }
 
@@ -373,20 +406,11 @@ nwam_tooltip_widget_remove_ncu(NwamTooltipWidget *self, NwamuiObject *object)
     }
 #else
     GtkWidget *label;
-    GList *w_list;
-
-    w_list = gtk_container_get_children(GTK_CONTAINER(prv->ncu_vbox));
 
-    for (; w_list;) {
-        NwamuiObject *old = (NwamuiObject*)nwam_obj_proxy_get_proxy(NWAM_OBJ_PROXY_IFACE(w_list->data));
-        
-        if (old == (gpointer)object) {
-            gtk_container_remove(GTK_CONTAINER(prv->ncu_vbox), GTK_WIDGET(w_list->data));
-            break;
-        }
-        w_list = g_list_delete_link(w_list, w_list);
+    if ((label = g_hash_table_lookup(prv->ncu_rows, object)) != NULL) {
+        g_hash_table_remove(prv->ncu_rows, object);
+        gtk_container_remove(GTK_CONTAINER(prv->ncu_vbox), label);
     }
-    g_list_free(w_list);
 #endif
 }
 
@@ -26,11 +26,13 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <gtk/gtk.h>
 #include <glib/gi18n.h>
 #include <libgnomeui/libgnomeui.h>
 
 #include <libnwamui.h>
+#include <nwam_pref_iface.h>
 
 static int indent = 0;
 
@@ -44,8 +46,14 @@ static void wlans_changed(NwamuiDaemon *daemon, guint type, gpointer data, gpoin
 
 static void process_wlan(gpointer key, gpointer value, gpointer user_data);
 
+static int  test_alloc_stats( void );
+static int  test_model_bench( void );
+
 /* Command-line options */
 static gboolean debug = FALSE;
+static gboolean alloc_stats = FALSE;
+static gchar**  alloc_budgets = NULL;
+static gboolean model_bench = FALSE;
 
 GOptionEntry application_options[] = {
     /*
@@ -57,6 +65,9 @@ GOptionEntry application_options[] = {
         { "wireless-chooser", 'c', 0, G_OPTION_ARG_NONE, &wireless_chooser, "Show 'Wireless Network Chooser' Dialog only", NULL  },
         */
         {"debug", 0, 0, G_OPTION_ARG_NONE, &debug, N_("Enable debugging messages"), NULL },
+        {"alloc-stats", 0, 0, G_OPTION_ARG_NONE, &alloc_stats, N_("Report allocations per operation, without a display"), NULL },
+        {"alloc-budget", 0, 0, G_OPTION_ARG_STRING_ARRAY, &alloc_budgets, N_("Fail if an operation makes more allocations than allowed"), N_("OPERATION=ALLOCS") },
+        {"model-bench", 0, 0, G_OPTION_ARG_NONE, &model_bench, N_("Time capplet model lookups across row moves, without a display"), NULL },
         { NULL }
 };
 
@@ -70,7 +81,21 @@ main(int argc, char** argv)
     GOptionContext*	option_context = NULL;
     GError*         err = NULL;
     NwamuiDaemon*   daemon = NULL;
-    
+    int             i;
+
+    /* The counting allocator must be in place before GLib allocates
+     * anything, so look for the option before parsing the command line.
+     */
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--alloc-stats") == 0) {
+            nwamui_alloc_stats_enable();
+            break;
+        }
+        if (strcmp(argv[i], "--model-bench") == 0) {
+            model_bench = TRUE;
+        }
+    }
+
     /* Initialise Thread Support */
     g_thread_init( NULL );
 
@@ -84,6 +109,21 @@ main(int argc, char** argv)
 
     option_context = g_option_context_new("test-nwam");
     g_option_context_add_main_entries(option_context, application_options, NULL);
+
+    if (nwamui_alloc_stats_is_enabled() || model_bench) {
+        /* Headless, no GNOME program or display needed. */
+        g_type_init();
+        if (!g_option_context_parse(option_context, &argc, &argv, &err)) {
+            g_printerr("%s\n", err->message);
+            g_error_free(err);
+            return (EXIT_FAILURE);
+        }
+        nwamui_util_set_debug_mode( debug );
+        if (model_bench) {
+            return test_model_bench();
+        }
+        return test_alloc_stats();
+    }
     
     program = gnome_program_init (PACKAGE, VERSION, LIBGNOMEUI_MODULE,
                                   argc, argv,
@@ -660,3 +700,398 @@ wlans_changed(NwamuiDaemon *daemon, guint type, gpointer data, gpointer user_dat
     }
 }
 
+
+/*
+ * Allocation accounting mode, see nwamui_alloc_stats.h. Each operation runs
+ * with fresh counters, allocations are reported per library entry point.
+ */
+typedef struct {
+    const gchar    *operation;
+    guint           allocs;
+    guint           bytes;
+} alloc_op_total_t;
+
+static void
+alloc_reload_object( gpointer data, gpointer user_data )
+{
+    nwamui_object_reload(NWAMUI_OBJECT(data));
+}
+
+static void
+alloc_validate_object( gpointer data, gpointer user_data )
+{
+    nwamui_object_validate(NWAMUI_OBJECT(data), NULL);
+}
+
+/*
+ * A stand-in for a capplet panel, so that nwam_pref_refresh() can be
+ * measured without a display. Its refresh rebuilds the models the panels
+ * show.
+ */
+typedef struct {
+    GObject         parent;
+    GtkTreeModel   *models[4];
+} AllocPref;
+
+typedef struct {
+    GObjectClass    parent_class;
+} AllocPrefClass;
+
+static void alloc_pref_iface_init( gpointer g_iface, gpointer iface_data );
+
+G_DEFINE_TYPE_EXTENDED (AllocPref, alloc_pref, G_TYPE_OBJECT, 0,
+  G_IMPLEMENT_INTERFACE (NWAM_TYPE_PREF_IFACE, alloc_pref_iface_init))
+
+static void
+alloc_pref_clear( AllocPref *self )
+{
+    guint i;
+
+    for (i = 0; i < G_N_ELEMENTS(self->models); i++) {
+        if (self->models[i] != NULL) {
+            g_object_unref(self->models[i]);
+            self->models[i] = NULL;
+        }
+    }
+}
+
+static gboolean
+alloc_pref_refresh( NwamPrefIFace *iface, gpointer user_data, gboolean force )
+{
+    AllocPref      *self = (AllocPref*)iface;
+    NwamuiDaemon   *daemon = nwamui_daemon_get_instance();
+    NwamuiObject   *ncp = nwamui_daemon_get_active_ncp(daemon);
+
+    alloc_pref_clear(self);
+    self->models[0] = nwamui_object_list_model_new(NWAMUI_OBJECT(daemon), NWAMUI_TYPE_NCP);
+    self->models[1] = nwamui_object_list_model_new(NWAMUI_OBJECT(daemon), NWAMUI_TYPE_ENV);
+    self->models[2] = nwamui_object_list_model_new(NWAMUI_OBJECT(daemon), NWAMUI_TYPE_ENM);
+    if (ncp != NULL) {
+        self->models[3] = nwamui_object_list_model_new(ncp, NWAMUI_TYPE_NCU);
+        g_object_unref(ncp);
+    }
+    g_object_unref(daemon);
+    return TRUE;
+}
+
+static void
+alloc_pref_finalize( GObject *object )
+{
+    alloc_pref_clear((AllocPref*)object);
+    G_OBJECT_CLASS(alloc_pref_parent_class)->finalize(object);
+}
+
+static void
+alloc_pref_class_init( AllocPrefClass *klass )
+{
+    G_OBJECT_CLASS(klass)->finalize = alloc_pref_finalize;
+}
+
+static void
+alloc_pref_init( AllocPref *self )
+{
+}
+
+static void
+alloc_pref_iface_init( gpointer g_iface, gpointer iface_data )
+{
+    NwamPrefInterface *iface = (NwamPrefInterface *)g_iface;
+
+    iface->refresh = alloc_pref_refresh;
+}
+
+static void
+alloc_print_entry_point( const nwamui_alloc_stats_t *stats, gpointer user_data )
+{
+    alloc_op_total_t   *total = (alloc_op_total_t*)user_data;
+
+    if (stats->calls == 0) {
+        return;
+    }
+
+    printf("%-20s %-52s %6u %8u %8u %10u %10u %6u %6u\n",
+      total->operation, stats->name, stats->calls,
+      stats->allocs, stats->frees, stats->bytes_allocated, stats->bytes_freed,
+      stats->objects_new, stats->objects_finalized);
+
+    total->allocs += stats->allocs;
+    total->bytes += stats->bytes_allocated;
+}
+
+static gboolean
+alloc_check_budget( const alloc_op_total_t *total )
+{
+    gchar **budget;
+
+    for (budget = alloc_budgets; budget != NULL && *budget != NULL; budget++) {
+        gchar  *eq = strchr(*budget, '=');
+        guint   max;
+
+        if (eq == NULL || strncmp(*budget, total->operation, eq - *budget) != 0 ||
+          total->operation[eq - *budget] != '\0') {
+            continue;
+        }
+
+        max = (guint)strtoul(eq + 1, NULL, 10);
+        if (total->allocs > max) {
+            printf("FAIL: %s made %u allocations, budget is %u\n", total->operation, total->allocs, max);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static int
+test_alloc_stats( void )
+{
+    NwamuiDaemon       *daemon = nwamui_daemon_get_instance();
+    GObject            *pref = g_object_new(alloc_pref_get_type(), NULL);
+    alloc_op_total_t    total;
+    gboolean            passed = TRUE;
+    gint                op;
+    const gchar        *operations[] = {
+        "ncp-reload",
+        "loc-reload",
+        "enm-reload",
+        "known-wlan-reload",
+        "scan-dispatch",
+        "scan-start",
+        "loc-validate",
+        "pref-refresh",
+        NULL
+    };
+
+    printf("%-20s %-52s %6s %8s %8s %10s %10s %6s %6s\n",
+      "OPERATION", "ENTRY POINT", "CALLS", "ALLOCS", "FREES", "BYTES", "FREED", "OBJNEW", "OBJFIN");
+
+    for (op = 0; operations[op] != NULL; op++) {
+        nwamui_alloc_stats_reset();
+
+        switch (op) {
+        case 0:
+            nwamui_daemon_foreach_ncp(daemon, alloc_reload_object, NULL);
+            break;
+        case 1:
+            nwamui_daemon_foreach_loc(daemon, alloc_reload_object, NULL);
+            break;
+        case 2:
+            nwamui_daemon_foreach_enm(daemon, alloc_reload_object, NULL);
+            break;
+        case 3:
+            nwamui_daemon_foreach_fav_wifi(daemon, alloc_reload_object, NULL);
+            break;
+        case 4:
+            nwamui_daemon_dispatch_wifi_scan_events_from_cache(daemon);
+            break;
+        case 5:
+            nwamui_daemon_wifi_start_scan(daemon);
+            break;
+        case 6:
+            nwamui_daemon_foreach_loc(daemon, alloc_validate_object, NULL);
+            break;
+        case 7:
+            nwam_pref_refresh(NWAM_PREF_IFACE(pref), NULL, TRUE);
+            break;
+        }
+
+        total.operation = operations[op];
+        total.allocs = 0;
+        total.bytes = 0;
+        nwamui_alloc_stats_foreach(alloc_print_entry_point, &total);
+        printf("%-20s %-52s %6s %8u %8s %10u\n", total.operation, "TOTAL", "", total.allocs, "", total.bytes);
+
+        if (!alloc_check_budget(&total)) {
+            passed = FALSE;
+        }
+    }
+
+    g_object_unref(pref);
+    g_object_unref(G_OBJECT(daemon));
+
+    return (passed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*
+ * Capplet model benchmark. A flat GtkTreeStore of plain GObjects, rows
+ * moved the way the profile dialog drags them (insert a copy, remove the
+ * original) and reordered, with capplet_model_find_object() locating each
+ * row. The row order is mirrored in an array to check every lookup.
+ * Timings are only reported, a wrong row fails.
+ */
+#define MODEL_BENCH_MOVES       2000
+#define MODEL_BENCH_REORDERS    20
+
+static gboolean
+model_bench_check( GtkTreeModel *model, GPtrArray *order, GObject *object )
+{
+    GtkTreeIter     iter;
+    GtkTreePath    *path;
+    GObject        *row_object = NULL;
+    gboolean        ret;
+
+    if (!capplet_model_find_object(model, object, &iter)) {
+        return FALSE;
+    }
+    gtk_tree_model_get(model, &iter, 0, &row_object, -1);
+    path = gtk_tree_model_get_path(model, &iter);
+    ret = row_object == object &&
+      g_ptr_array_index(order, gtk_tree_path_get_indices(path)[0]) == (gpointer)object;
+    gtk_tree_path_free(path);
+    if (row_object) {
+        g_object_unref(row_object);
+    }
+    return ret;
+}
+
+static gboolean
+model_bench_is_gt( GtkTreeModel *model, GtkTreePath *path, GtkTreeIter *iter, gpointer user_data )
+{
+    GObject    *object;
+    gint        key;
+
+    gtk_tree_model_get(model, iter, 0, &object, -1);
+    key = GPOINTER_TO_INT(g_object_get_data(object, "model-bench-key"));
+    g_object_unref(object);
+
+    return key > GPOINTER_TO_INT(user_data);
+}
+
+static gboolean
+model_bench_run( gint n_rows, GRand *rand )
+{
+    GtkTreeStore   *store = gtk_tree_store_new(1, G_TYPE_OBJECT);
+    GtkTreeModel   *model = GTK_TREE_MODEL(store);
+    GPtrArray      *order = g_ptr_array_new();
+    GTimer         *timer = g_timer_new();
+    GtkTreeIter     iter;
+    GtkTreeIter     sibling;
+    GtkTreeIter     moved;
+    gint           *new_order = g_new(gint, n_rows);
+    gpointer       *reordered = g_new(gpointer, n_rows);
+    gboolean        passed = TRUE;
+    gdouble         move_time;
+    gdouble         reorder_time;
+    gdouble         find_time;
+    gint            i;
+    gint            k;
+
+    for (i = 0; i < n_rows; i++) {
+        GObject *object = g_object_new(G_TYPE_OBJECT, NULL);
+
+        g_object_set_data(object, "model-bench-key", GINT_TO_POINTER(i * 2));
+        gtk_tree_store_insert_with_values(store, &iter, NULL, i, 0, object, -1);
+        g_ptr_array_add(order, object);
+        g_object_unref(object);
+    }
+    /* Builds the index. */
+    passed = model_bench_check(model, order, g_ptr_array_index(order, 0));
+
+    /* Sorted, so the sibling search has something to do. */
+    g_timer_start(timer);
+    for (i = 0; passed && i < MODEL_BENCH_MOVES; i++) {
+        gint key = g_rand_int_range(rand, 0, n_rows * 2);
+
+        if (capplet_model_1_level_find_first(model, NULL, model_bench_is_gt,
+            GINT_TO_POINTER(key), &sibling)) {
+            GObject *object;
+
+            gtk_tree_model_get(model, &sibling, 0, &object, -1);
+            passed = GPOINTER_TO_INT(g_object_get_data(object, "model-bench-key")) == (key | 1) + 1;
+            g_object_unref(object);
+        } else {
+            passed = key >= (n_rows - 1) * 2;
+        }
+    }
+    g_timer_stop(timer);
+    printf("%8d %-24s %10.2f\n", n_rows, "sibling-search", g_timer_elapsed(timer, NULL) * 1e6 / MODEL_BENCH_MOVES);
+
+    g_timer_start(timer);
+    for (i = 0; passed && i < MODEL_BENCH_MOVES; i++) {
+        gint        src = g_rand_int_range(rand, 0, n_rows);
+        gint        dst = g_rand_int_range(rand, 0, n_rows);
+        GObject    *object = g_ptr_array_index(order, src);
+
+        if (!capplet_model_find_object(model, object, &iter)) {
+            passed = FALSE;
+            break;
+        }
+        gtk_tree_model_iter_nth_child(model, &sibling, NULL, dst);
+        gtk_tree_store_insert_before(store, &moved, NULL, &sibling);
+        gtk_tree_store_set(store, &moved, 0, object, -1);
+        gtk_tree_store_remove(store, &iter);
+
+        /* The copy went in at dst, ahead of the original if dst <= src. */
+        k = (dst <= src ? dst : dst - 1);
+        g_ptr_array_remove_index(order, src);
+        g_ptr_array_add(order, NULL);
+        memmove(&order->pdata[k + 1], &order->pdata[k], (n_rows - 1 - k) * sizeof (gpointer));
+        order->pdata[k] = object;
+    }
+    g_timer_stop(timer);
+    move_time = g_timer_elapsed(timer, NULL);
+
+    g_timer_start(timer);
+    for (i = 0; passed && i < MODEL_BENCH_REORDERS; i++) {
+        for (k = 0; k < n_rows; k++) {
+            new_order[k] = k;
+        }
+        for (k = n_rows - 1; k > 0; k--) {
+            gint j = g_rand_int_range(rand, 0, k + 1);
+            gint t = new_order[k];
+
+            new_order[k] = new_order[j];
+            new_order[j] = t;
+        }
+        gtk_tree_store_reorder(store, NULL, new_order);
+
+        /* new_order[new position] = old position */
+        for (k = 0; k < n_rows; k++) {
+            reordered[k] = g_ptr_array_index(order, new_order[k]);
+        }
+        memcpy(order->pdata, reordered, n_rows * sizeof (gpointer));
+
+        passed = model_bench_check(model, order,
+          g_ptr_array_index(order, g_rand_int_range(rand, 0, n_rows)));
+    }
+    g_timer_stop(timer);
+    reorder_time = g_timer_elapsed(timer, NULL);
+
+    g_timer_start(timer);
+    for (k = 0; passed && k < n_rows; k++) {
+        passed = model_bench_check(model, order, g_ptr_array_index(order, k));
+    }
+    g_timer_stop(timer);
+    find_time = g_timer_elapsed(timer, NULL);
+
+    printf("%8d %-24s %10.2f\n", n_rows, "move", move_time * 1e6 / MODEL_BENCH_MOVES);
+    printf("%8d %-24s %10.2f\n", n_rows, "reorder", reorder_time * 1e6 / MODEL_BENCH_REORDERS);
+    printf("%8d %-24s %10.2f\n", n_rows, "find-object", find_time * 1e6 / n_rows);
+    if (!passed) {
+        printf("FAIL: %d rows, capplet model index out of step\n", n_rows);
+    }
+
+    g_free(reordered);
+    g_free(new_order);
+    g_timer_destroy(timer);
+    g_ptr_array_free(order, TRUE);
+    g_object_unref(store);
+
+    return passed;
+}
+
+static int
+test_model_bench( void )
+{
+    GRand      *rand = g_rand_new_with_seed(46);
+    gboolean    passed = TRUE;
+    gint        sizes[] = { 100, 1000, 10000, 0 };
+    gint        i;
+
+    printf("%8s %-24s %10s\n", "ROWS", "OPERATION", "USEC/OP");
+    for (i = 0; passed && sizes[i] != 0; i++) {
+        passed = model_bench_run(sizes[i], rand);
+    }
+    g_rand_free(rand);
+
+    return (passed ? EXIT_SUCCESS : EXIT_FAILURE);
+}